@@ -426,6 +426,7 @@ set(BASE_CMN_SRC
     src/common/dynload.cpp
     src/common/encconv.cpp
     src/common/evtloopcmn.cpp
+    src/common/evtprof.cpp
     src/common/extended.c
     src/common/ffile.cpp
     src/common/file.cpp
@@ -471,6 +472,8 @@ set(BASE_CMN_SRC
     src/common/tarstrm.cpp
     src/common/textbuf.cpp
     src/common/textfile.cpp
+    src/common/future.cpp
+    src/common/threadpool.cpp
     src/common/time.cpp
     src/common/timercmn.cpp
     src/common/timerimpl.cpp
@@ -546,6 +549,7 @@ set(BASE_CMN_HDR
     wx/eventfilter.h
     wx/evtloop.h
     wx/evtloopsrc.h
+    wx/evtprof.h
     wx/except.h
     wx/features.h
     wx/flags.h
@@ -622,6 +626,8 @@ set(BASE_CMN_HDR
     wx/textbuf.h
     wx/textfile.h
     wx/thread.h
+    wx/future.h
+    wx/threadpool.h
     wx/thrimpl.cpp
     wx/time.h
     wx/timer.h
@@ -759,7 +765,9 @@ set(GUI_CMN_SRC
     src/common/ctrlsub.cpp
     src/common/dcbase.cpp
     src/common/dcbufcmn.cpp
+    src/common/bmpcache.cpp
     src/common/dcgraph.cpp
+    src/common/dcpdf.cpp
     src/common/dcsvg.cpp
     src/common/dirctrlcmn.cpp
     src/common/dlgcmn.cpp
@@ -959,10 +967,12 @@ set(GUI_CMN_HDR
     wx/custombgwin.h
     wx/dc.h
     wx/dcclient.h
+    wx/bmpcache.h
     wx/dcgraph.h
     wx/dcmemory.h
     wx/dcprint.h
     wx/dcscreen.h
+    wx/dcpdf.h
     wx/dcsvg.h
     wx/dialog.h
     wx/dirdlg.h
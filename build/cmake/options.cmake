@@ -168,6 +168,7 @@ endif()
 wx_option(wxUSE_DIALUP_MANAGER "use dialup network classes" ${wxUSE_DIALUP_MANAGER_DEFAULT})
 wx_option(wxUSE_DYNLIB_CLASS "use wxDynamicLibrary class for DLL loading")
 wx_option(wxUSE_DYNAMIC_LOADER "use wxPluginLibrary and wxPluginManager classes")
+wx_option(wxUSE_EVENT_PROFILER "use wxEventProfiler class")
 wx_option(wxUSE_EXCEPTIONS "build exception-safe library")
 wx_option(wxUSE_EXTENDED_RTTI "use extended RTTI (XTI)" OFF)
 wx_option(wxUSE_FFILE "use wxFFile class")
@@ -103,6 +103,7 @@ library:
 @itemdef{wxUSE_DYNAMIC_LOADER, Use wxPluginManager and related classes. Requires wxDynamicLibrary}
 @itemdef{wxUSE_DYNLIB_CLASS, Use wxDynamicLibrary}
 @itemdef{wxUSE_EDITABLELISTBOX, Use wxEditableListBox class.}
+@itemdef{wxUSE_EVENT_PROFILER, Use wxEventProfiler class.}
 @itemdef{wxUSE_EXCEPTIONS, Use exception handling.}
 @itemdef{wxUSE_EXPAT, enable XML support using expat parser.}
 @itemdef{wxUSE_EXTENDED_RTTI, Use extended RTTI, see also Runtime class information (RTTI)}
@@ -41,6 +41,12 @@ public:
 protected:
     virtual wxPoint2DDouble DoTransformPoint(const wxPoint2DDouble& p) const override;
     virtual wxPoint2DDouble DoTransformDistance(const wxPoint2DDouble& p) const override;
+    virtual void DoTransformPoints(const wxPoint2DDouble* in,
+                                   wxPoint2DDouble* out,
+                                   size_t n) const override;
+    virtual void DoTransformRects(const wxRect2DDouble* in,
+                                  wxRect2DDouble* out,
+                                  size_t n) const override;
 
 private:
     wxDouble m_11, m_12, m_21, m_22, m_tx, m_ty;
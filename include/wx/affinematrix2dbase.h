@@ -115,11 +115,73 @@ public:
         *dy = dst.m_y;
     }
 
+    // applies the matrix to n points, "in" and "out" may be the same array
+    void TransformPoints(const wxPoint2DDouble* in,
+                         wxPoint2DDouble* out,
+                         size_t n) const
+    {
+        wxCHECK_RET( (in && out) || !n, "Can't be null" );
+
+        DoTransformPoints(in, out, n);
+    }
+
+    // computes the bounding boxes of n transformed rectangles, "in" and "out"
+    // may be the same array
+    void TransformRects(const wxRect2DDouble* in,
+                        wxRect2DDouble* out,
+                        size_t n) const
+    {
+        wxCHECK_RET( (in && out) || !n, "Can't be null" );
+
+        DoTransformRects(in, out, n);
+    }
+
 protected:
     virtual
         wxPoint2DDouble DoTransformPoint(const wxPoint2DDouble& p) const = 0;
     virtual
         wxPoint2DDouble DoTransformDistance(const wxPoint2DDouble& p) const = 0;
+
+    // these functions can be overridden to transform many points or
+    // rectangles more efficiently than doing it one by one
+    virtual void DoTransformPoints(const wxPoint2DDouble* in,
+                                   wxPoint2DDouble* out,
+                                   size_t n) const
+    {
+        for ( size_t i = 0; i < n; i++ )
+            out[i] = DoTransformPoint(in[i]);
+    }
+
+    virtual void DoTransformRects(const wxRect2DDouble* in,
+                                  wxRect2DDouble* out,
+                                  size_t n) const
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            const wxRect2DDouble& r = in[i];
+            const wxPoint2DDouble corners[] =
+            {
+                DoTransformPoint(wxPoint2DDouble(r.GetLeft(), r.GetTop())),
+                DoTransformPoint(wxPoint2DDouble(r.GetRight(), r.GetTop())),
+                DoTransformPoint(wxPoint2DDouble(r.GetLeft(), r.GetBottom())),
+                DoTransformPoint(wxPoint2DDouble(r.GetRight(), r.GetBottom()))
+            };
+
+            wxPoint2DDouble topLeft = corners[0],
+                            bottomRight = corners[0];
+            for ( const wxPoint2DDouble& p : corners )
+            {
+                topLeft.m_x = wxMin(topLeft.m_x, p.m_x);
+                topLeft.m_y = wxMin(topLeft.m_y, p.m_y);
+                bottomRight.m_x = wxMax(bottomRight.m_x, p.m_x);
+                bottomRight.m_y = wxMax(bottomRight.m_y, p.m_y);
+            }
+
+            out[i] = wxRect2DDouble(topLeft.m_x, topLeft.m_y,
+                                    bottomRight.m_x - topLeft.m_x,
+                                    bottomRight.m_y - topLeft.m_y);
+        }
+    }
 };
 
 #endif // wxUSE_GEOMETRY
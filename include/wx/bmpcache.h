@@ -0,0 +1,81 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/bmpcache.h
+// Purpose:     wxScaledBitmapCache class caching scaled bitmap variants
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_BMPCACHE_H_
+#define _WX_BMPCACHE_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_IMAGE
+
+#include "wx/bitmap.h"
+#include "wx/image.h"
+
+// ----------------------------------------------------------------------------
+// wxScaledBitmapCache: cache of bitmaps rescaled to a different scale factor
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxScaledBitmapCache
+{
+public:
+    // Statistics about the cache use.
+    struct Stats
+    {
+        // Number of lookups which found or didn't find the bitmap in cache.
+        size_t hits = 0;
+        size_t misses = 0;
+
+        // Number of least recently used entries removed because the cache
+        // size limit was reached.
+        size_t evictions = 0;
+
+        // Current number of entries and the approximate memory used by them.
+        size_t count = 0;
+        size_t bytes = 0;
+    };
+
+    // Enable or disable the use of the cache when drawing bitmaps. The cache
+    // is disabled by default.
+    static void Enable(bool enable = true);
+    static bool IsEnabled();
+
+    // Return the variant of the given bitmap with the specified scale factor,
+    // using the cached one if available. If the cache is disabled, or the
+    // bitmap already has this scale factor, or can't be rescaled, the bitmap
+    // itself is returned.
+    static wxBitmap
+    GetScaled(const wxBitmap& bitmap,
+              double scale,
+              wxImageResizeQuality quality = wxIMAGE_QUALITY_NEAREST);
+
+    // Remove all variants of the given bitmap from the cache: this must be
+    // called if the bitmap contents was modified directly, e.g. using
+    // wxPixelData, as the cache can't detect it.
+    static void Remove(const wxBitmap& bitmap);
+
+    // Remove all the entries from the cache.
+    static void Clear();
+
+    // Set or get the maximal amount of memory used by the cached bitmaps, the
+    // least recently used ones are removed when it is exceeded.
+    static void SetMaxBytes(size_t maxBytes);
+    static size_t GetMaxBytes();
+
+    // Get the cache statistics or reset the counters (but not the number of
+    // entries nor their size).
+    static Stats GetStats();
+    static void ResetStats();
+
+private:
+    wxScaledBitmapCache() = delete;
+};
+
+#endif // wxUSE_IMAGE
+
+#endif // _WX_BMPCACHE_H_
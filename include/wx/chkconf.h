@@ -338,6 +338,14 @@
 #   endif
 #endif /* !defined(wxUSE_STOPWATCH) */
 
+#ifndef wxUSE_EVENT_PROFILER
+#   ifdef wxABORT_ON_CONFIG_ERROR
+#       error "wxUSE_EVENT_PROFILER must be defined, please read comment near the top of this file."
+#   else
+#       define wxUSE_EVENT_PROFILER 0
+#   endif
+#endif /* !defined(wxUSE_EVENT_PROFILER) */
+
 #ifndef wxUSE_TEXTBUFFER
 #   ifdef wxABORT_ON_CONFIG_ERROR
 #       error "wxUSE_TEXTBUFFER must be defined, please read comment near the top of this file."
@@ -35,6 +35,11 @@
 // is private style and not returned by GetStyle.
 #define wxBUFFER_USES_SHARED_BUFFER 0x04
 
+// Keeps the buffer bitmap of wxBufferedPaintDC between paint events and
+// only redraws the parts of it which were invalidated by RefreshBuffer() and
+// not by Refresh(); implies wxBUFFER_CLIENT_AREA
+#define wxBUFFER_RETAINED           0x08
+
 class WXDLLIMPEXP_CORE wxBufferedDC : public wxMemoryDC
 {
 public:
@@ -156,6 +161,8 @@ public:
 
         if( buffer.IsOk() )
             Init(&m_paintdc, buffer, style);
+        else if ( style & wxBUFFER_RETAINED )
+            InitRetained(window, style);
         else
             Init(&m_paintdc, GetBufferedSize(window, style), style);
     }
@@ -170,7 +177,10 @@ public:
         if (style & wxBUFFER_VIRTUAL_AREA)
             window->PrepareDC( m_paintdc );
 
-        Init(&m_paintdc, GetBufferedSize(window, style), style);
+        if ( style & wxBUFFER_RETAINED )
+            InitRetained(window, style);
+        else
+            Init(&m_paintdc, GetBufferedSize(window, style), style);
     }
 
     // default copy ctor ok.
@@ -182,6 +192,28 @@ public:
         UnMask();
     }
 
+    // Return the part of the buffer which needs to be redrawn when using
+    // wxBUFFER_RETAINED style, the drawing is clipped to it. Without this
+    // style the entire buffer needs to be redrawn.
+    const wxRegion& GetDamagedRegion() const { return m_damagedRegion; }
+
+    // Functions for working with the buffers retained for the windows using
+    // wxBUFFER_RETAINED style.
+
+    // Mark the given rectangle, in client coordinates, or the entire buffer
+    // if it is null, as needing to be redrawn and refresh the window.
+    static void RefreshBuffer(wxWindow* window, const wxRect* rect = nullptr);
+
+    // Scroll the contents of the given rectangle, or the entire buffer, by
+    // the given offset, mark the uncovered part of it as needing to be
+    // redrawn and refresh the window. Returns false if there is no retained
+    // buffer for this window yet.
+    static bool ScrollBuffer(wxWindow* window, int dx, int dy,
+                             const wxRect* rect = nullptr);
+
+    // Free the retained buffer, it will be recreated on the next repaint.
+    static void DiscardBuffer(wxWindow* window);
+
 protected:
     // return the size needed by the buffer: this depends on whether we're
     // buffering just the currently shown part or the total (scrolled) window
@@ -192,8 +224,14 @@ protected:
     }
 
 private:
+    // Initialize the DC to use the retained buffer of this window.
+    void InitRetained(wxWindow* window, int style);
+
     wxPaintDC m_paintdc;
 
+    // The part of the retained buffer to redraw.
+    wxRegion m_damagedRegion;
+
     wxDECLARE_ABSTRACT_CLASS(wxBufferedPaintDC);
     wxDECLARE_NO_COPY_CLASS(wxBufferedPaintDC);
 };
@@ -0,0 +1,331 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/dcpdf.h
+// Purpose:     wxPDFFileDC
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_DCPDF_H_
+#define _WX_DCPDF_H_
+
+#include "wx/defs.h"
+
+// wxPDFFileDC compresses all the streams it writes, so it needs zlib.
+#if wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+
+#include "wx/string.h"
+#include "wx/dc.h"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+class WXDLLIMPEXP_FWD_BASE wxFileOutputStream;
+class WXDLLIMPEXP_FWD_BASE wxMemoryOutputStream;
+class WXDLLIMPEXP_FWD_BASE wxZlibOutputStream;
+
+class WXDLLIMPEXP_FWD_CORE wxPDFFileDC;
+
+class WXDLLIMPEXP_CORE wxPDFFileDCImpl : public wxDCImpl
+{
+public:
+    wxPDFFileDCImpl(wxPDFFileDC* owner, const wxString& filename,
+                    int width = 595, int height = 842, double dpi = 72.0,
+                    const wxString& title = wxString());
+
+    virtual ~wxPDFFileDCImpl();
+
+    bool IsOk() const override { return m_OK; }
+
+    virtual bool CanDrawBitmap() const override { return true; }
+    virtual bool CanGetTextExtent() const override { return true; }
+
+    virtual int GetDepth() const override { return 24; }
+
+    virtual void Clear() override;
+
+    virtual void DestroyClippingRegion() override;
+
+    virtual wxCoord GetCharHeight() const override;
+    virtual wxCoord GetCharWidth() const override;
+
+#if wxUSE_PALETTE
+    virtual void SetPalette(const wxPalette& WXUNUSED(palette)) override
+    {
+        wxFAIL_MSG(wxT("wxPDFFileDC::SetPalette not implemented"));
+    }
+#endif
+
+    virtual void SetLogicalFunction(wxRasterOperationMode WXUNUSED(function)) override
+    {
+        wxFAIL_MSG(wxT("wxPDFFileDC::SetLogicalFunction Call not implemented"));
+    }
+
+    virtual wxRasterOperationMode GetLogicalFunction() const override
+    {
+        return wxCOPY;
+    }
+
+    virtual void SetBackground(const wxBrush& brush) override;
+    virtual void SetBackgroundMode(int mode) override;
+    virtual void SetBrush(const wxBrush& brush) override;
+    virtual void SetFont(const wxFont& font) override;
+    virtual void SetPen(const wxPen& pen) override;
+
+    virtual void* GetHandle() const override { return nullptr; }
+
+    virtual bool StartDoc(const wxString& message) override;
+    virtual void EndDoc() override;
+    virtual void StartPage() override;
+    virtual void EndPage() override;
+
+private:
+    virtual bool DoGetPixel(wxCoord WXUNUSED(x), wxCoord WXUNUSED(y),
+                            wxColour* WXUNUSED(col)) const override
+    {
+        wxFAIL_MSG(wxT("wxPDFFileDC::DoGetPixel Call not implemented"));
+        return false;
+    }
+
+    virtual bool DoBlit(wxCoord xdest, wxCoord ydest,
+                        wxCoord width, wxCoord height,
+                        wxDC* source,
+                        wxCoord xsrc, wxCoord ysrc,
+                        wxRasterOperationMode rop,
+                        bool useMask = false,
+                        wxCoord xsrcMask = wxDefaultCoord,
+                        wxCoord ysrcMask = wxDefaultCoord) override;
+
+    virtual void DoCrossHair(wxCoord WXUNUSED(x), wxCoord WXUNUSED(y)) override
+    {
+        wxFAIL_MSG(wxT("wxPDFFileDC::CrossHair Call not implemented"));
+    }
+
+    virtual void DoDrawArc(wxCoord x1, wxCoord y1,
+                           wxCoord x2, wxCoord y2,
+                           wxCoord xc, wxCoord yc) override;
+
+    virtual void DoDrawBitmap(const wxBitmap& bmp, wxCoord x, wxCoord y,
+                              bool useMask = false) override;
+
+    virtual void DoDrawEllipse(wxCoord x, wxCoord y,
+                               wxCoord width, wxCoord height) override;
+
+    virtual void DoDrawEllipticArc(wxCoord x, wxCoord y, wxCoord w, wxCoord h,
+                                   double sa, double ea) override;
+
+    virtual void DoDrawIcon(const wxIcon& icon, wxCoord x, wxCoord y) override;
+
+    virtual void DoDrawLine(wxCoord x1, wxCoord y1, wxCoord x2, wxCoord y2) override;
+
+    virtual void DoDrawLines(int n, const wxPoint points[],
+                             wxCoord xoffset, wxCoord yoffset) override;
+
+    virtual void DoDrawPoint(wxCoord x, wxCoord y) override;
+
+    virtual void DoDrawPolygon(int n, const wxPoint points[],
+                               wxCoord xoffset, wxCoord yoffset,
+                               wxPolygonFillMode fillStyle = wxODDEVEN_RULE) override;
+
+    virtual void DoDrawPolyPolygon(int n, const int count[], const wxPoint points[],
+                                   wxCoord xoffset, wxCoord yoffset,
+                                   wxPolygonFillMode fillStyle) override;
+
+    virtual void DoDrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height) override;
+
+    virtual void DoDrawRotatedText(const wxString& text, wxCoord x, wxCoord y,
+                                   double angle) override;
+
+    virtual void DoDrawRoundedRectangle(wxCoord x, wxCoord y,
+                                        wxCoord width, wxCoord height,
+                                        double radius) override;
+
+    virtual void DoDrawText(const wxString& text, wxCoord x, wxCoord y) override;
+
+    virtual bool DoFloodFill(wxCoord WXUNUSED(x), wxCoord WXUNUSED(y),
+                             const wxColour& WXUNUSED(col),
+                             wxFloodFillStyle WXUNUSED(style)) override
+    {
+        wxFAIL_MSG(wxT("wxPDFFileDC::DoFloodFill Call not implemented"));
+        return false;
+    }
+
+    virtual void DoGradientFillLinear(const wxRect& rect,
+                                      const wxColour& initialColour,
+                                      const wxColour& destColour,
+                                      wxDirection nDirection) override;
+
+    virtual void DoGradientFillConcentric(const wxRect& rect,
+                                          const wxColour& initialColour,
+                                          const wxColour& destColour,
+                                          const wxPoint& circleCenter) override;
+
+    virtual void DoGetSize(int* width, int* height) const override
+    {
+        if ( width )
+            *width = m_width;
+        if ( height )
+            *height = m_height;
+    }
+
+    virtual void DoGetTextExtent(const wxString& string,
+                                 wxCoord* x, wxCoord* y,
+                                 wxCoord* descent = nullptr,
+                                 wxCoord* externalLeading = nullptr,
+                                 const wxFont* theFont = nullptr) const override;
+
+    virtual void DoSetDeviceClippingRegion(const wxRegion& region) override;
+
+    virtual void DoSetClippingRegion(wxCoord x, wxCoord y,
+                                     wxCoord w, wxCoord h) override;
+
+    virtual void DoGetSizeMM(int* width, int* height) const override;
+
+    virtual wxSize GetPPI() const override;
+
+    virtual wxSize FromDIP(const wxSize& sz) const override { return sz; }
+
+    virtual wxSize ToDIP(const wxSize& sz) const override { return sz; }
+
+    void Init(const wxString& filename, int width, int height,
+              double dpi, const wxString& title);
+
+private:
+    // Low level output functions: write directly to the file or to the
+    // (compressed) content stream of the current page.
+    void WriteFile(const char* data, size_t len);
+    void WriteFile(const wxString& s);
+    void Emit(const char* data, size_t len);
+    void Emit(const wxString& s);
+
+    // Allocate a new object number and remember the current file position as
+    // its offset (if it's written immediately) or just reserve the number.
+    int NewObject();
+    void BeginObject(int obj);
+
+    // Write the data compressed as stream contents of the given object, the
+    // dictionary must not be closed, i.e. not contain the final ">>".
+    void WriteStreamObject(int obj, const wxString& dict,
+                           const unsigned char* data, size_t len);
+
+    // Start a new page if there is no current one.
+    void EnsurePage();
+
+    // Finish the document if it hadn't been finished yet.
+    void DoEndDoc();
+
+    // Output the operators setting the stroke/fill attributes corresponding
+    // to the current pen/brush if they changed since the last time.
+    void ApplyPen();
+    void ApplyBrush();
+    void ApplyFillColour(const wxColour& colour);
+    void ApplyAlpha(bool stroke, unsigned char alpha);
+
+    // Return the painting operator to use for the current pen and brush or
+    // nullptr if nothing needs to be drawn at all.
+    const char* GetPaintOperator(bool closed, bool evenOdd = false);
+
+    // Append path construction operators for the given primitives, all
+    // coordinates are in device units.
+    void AppendEllipticArc(wxString& s, double cx, double cy,
+                           double rx, double ry,
+                           double sa, double ea, bool moveTo) const;
+
+    // Return the resource name of the font corresponding to the given wxFont.
+    wxString GetFontResource(const wxFont& font);
+
+    // Return the name of the ExtGState resource for the given alpha.
+    wxString GetAlphaResource(bool stroke, unsigned char alpha);
+
+    // Add a shading object and return its resource name.
+    wxString AddShading(const wxString& dict);
+
+    // Write the image (and its alpha mask, if any) unless an identical one
+    // had been already written and return its resource name.
+    wxString GetImageResource(const wxImage& image);
+
+    // Common part of DoGradientFill{Linear,Concentric}().
+    void DoFillShading(const wxRect& rect, const wxString& shading);
+
+    wxString            m_filename;
+    wxString            m_title;
+    bool                m_OK;
+    int                 m_width, m_height;
+    double              m_dpi;
+
+    std::unique_ptr<wxFileOutputStream> m_outfile;
+
+    // Objects offsets in the file, indexed by the object number (0 is unused).
+    std::vector<wxFileOffset> m_offsets;
+
+    // Object numbers of all the pages written so far.
+    std::vector<int> m_pages;
+
+    // Compressed content stream of the current page, only valid if
+    // m_pageOpen is true.
+    std::unique_ptr<wxMemoryOutputStream> m_pageBuffer;
+    std::unique_ptr<wxZlibOutputStream> m_pageStream;
+    bool                m_pageOpen;
+    bool                m_docEnded;
+
+    // Resources shared by all pages, mapping their names to the objects.
+    wxString            m_fontResources;
+    wxString            m_imageResources;
+    wxString            m_stateResources;
+    wxString            m_shadingResources;
+    std::map<wxString, wxString> m_fonts;      // base font name -> resource
+    std::map<int, wxString> m_alphaStates;     // 256*stroke + alpha -> resource
+    int                 m_shadingCount;
+
+    // Images already written to the file, indexed by their content hash.
+    struct ImageKey
+    {
+        wxUint64 hash1;
+        wxUint64 hash2;
+
+        bool operator<(const ImageKey& other) const
+        {
+            return hash1 < other.hash1 ||
+                    (hash1 == other.hash1 && hash2 < other.hash2);
+        }
+    };
+    std::map<ImageKey, wxString> m_images;
+
+    // Current graphics state of the page, to avoid redundant operators.
+    bool                m_penApplied;
+    bool                m_brushApplied;
+    wxColour            m_fillColour;
+    int                 m_strokeAlpha;
+    int                 m_fillAlpha;
+    wxString            m_currentFont;
+    double              m_currentFontSize;
+
+    // Number of "q" operators output by clipping functions.
+    size_t              m_clipNestingLevel;
+
+    wxDECLARE_ABSTRACT_CLASS(wxPDFFileDCImpl);
+    wxDECLARE_NO_COPY_CLASS(wxPDFFileDCImpl);
+};
+
+
+class WXDLLIMPEXP_CORE wxPDFFileDC : public wxDC
+{
+public:
+    wxPDFFileDC(const wxString& filename,
+                int width = 595,
+                int height = 842,
+                double dpi = 72.0,
+                const wxString& title = wxString())
+        : wxDC(new wxPDFFileDCImpl(this, filename, width, height, dpi, title))
+    {
+    }
+
+private:
+    wxDECLARE_ABSTRACT_CLASS(wxPDFFileDC);
+};
+
+#endif // wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+
+#endif // _WX_DCPDF_H_
@@ -32,6 +32,9 @@
 #include "wx/meta/convertible.h"
 #include "wx/meta/removeref.h"
 
+#include <atomic>
+#include <new>
+
 // This is now always defined, but keep it for backwards compatibility.
 #define wxHAS_CALL_AFTER
 
@@ -42,6 +45,8 @@
 class WXDLLIMPEXP_FWD_BASE wxList;
 class WXDLLIMPEXP_FWD_BASE wxEvent;
 class WXDLLIMPEXP_FWD_BASE wxEventFilter;
+class wxCoalescedEvents;
+class wxDynamicEventIndex;
 #if wxUSE_GUI
     class WXDLLIMPEXP_FWD_CORE wxDC;
     class WXDLLIMPEXP_FWD_CORE wxMenu;
@@ -1087,6 +1092,38 @@ public:
         m_handlerToProcessOnlyIn = nullptr;
     }
 
+    // Statistics about the events allocated on the heap, e.g. by Clone() or
+    // CallAfter(): the memory of the freed events is kept in a pool and
+    // reused for the new ones to avoid allocating it for each of them.
+    struct AllocStats
+    {
+        // Number of events allocated on the heap and how many of them reused
+        // the memory from the pool.
+        size_t allocations = 0;
+        size_t reused = 0;
+
+        // Number of freed memory blocks currently kept in the pool.
+        size_t pooled = 0;
+    };
+
+    // Get the allocation statistics or reset the counters (but not the
+    // number of pooled blocks).
+    static AllocStats GetAllocStats();
+    static void ResetAllocStats();
+
+#ifndef _WX_WANT_NEW_SIZET_WXCHAR_INT
+    // Allocate the events from the pool described above.
+    void *operator new(size_t size);
+    void operator delete(void *buf, size_t size);
+
+    // Still allow using placement and non-throwing new for the events.
+    void *operator new(size_t, void *buf) { return buf; }
+    void operator delete(void *, void *) { }
+
+    void *operator new(size_t size, const std::nothrow_t&) noexcept;
+    void operator delete(void *buf, const std::nothrow_t&) noexcept;
+#endif // !_WX_WANT_NEW_SIZET_WXCHAR_INT
+
 protected:
     wxObject*         m_eventObject;
     wxEventType       m_eventType;
@@ -1135,6 +1172,13 @@ private:
     // and this one needs to access our m_handlerToProcessOnlyIn
     friend class WXDLLIMPEXP_FWD_BASE wxEventProcessInHandlerOnly;
 
+    // and this one uses m_nextPending for its pending events queue
+    friend class WXDLLIMPEXP_FWD_BASE wxEvtHandler;
+
+    // The next event in the pending events queue of wxEvtHandler if this
+    // event is queued, nullptr otherwise.
+    wxEvent* m_nextPending;
+
 
     wxDECLARE_ABSTRACT_CLASS(wxEvent);
 };
@@ -1320,7 +1364,11 @@ enum wxIdleMode
 
         // Send idle events to windows that have
         // the wxWS_EX_PROCESS_IDLE flag specified
-    wxIDLE_PROCESS_SPECIFIED
+    wxIDLE_PROCESS_SPECIFIED,
+
+        // Send idle events only to the event handlers
+        // subscribed to them, see wxEvtHandler::SubscribeToIdleEvents()
+    wxIDLE_PROCESS_SUBSCRIBED
 };
 
 class WXDLLIMPEXP_BASE wxIdleEvent : public wxEvent
@@ -2928,7 +2976,12 @@ enum wxUpdateUIMode
 
         // Send UI update events to windows that have
         // the wxWS_EX_PROCESS_UI_UPDATES flag specified
-    wxUPDATE_UI_PROCESS_SPECIFIED
+    wxUPDATE_UI_PROCESS_SPECIFIED,
+
+        // Send UI update events only to the windows registered
+        // using wxWindow::RegisterForUpdateUI() and only after
+        // wxUpdateUIEvent::RequestUpdate() is called
+    wxUPDATE_UI_PROCESS_REGISTERED
 };
 
 class WXDLLIMPEXP_CORE wxUpdateUIEvent : public wxCommandEvent
@@ -2999,6 +3052,18 @@ public:
     // Returns the UI update mode
     static wxUpdateUIMode GetMode() { return sm_updateMode; }
 
+    // Notify wxWidgets that the application state has changed and the
+    // registered windows must be updated during the next idle time, this is
+    // only used in wxUPDATE_UI_PROCESS_REGISTERED mode.
+    static void RequestUpdate();
+
+    // Returns true if RequestUpdate() had been called since the last update.
+    static bool IsUpdateRequested() { return sm_updateRequested.load(); }
+
+    // Resets the flag set by RequestUpdate() and returns its previous value,
+    // this is called by wxWidgets itself when updating the registered windows.
+    static bool ResetUpdateRequest() { return sm_updateRequested.exchange(false); }
+
     virtual wxEvent *Clone() const override { return new wxUpdateUIEvent(*this); }
 
 protected:
@@ -3017,6 +3082,9 @@ protected:
     static long             sm_updateInterval;
     static wxUpdateUIMode   sm_updateMode;
 
+    // RequestUpdate() can be called from any thread.
+    static std::atomic<bool> sm_updateRequested;
+
 private:
     wxDECLARE_DYNAMIC_CLASS_NO_ASSIGN(wxUpdateUIEvent);
 };
@@ -3687,6 +3755,11 @@ public:
     // buffer as other wxString objects in this thread.
     virtual void QueueEvent(wxEvent *event);
 
+    // Same as QueueEvent(), but if an event queued with the same key for this
+    // handler is still pending, replace it with the new one instead of adding
+    // another event to the queue.
+    void QueueEventCoalesced(wxEvent *event, wxUIntPtr key);
+
     // Add an event to be processed later: notice that this function is not
     // safe to call from threads other than main, use QueueEvent()
     virtual void AddPendingEvent(const wxEvent& event)
@@ -3766,6 +3839,15 @@ public:
         QueueEvent(new wxAsyncMethodCallEventFunctor<T>(this, fn));
     }
 
+    // Similar to CallAfter() but only the last functor passed to this
+    // function with the same key is called if it's called several times
+    // before the pending call is executed.
+    template <typename T>
+    void CallAfterCoalesced(wxUIntPtr key, const T& fn)
+    {
+        QueueEventCoalesced(new wxAsyncMethodCallEventFunctor<T>(this, fn), key);
+    }
+
 
     // Connecting and disconnecting
     // ----------------------------
@@ -3923,6 +4005,28 @@ public:
     void *GetClientData() const { return DoGetClientData(); }
 
 
+    // Idle events subscription
+    // ------------------------
+
+    // In wxIDLE_PROCESS_SUBSCRIBED mode only the subscribed handlers get idle
+    // events. The handlers binding wxEVT_IDLE while this mode is active are
+    // subscribed automatically (or the window they're pushed on is), as are
+    // the windows using EVT_IDLE in their event tables, but the other
+    // handlers with static event table entries for it need to be subscribed
+    // explicitly.
+    void SubscribeToIdleEvents(bool subscribe = true);
+    bool IsSubscribedToIdleEvents() const { return m_idleSubscribed; }
+
+    // Return true if this handler has any wxEVT_IDLE handlers, either in its
+    // static event table or bound dynamically.
+    bool HasIdleEventHandlers() const;
+
+    // Send the given event to all the subscribed handlers and return true if
+    // any of them requested more idle events. This is called by wxWidgets
+    // itself from wxApp::ProcessIdle() in wxIDLE_PROCESS_SUBSCRIBED mode.
+    static bool SendIdleEventToSubscribers(wxIdleEvent& event);
+
+
     // implementation from now on
     // --------------------------
 
@@ -4018,16 +4122,41 @@ protected:
     typedef wxVector<wxDynamicEventTableEntry*> DynamicEvents;
     DynamicEvents* m_dynamicEvents;
 
-    wxList*             m_pendingEvents;
+    // Index of m_dynamicEvents by event type and ID, only created when there
+    // are many dynamic event handlers, see SearchDynamicEventTable().
+    wxDynamicEventIndex* m_dynamicEventsIndex;
+
+    // Pending events are added to this lock-free stack by QueueEvent(), which
+    // can be called from any thread, so it contains them in reverse order.
+    std::atomic<wxEvent*> m_pendingIncoming;
+
+    // And are moved from it to this list, linked by wxEvent::m_nextPending,
+    // by the thread processing them, so that they're in FIFO order here.
+    wxEvent*            m_pendingFirst;
+    wxEvent*            m_pendingLast;
+
+    // True if this handler is in wxApp list of handlers with pending events
+    // (or is about to be added to it), this is used to avoid locking wxApp
+    // list when queuing events for a handler which already has some.
+    std::atomic<bool>   m_pendingRegistered;
+
+    // Events queued by QueueEventCoalesced() and still pending, indexed by
+    // their keys, only allocated when this function is used for the first
+    // time.
+    std::atomic<wxCoalescedEvents*> m_coalescedEvents;
 
 #if wxUSE_THREADS
-    // critical section protecting m_pendingEvents
+    // critical section protecting m_pendingFirst and m_pendingLast, notice
+    // that it's never locked by QueueEvent()
     wxCriticalSection m_pendingEventsLock;
 #endif // wxUSE_THREADS
 
     // Is event handler enabled?
     bool                m_enabled;
 
+    // Is this handler in the list of handlers subscribed to idle events?
+    bool                m_idleSubscribed;
+
 
     // The user data: either an object which will be deleted by the container
     // when it's deleted or some raw pointer which we do nothing with - only
@@ -4060,6 +4189,17 @@ private:
     // try to process events in all handlers chained to this one
     bool DoTryChain(wxEvent& event);
 
+    // remove the entries of m_dynamicEvents which were unbound
+    void PruneDynamicEvents();
+
+    // move the events from m_pendingIncoming to the end of the pending events
+    // list, must be called with m_pendingEventsLock held
+    void TakeIncomingPendingEvents();
+
+    // remove this handler from wxApp list of handlers with pending events,
+    // unless new events were queued for it concurrently
+    void UnregisterPendingEventHandler();
+
     // Head of the event filter linked list.
     static wxEventFilter* ms_filterList;
 
@@ -13,6 +13,8 @@
 #include "wx/event.h"
 #include "wx/utils.h"
 
+#include <functional>
+
 // TODO: implement wxEventLoopSource for MSW (it should wrap a HANDLE and be
 //       monitored using MsgWaitForMultipleObjects())
 #if defined(__WXOSX__) || (defined(__UNIX__) && !defined(__WINDOWS__))
@@ -416,6 +418,44 @@ private:
     wxEventLoopBase *m_evtLoopOld;
 };
 
+#if wxUSE_THREADS
+
+// ----------------------------------------------------------------------------
+// wxEventLoopWatchdog: detects the main thread not processing events
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxEventLoopWatchdog
+{
+public:
+    // Function called from the watchdog thread when the main thread is stuck,
+    // taking the time, in milliseconds, since it processed events for the
+    // last time and the stack of the main thread, which may be empty if it
+    // couldn't be retrieved.
+    typedef std::function<void (long elapsed, const wxString& stack)> Callback;
+
+    // Start the watchdog thread reporting the main thread not processing
+    // events for longer than the given time, in milliseconds. Must be called
+    // from the main thread. The signal used to get the main thread stack
+    // under Unix can be specified, 0 means using SIGUSR2.
+    static bool Start(long threshold = 2000, int sig = 0);
+
+    // Stop the watchdog thread, if it's running.
+    static void Stop();
+
+    static bool IsRunning();
+
+    // Set the function to call instead of logging the stall reports.
+    static void SetCallback(const Callback& callback);
+
+    // Called by the event loop whenever it processes events or becomes idle.
+    static void Heartbeat();
+
+private:
+    wxEventLoopWatchdog() = delete;
+};
+
+#endif // wxUSE_THREADS
+
 #if wxUSE_GUI || wxUSE_CONSOLE_EVENTLOOP
 
 class wxEventLoopGuarantor
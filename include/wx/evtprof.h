@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/evtprof.h
+// Purpose:     wxEventProfiler class collecting event handlers statistics
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_EVTPROF_H_
+#define _WX_EVTPROF_H_
+
+#include "wx/event.h"
+
+#if wxUSE_EVENT_PROFILER
+
+#include <atomic>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// wxEventProfiler: measures the time taken by the event handlers
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxEventProfiler
+{
+public:
+    // Statistics about all calls of the same handler for the same event type.
+    struct Entry
+    {
+        // The type of the event and the name of its class.
+        wxEventType eventType = wxEVT_NULL;
+        wxString eventClass;
+
+        // The name of the class of the event handler object and the
+        // description of the function bound to the event.
+        wxString handlerClass;
+        wxString handlerName;
+
+        // Number of calls.
+        size_t count = 0;
+
+        // Total and maximal time taken by the calls, in nanoseconds.
+        wxLongLong_t totalTime = 0;
+        wxLongLong_t maxTime = 0;
+
+        // Maximal nesting level of the calls, 1 for the handlers called
+        // directly from the event loop, 2 for the handlers called while
+        // processing another event and so on.
+        int maxDepth = 0;
+    };
+
+    // Start or stop collecting the statistics.
+    static void Enable(bool enable = true);
+    static bool IsEnabled() { return ms_enabled.load(std::memory_order_relaxed); }
+
+    // Also record the individual calls, up to the given number of them, to
+    // allow exporting them using ExportChromeTrace(). The trace is not
+    // recorded by default and passing 0 to this function disables it again.
+    static void EnableTrace(size_t maxCalls = 100000);
+
+    // Return the statistics for all the handlers called since the last
+    // Reset(), sorted by the decreasing total time.
+    static std::vector<Entry> GetStats();
+
+    // Return the statistics formatted as a human-readable table.
+    static wxString Dump();
+
+    // Forget all the collected statistics and the recorded trace.
+    static void Reset();
+
+    // Save the recorded trace in Chrome trace event JSON format, which can
+    // be loaded in chrome://tracing or Perfetto UI.
+    static bool ExportChromeTrace(const wxString& filename);
+
+private:
+    static std::atomic<bool> ms_enabled;
+
+    wxEventProfiler() = delete;
+};
+
+#endif // wxUSE_EVENT_PROFILER
+
+#endif // _WX_EVTPROF_H_
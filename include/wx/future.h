@@ -0,0 +1,740 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/future.h
+// Purpose:     wxFuture and wxPromise classes for chaining asynchronous work
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_FUTURE_H_
+#define _WX_FUTURE_H_
+
+#include "wx/event.h"
+#include "wx/thread.h"
+
+#if wxUSE_THREADS
+    #include "wx/threadpool.h"
+#endif // wxUSE_THREADS
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if wxUSE_EXCEPTIONS
+    #include <exception>
+#endif // wxUSE_EXCEPTIONS
+
+template <typename T> class wxFuture;
+template <typename T> class wxPromise;
+template <typename T> class wxWeakRef;
+
+// ----------------------------------------------------------------------------
+// wxFutureStateBase: state shared between wxPromise and its wxFutures
+// ----------------------------------------------------------------------------
+
+// This class and wxFutureState<> are implementation only, don't use them.
+class WXDLLIMPEXP_BASE wxFutureStateBase
+{
+public:
+    wxFutureStateBase();
+    virtual ~wxFutureStateBase();
+
+    bool IsReady() const { return m_ready.load(std::memory_order_acquire); }
+
+    // Block until the state becomes ready.
+    void Wait();
+
+    // Call the given function once the state becomes ready, in the thread
+    // making it ready, or immediately if it already is.
+    void OnReady(std::function<void ()> func);
+
+#if wxUSE_EXCEPTIONS
+    // These functions can only be called once the state is ready.
+    bool HasException() const { return m_exception != nullptr; }
+    const std::exception_ptr& GetException() const { return m_exception; }
+
+    bool SetException(const std::exception_ptr& exception);
+#endif // wxUSE_EXCEPTIONS
+
+    // Called when the last promise associated with this state is destroyed:
+    // if no value had been set, the state becomes ready with the
+    // std::future_error exception.
+    void Abandon();
+
+protected:
+    // Must be called before storing the value, returns false if it had been
+    // already set before.
+    bool Claim() { return !m_claimed.exchange(true); }
+
+    // Must be called after storing the value.
+    void MakeReady();
+
+private:
+    std::atomic<bool> m_claimed;
+    std::atomic<bool> m_ready;
+
+#if wxUSE_EXCEPTIONS
+    std::exception_ptr m_exception;
+#endif // wxUSE_EXCEPTIONS
+
+#if wxUSE_THREADS
+    wxMutex m_mutex;
+    wxCondition m_cond;
+#endif // wxUSE_THREADS
+
+    std::vector< std::function<void ()> > m_callbacks;
+
+    wxDECLARE_NO_COPY_CLASS(wxFutureStateBase);
+};
+
+template <typename T>
+class wxFutureState : public wxFutureStateBase
+{
+public:
+    wxFutureState() { }
+
+    ~wxFutureState()
+    {
+        if ( m_hasValue )
+            m_value.~T();
+    }
+
+    bool SetValue(T value)
+    {
+        if ( !Claim() )
+            return false;
+
+        new (&m_value) T(std::move(value));
+        m_hasValue = true;
+
+        MakeReady();
+
+        return true;
+    }
+
+    // Can only be called once the state is ready and has no exception.
+    const T& GetValue() const { return m_value; }
+
+    // Same as GetValue() but moves the value out of the state, which can't
+    // be used any more after this.
+    T TakeValue()
+    {
+        wxASSERT_MSG( !m_taken, "future value was already taken" );
+        m_taken = true;
+
+        return std::move(m_value);
+    }
+
+private:
+    // This union is used to avoid requiring T to be default-constructible.
+    union
+    {
+        T m_value;
+    };
+
+    bool m_hasValue = false;
+    bool m_taken = false;
+};
+
+template <>
+class wxFutureState<void> : public wxFutureStateBase
+{
+public:
+    bool SetValue()
+    {
+        if ( !Claim() )
+            return false;
+
+        MakeReady();
+
+        return true;
+    }
+};
+
+// Destroying the last copy of this object abandons the state.
+class wxFutureAbandonGuard
+{
+public:
+    explicit wxFutureAbandonGuard(const std::shared_ptr<wxFutureStateBase>& state)
+        : m_state(state)
+    {
+    }
+
+    ~wxFutureAbandonGuard() { m_state->Abandon(); }
+
+private:
+    const std::shared_ptr<wxFutureStateBase> m_state;
+
+    wxDECLARE_NO_COPY_CLASS(wxFutureAbandonGuard);
+};
+
+// ----------------------------------------------------------------------------
+// wxPromise: provides the value of the associated wxFuture
+// ----------------------------------------------------------------------------
+
+// All copies of the promise share the same state and can be used to set its
+// value from any thread, but only once. If all of them are destroyed without
+// setting it, the future becomes ready with std::future_error exception.
+template <typename T>
+class wxPromiseBase
+{
+public:
+    wxPromiseBase()
+        : m_state(std::make_shared< wxFutureState<T> >()),
+          m_guard(std::make_shared<wxFutureAbandonGuard>(m_state))
+    {
+    }
+
+    wxFuture<T> GetFuture() const { return wxFuture<T>(m_state); }
+
+#if wxUSE_EXCEPTIONS
+    void SetException(const std::exception_ptr& exception)
+    {
+        if ( !m_state->SetException(exception) )
+            wxFAIL_MSG( "promise value was already set" );
+    }
+#endif // wxUSE_EXCEPTIONS
+
+protected:
+    const std::shared_ptr< wxFutureState<T> > m_state;
+
+private:
+    std::shared_ptr<wxFutureAbandonGuard> m_guard;
+};
+
+template <typename T>
+class wxPromise : public wxPromiseBase<T>
+{
+public:
+    void SetValue(T value)
+    {
+        if ( !this->m_state->SetValue(std::move(value)) )
+            wxFAIL_MSG( "promise value was already set" );
+    }
+};
+
+template <>
+class wxPromise<void> : public wxPromiseBase<void>
+{
+public:
+    void SetValue()
+    {
+        if ( !m_state->SetValue() )
+            wxFAIL_MSG( "promise value was already set" );
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Helpers used by wxFuture::Then()
+// ----------------------------------------------------------------------------
+
+namespace wxPrivate
+{
+
+// Reference to the handler used by wxFuture::Then(), allowing to check if it
+// still exists in the main thread, where it must be used.
+class WXDLLIMPEXP_BASE FutureHandlerRef
+{
+public:
+    explicit FutureHandlerRef(wxEvtHandler* handler);
+
+    // Call the given function during the next event loop iteration in the
+    // main thread, but only if the handler still exists at that time.
+    void CallAfter(const std::function<void ()>& func) const;
+
+private:
+    // The weak reference itself is only used, and destroyed, in the main
+    // thread, as wxWeakRef is not thread-safe.
+    std::shared_ptr< wxWeakRef<wxEvtHandler> > m_ref;
+};
+
+// Type returned by the continuation called with the value of wxFuture<T>.
+template <typename T, typename F>
+struct FutureCallResult
+{
+    typedef decltype(std::declval<F&>()(std::declval<const T&>())) Type;
+};
+
+template <typename F>
+struct FutureCallResult<void, F>
+{
+    typedef decltype(std::declval<F&>()()) Type;
+};
+
+// Continuations returning wxFuture<U> result in wxFuture<U> and not
+// wxFuture<wxFuture<U>>.
+template <typename R>
+struct FutureUnwrap
+{
+    typedef R Type;
+};
+
+template <typename U>
+struct FutureUnwrap< wxFuture<U> >
+{
+    typedef U Type;
+};
+
+template <typename T, typename F>
+struct FutureThenResult
+{
+    typedef wxFuture<
+        typename FutureUnwrap<typename FutureCallResult<T, F>::Type>::Type
+    > Type;
+};
+
+// Call the continuation with the value of the ready state.
+template <typename T>
+struct FutureInvoker
+{
+    template <typename F>
+    static auto Call(const wxFutureState<T>& state, F& func)
+        -> decltype(func(state.GetValue()))
+    {
+        return func(state.GetValue());
+    }
+};
+
+template <>
+struct FutureInvoker<void>
+{
+    template <typename F>
+    static auto Call(const wxFutureState<void>& WXUNUSED(state), F& func)
+        -> decltype(func())
+    {
+        return func();
+    }
+};
+
+// Set the value of the promise to the value of the ready state.
+template <typename T>
+inline void FutureTransfer(const wxFutureState<T>& state, wxPromise<T>& promise)
+{
+#if wxUSE_EXCEPTIONS
+    if ( state.HasException() )
+    {
+        promise.SetException(state.GetException());
+        return;
+    }
+#endif // wxUSE_EXCEPTIONS
+
+    promise.SetValue(state.GetValue());
+}
+
+inline void
+FutureTransfer(const wxFutureState<void>& state, wxPromise<void>& promise)
+{
+#if wxUSE_EXCEPTIONS
+    if ( state.HasException() )
+    {
+        promise.SetException(state.GetException());
+        return;
+    }
+#else // !wxUSE_EXCEPTIONS
+    wxUnusedVar(state);
+#endif // wxUSE_EXCEPTIONS/!wxUSE_EXCEPTIONS
+
+    promise.SetValue();
+}
+
+// Set the value of the promise to the result of calling the continuation.
+template <typename R>
+struct FutureFulfiller
+{
+    template <typename T, typename F>
+    static void Do(const wxFutureState<T>& state, F& func, wxPromise<R>& promise)
+    {
+        promise.SetValue(FutureInvoker<T>::Call(state, func));
+    }
+};
+
+template <>
+struct FutureFulfiller<void>
+{
+    template <typename T, typename F>
+    static void Do(const wxFutureState<T>& state, F& func, wxPromise<void>& promise)
+    {
+        FutureInvoker<T>::Call(state, func);
+        promise.SetValue();
+    }
+};
+
+template <typename U>
+struct FutureFulfiller< wxFuture<U> >
+{
+    template <typename T, typename F>
+    static void Do(const wxFutureState<T>& state, F& func, wxPromise<U>& promise)
+    {
+        const wxFuture<U> inner = FutureInvoker<T>::Call(state, func);
+        wxCHECK_RET( inner.IsValid(), "continuation returned invalid future" );
+
+        const std::shared_ptr< wxFutureState<U> > innerState = inner.GetState();
+        innerState->OnReady([innerState, promise]() mutable
+        {
+            FutureTransfer(*innerState, promise);
+        });
+    }
+};
+
+// Run the continuation once the state is ready, propagating its exception
+// to the promise without calling the continuation at all.
+template <typename R, typename T, typename F, typename P>
+void FutureContinue(const wxFutureState<T>& state, F& func, P& promise)
+{
+#if wxUSE_EXCEPTIONS
+    if ( state.HasException() )
+    {
+        promise.SetException(state.GetException());
+        return;
+    }
+
+    try
+#endif // wxUSE_EXCEPTIONS
+    {
+        FutureFulfiller<R>::Do(state, func, promise);
+    }
+#if wxUSE_EXCEPTIONS
+    catch ( ... )
+    {
+        promise.SetException(std::current_exception());
+    }
+#endif // wxUSE_EXCEPTIONS
+}
+
+// Call the given function once all the given futures become ready.
+template <typename T>
+void FutureOnAllReady(const std::vector< wxFuture<T> >& futures,
+                      const std::function<void ()>& func)
+{
+    if ( futures.empty() )
+    {
+        func();
+        return;
+    }
+
+    auto remaining = std::make_shared< std::atomic<size_t> >(futures.size());
+    for ( const auto& future : futures )
+    {
+        future.GetState()->OnReady([remaining, func]()
+        {
+            if ( --*remaining == 0 )
+                func();
+        });
+    }
+}
+
+} // namespace wxPrivate
+
+// ----------------------------------------------------------------------------
+// wxFuture: result of an asynchronous operation
+// ----------------------------------------------------------------------------
+
+template <typename T>
+class wxFutureBase
+{
+public:
+    // Default constructor creates an invalid future, only IsValid() can be
+    // called on it.
+    wxFutureBase() { }
+
+    bool IsValid() const { return m_state != nullptr; }
+
+    bool IsReady() const
+    {
+        wxCHECK_MSG( m_state, false, "invalid future" );
+
+        return m_state->IsReady();
+    }
+
+    // Block until the future becomes ready. Note that this must not be used
+    // in the main thread if the future is made ready by a continuation
+    // executed in the main thread too, as this would deadlock.
+    void Wait() const
+    {
+        wxCHECK_RET( m_state, "invalid future" );
+
+        m_state->Wait();
+    }
+
+    // Call the given function with the value of this future once it becomes
+    // ready and return the future for its result. If this future has an
+    // exception, the function is not called and the returned future gets the
+    // same exception. If the function returns a wxFuture<U> itself, the
+    // returned future is wxFuture<U> which becomes ready when the returned
+    // one does.
+    //
+    // This overload calls the function in the thread making this future
+    // ready, or immediately if it already is.
+    template <typename F>
+    typename wxPrivate::FutureThenResult<T, F>::Type Then(F func) const
+    {
+        return DoThen(std::move(func),
+                      [](const std::function<void ()>& run) { run(); });
+    }
+
+    // Call the function in the main thread using CallAfter(), but only if
+    // the given handler, which must be used in the main thread, still exists
+    // at that time. Otherwise the returned future becomes ready with the
+    // std::future_error exception.
+    template <typename F>
+    typename wxPrivate::FutureThenResult<T, F>::Type
+    Then(F func, wxEvtHandler* handler) const
+    {
+        wxCHECK_MSG( handler, (typename wxPrivate::FutureThenResult<T, F>::Type()),
+                     "null handler" );
+
+        const wxPrivate::FutureHandlerRef ref(handler);
+        return DoThen(std::move(func),
+                      [ref](const std::function<void ()>& run)
+                      {
+                          ref.CallAfter(run);
+                      });
+    }
+
+#if wxUSE_THREADS
+    // Call the function in one of the worker threads of the given pool.
+    template <typename F>
+    typename wxPrivate::FutureThenResult<T, F>::Type
+    Then(F func, wxThreadPool& pool) const
+    {
+        return DoThen(std::move(func),
+                      [&pool](const std::function<void ()>& run)
+                      {
+                          pool.Post(run);
+                      });
+    }
+#endif // wxUSE_THREADS
+
+
+    // Implementation only.
+    explicit wxFutureBase(const std::shared_ptr< wxFutureState<T> >& state)
+        : m_state(state)
+    {
+    }
+
+    const std::shared_ptr< wxFutureState<T> >& GetState() const
+    {
+        return m_state;
+    }
+
+protected:
+    // Wait until the future is ready and rethrow its exception, if any.
+    void WaitAndCheck() const
+    {
+        m_state->Wait();
+
+#if wxUSE_EXCEPTIONS
+        if ( m_state->HasException() )
+            std::rethrow_exception(m_state->GetException());
+#endif // wxUSE_EXCEPTIONS
+    }
+
+    std::shared_ptr< wxFutureState<T> > m_state;
+
+private:
+    template <typename F, typename S>
+    typename wxPrivate::FutureThenResult<T, F>::Type
+    DoThen(F func, S schedule) const
+    {
+        typedef typename wxPrivate::FutureCallResult<T, F>::Type R;
+        typedef typename wxPrivate::FutureUnwrap<R>::Type U;
+
+        wxCHECK_MSG( m_state, wxFuture<U>(), "invalid future" );
+
+        wxPromise<U> promise;
+        const wxFuture<U> result = promise.GetFuture();
+
+        const std::shared_ptr< wxFutureState<T> > state = m_state;
+        m_state->OnReady([state, func, promise, schedule]()
+        {
+            schedule([state, func, promise]() mutable
+            {
+                wxPrivate::FutureContinue<R>(*state, func, promise);
+            });
+        });
+
+        return result;
+    }
+};
+
+template <typename T>
+class wxFuture : public wxFutureBase<T>
+{
+public:
+    wxFuture() { }
+
+    explicit wxFuture(const std::shared_ptr< wxFutureState<T> >& state)
+        : wxFutureBase<T>(state)
+    {
+    }
+
+    // Wait until the future is ready and return its value or rethrow its
+    // exception.
+    const T& Get() const
+    {
+        this->WaitAndCheck();
+
+        return this->m_state->GetValue();
+    }
+
+    // Same as Get() but moves the value out of the future, which is useful
+    // for the move-only types. This can be called only once and neither this
+    // future nor any of its copies can be used to access the value after it.
+    T TakeValue()
+    {
+        this->WaitAndCheck();
+
+        return this->m_state->TakeValue();
+    }
+};
+
+template <>
+class wxFuture<void> : public wxFutureBase<void>
+{
+public:
+    wxFuture() { }
+
+    explicit wxFuture(const std::shared_ptr< wxFutureState<void> >& state)
+        : wxFutureBase<void>(state)
+    {
+    }
+
+    void Get() const
+    {
+        WaitAndCheck();
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Functions creating and combining the futures
+// ----------------------------------------------------------------------------
+
+template <typename T>
+inline wxFuture<typename std::decay<T>::type> wxMakeReadyFuture(T&& value)
+{
+    wxPromise<typename std::decay<T>::type> promise;
+    promise.SetValue(std::forward<T>(value));
+    return promise.GetFuture();
+}
+
+inline wxFuture<void> wxMakeReadyFuture()
+{
+    wxPromise<void> promise;
+    promise.SetValue();
+    return promise.GetFuture();
+}
+
+#if wxUSE_THREADS
+
+// Call the function in the given pool and return the future for its result.
+template <typename F>
+inline typename wxPrivate::FutureThenResult<void, F>::Type
+wxRunAsync(F func, wxThreadPool& pool = wxThreadPool::GetDefault())
+{
+    return wxMakeReadyFuture().Then(std::move(func), pool);
+}
+
+#endif // wxUSE_THREADS
+
+// Return the future which becomes ready when all the given futures are, with
+// the vector of their values or the exception of the first one of them
+// which has it.
+template <typename T>
+wxFuture< std::vector<T> > wxWhenAll(const std::vector< wxFuture<T> >& futures)
+{
+    for ( const auto& future : futures )
+    {
+        wxCHECK_MSG( future.IsValid(), wxFuture< std::vector<T> >(),
+                     "invalid future" );
+    }
+
+    wxPromise< std::vector<T> > promise;
+    const wxFuture< std::vector<T> > result = promise.GetFuture();
+
+    wxPrivate::FutureOnAllReady(futures, [futures, promise]() mutable
+    {
+        std::vector<T> values;
+        values.reserve(futures.size());
+        for ( const auto& future : futures )
+        {
+            const wxFutureState<T>& state = *future.GetState();
+
+#if wxUSE_EXCEPTIONS
+            if ( state.HasException() )
+            {
+                promise.SetException(state.GetException());
+                return;
+            }
+#endif // wxUSE_EXCEPTIONS
+
+            values.push_back(state.GetValue());
+        }
+
+        promise.SetValue(std::move(values));
+    });
+
+    return result;
+}
+
+inline wxFuture<void> wxWhenAll(const std::vector< wxFuture<void> >& futures)
+{
+    for ( const auto& future : futures )
+    {
+        wxCHECK_MSG( future.IsValid(), wxFuture<void>(), "invalid future" );
+    }
+
+    wxPromise<void> promise;
+    const wxFuture<void> result = promise.GetFuture();
+
+    wxPrivate::FutureOnAllReady(futures, [futures, promise]() mutable
+    {
+#if wxUSE_EXCEPTIONS
+        for ( const auto& future : futures )
+        {
+            if ( future.GetState()->HasException() )
+            {
+                promise.SetException(future.GetState()->GetException());
+                return;
+            }
+        }
+#endif // wxUSE_EXCEPTIONS
+
+        promise.SetValue();
+    });
+
+    return result;
+}
+
+// Return the future which becomes ready when any of the given futures is,
+// with the index of the first ready one.
+template <typename T>
+wxFuture<size_t> wxWhenAny(const std::vector< wxFuture<T> >& futures)
+{
+    wxCHECK_MSG( !futures.empty(), wxFuture<size_t>(), "no futures" );
+
+    for ( const auto& future : futures )
+    {
+        wxCHECK_MSG( future.IsValid(), wxFuture<size_t>(), "invalid future" );
+    }
+
+    wxPromise<size_t> promise;
+    const wxFuture<size_t> result = promise.GetFuture();
+
+    auto done = std::make_shared< std::atomic<bool> >(false);
+    for ( size_t n = 0; n < futures.size(); n++ )
+    {
+        futures[n].GetState()->OnReady([n, done, promise]() mutable
+        {
+            if ( !done->exchange(true) )
+                promise.SetValue(n);
+        });
+    }
+
+    return result;
+}
+
+#endif // _WX_FUTURE_H_
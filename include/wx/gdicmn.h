@@ -944,13 +944,43 @@ inline void wxSize::DecBy(const wxPoint& pt) { DecBy(pt.x, pt.y); }
 
 typedef wxInt8 wxDash;
 
+class wxGDIObjListImpl;
+
 class WXDLLIMPEXP_CORE wxGDIObjListBase {
 public:
     wxGDIObjListBase();
     ~wxGDIObjListBase();
 
+    // Limit the number of objects in the list: when it is exceeded, the least
+    // recently used objects are deleted, invalidating any pointers to them, so
+    // this must not be used if such pointers are kept. The default value of 0
+    // means that there is no limit and objects are only deleted when the list
+    // itself is.
+    void SetMaxCount(size_t maxCount);
+    size_t GetMaxCount() const;
+
+    // Return the number of objects currently in the list.
+    size_t GetCount() const;
+
 protected:
-    wxList list;
+    // Function checking if the given object matches the search criteria.
+    typedef bool (*MatchFunc)(const wxObject* obj, const void* data);
+
+    // Find the object with the given hash satisfying the match function.
+    wxObject* Find(size_t hash, MatchFunc match, const void* data);
+
+    // Find the first object satisfying the match function, this is slower
+    // than Find() and only needs to be used if the hash of the object to find
+    // can't be computed.
+    wxObject* FindAny(MatchFunc match, const void* data);
+
+    // Add a new object with the given hash, the list takes ownership of it.
+    void Add(wxObject* obj, size_t hash);
+
+private:
+    wxGDIObjListImpl* const m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxGDIObjListBase);
 };
 
 class wxStringToColourHashMap;
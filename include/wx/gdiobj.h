@@ -21,15 +21,26 @@
 class WXDLLIMPEXP_CORE wxGDIRefData : public wxObjectRefData
 {
 public:
-    // Default ctor which needs to be defined just because we use
-    // wxDECLARE_NO_COPY_CLASS() below.
-    wxGDIRefData() = default;
+    wxGDIRefData() : m_serial(GetNextSerial()) { }
 
     // override this in the derived classes to check if this data object is
     // really fully initialized
     virtual bool IsOk() const { return true; }
 
+    // return the number identifying the contents of this object: it is
+    // different for all data objects and changes when the owning wxGDIObject
+    // modifies it, which allows to detect changes to the data, e.g. for
+    // caching something computed from it
+    unsigned long GetSerial() const { return m_serial; }
+
+    // indicate that the data is about to be modified
+    void UpdateSerial() { m_serial = GetNextSerial(); }
+
 private:
+    static unsigned long GetNextSerial();
+
+    unsigned long m_serial;
+
     wxDECLARE_NO_COPY_CLASS(wxGDIRefData);
 };
 
@@ -55,6 +66,10 @@ public:
     // because it's still widely used)
     bool Ok() const { return IsOk(); }
 
+    // make sure this object doesn't share its data with any others, as
+    // wxObject::UnShare(), but also mark the data as modified
+    void UnShare() { AllocExclusive(); }
+
 #if defined(__WXMSW__)
     // Creates the resource
     virtual bool RealizeResource() { return false; }
@@ -69,6 +84,14 @@ public:
 #endif // defined(__WXMSW__)
 
 protected:
+    // hide wxObject function to also update the serial number of the data,
+    // as all the derived classes call it before modifying their data
+    void AllocExclusive()
+    {
+        wxObject::AllocExclusive();
+        static_cast<wxGDIRefData *>(m_refData)->UpdateSerial();
+    }
+
     // replace base class functions using wxObjectRefData with our own which
     // use wxGDIRefData to ensure that we always work with data objects of the
     // correct type (i.e. derived from wxGDIRefData)
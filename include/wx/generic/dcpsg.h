@@ -20,6 +20,16 @@
 #include "wx/cmndata.h"
 #include "wx/strvararg.h"
 
+class WXDLLIMPEXP_FWD_CORE wxImage;
+
+// Compression used for the bitmaps embedded into the PostScript output.
+enum wxPostScriptImageCompression
+{
+    wxPS_IMAGE_COMPRESSION_NONE,    // ASCII hex data, PostScript Level 1
+    wxPS_IMAGE_COMPRESSION_RLE,     // RunLengthDecode filter, Level 2
+    wxPS_IMAGE_COMPRESSION_FLATE    // FlateDecode filter, Level 3
+};
+
 //-----------------------------------------------------------------------------
 // wxPostScriptDC
 //-----------------------------------------------------------------------------
@@ -33,6 +43,11 @@ public:
     // Recommended constructor
     wxPostScriptDC(const wxPrintData& printData);
 
+    // Choose the compression used for the bitmaps, this should be called
+    // before StartDoc() to ensure that the right language level is declared.
+    void SetImageCompression(wxPostScriptImageCompression compression);
+    wxPostScriptImageCompression GetImageCompression() const;
+
 private:
     wxDECLARE_DYNAMIC_CLASS(wxPostScriptDC);
 };
@@ -93,6 +108,20 @@ public:
 
     void PsPrint( const wxString& psdata );
 
+    // Output raw data: this is more efficient than PsPrint() as it doesn't
+    // involve any conversions and the data is only buffered internally, call
+    // PsFlush() to really write it to the output.
+    void PsWrite( const char* data, size_t len );
+    void PsFlush();
+
+    // Write the data to the output immediately, bypassing the buffer.
+    void PsDoWrite( const char* data, size_t len );
+
+    void SetImageCompression(wxPostScriptImageCompression compression)
+        { m_imageCompression = compression; }
+    wxPostScriptImageCompression GetImageCompression() const
+        { return m_imageCompression; }
+
     // Overridden for wxPrinterDC Impl
 
     virtual int GetResolution() const override;
@@ -148,6 +177,9 @@ protected:
     void SetPSFont();
     // Set PostScript color
     void SetPSColour(const wxColour& col);
+    // Output the image data compressed using m_imageCompression, which must
+    // not be wxPS_IMAGE_COMPRESSION_NONE.
+    void DrawCompressedImage(const wxImage& image);
 
     FILE*             m_pstream;    // PostScript output stream
     unsigned char     m_currentRed;
@@ -161,6 +193,8 @@ protected:
     double            m_pageHeight;
     wxArrayString     m_definedPSFonts;
     bool              m_isFontChanged;
+    wxPostScriptImageCompression m_imageCompression;
+    wxMemoryBuffer    m_outputBuffer;
 
 private:
     wxDECLARE_DYNAMIC_CLASS(wxPostScriptDCImpl);
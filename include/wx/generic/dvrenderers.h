@@ -86,6 +86,9 @@ private:
     class wxItemMarkupText *m_markupText;
 #endif // wxUSE_MARKUP
 
+    // Used for measuring the texts of many items at once.
+    friend class wxDataViewMaxWidthCalculator;
+
     wxDECLARE_DYNAMIC_CLASS_NO_COPY(wxDataViewTextRenderer);
 };
 
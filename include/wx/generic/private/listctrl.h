@@ -699,6 +699,9 @@ public:
     void InsertItem( wxListItem &item );
     long InsertColumn( long col, const wxListItem &item );
     int GetItemWidthWithImage(wxListItem * item);
+
+    // Return the width taken by the item image, if any, without its text.
+    int GetItemImageWidth(const wxListItem& item) const;
     void SortItems( wxListCtrlCompare fn, wxIntPtr data );
 
     size_t GetItemCount() const;
@@ -14,7 +14,7 @@
 // wxTextMeasure for the platforms without native support.
 // ----------------------------------------------------------------------------
 
-class wxTextMeasure : public wxTextMeasureBase
+class WXDLLIMPEXP_CORE wxTextMeasure : public wxTextMeasureBase
 {
 public:
     explicit wxTextMeasure(const wxDC *dc, const wxFont *font = nullptr)
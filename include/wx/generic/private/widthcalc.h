@@ -109,8 +109,17 @@ public:
                        last_visible - first_visible,
                        count);
         }
+
+        FlushPendingRows();
     }
 
+protected:
+    // Derived classes may postpone measuring the rows passed to UpdateWithRow()
+    // to do it for several rows at once, which is usually much faster, in
+    // which case they must override this function to measure the remaining
+    // rows: it is called at the end of ComputeBestColumnWidth().
+    virtual void FlushPendingRows() { }
+
 private:
     const size_t m_column;
     int m_width;
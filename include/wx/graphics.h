@@ -254,6 +254,16 @@ public:
     // applies the matrix except for translations
     virtual void TransformDistance( wxDouble *dx, wxDouble *dy ) const;
 
+    // applies the matrix to n points, "in" and "out" may be the same array
+    void TransformPoints(const wxPoint2DDouble* in,
+                         wxPoint2DDouble* out,
+                         size_t n) const;
+
+    // computes the bounding boxes of n transformed rectangles
+    void TransformRects(const wxRect2DDouble* in,
+                        wxRect2DDouble* out,
+                        size_t n) const;
+
     // returns the native representation
     virtual void * GetNativeMatrix() const;
 
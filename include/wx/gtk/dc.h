@@ -63,6 +63,7 @@ class wxClientDCImpl: public wxGTKCairoDCImpl
 {
 public:
     wxClientDCImpl(wxClientDC* owner, wxWindow* window);
+    virtual ~wxClientDCImpl();
 
     static bool CanBeUsedForDrawing(const wxWindow* window);
 
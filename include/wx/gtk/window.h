@@ -13,6 +13,7 @@
 
 #ifdef __WXGTK3__
     typedef struct _cairo cairo_t;
+    typedef struct _cairo_surface cairo_surface_t;
     typedef struct _GtkStyleProvider GtkStyleProvider;
     typedef struct _GtkCssProvider GtkCssProvider;
     #define WXUNUSED_IN_GTK2(x) x
@@ -131,6 +132,10 @@ public:
     virtual void SetDoubleBuffered(bool on) override;
     virtual bool IsDoubleBuffered() const override;
 
+#ifdef __WXGTK3__
+    virtual bool EnableScrollBackingStore(bool enable = true) override;
+#endif
+
     // SetLabel(), which does nothing in wxWindow
     virtual void SetLabel(const wxString& label) override { m_gtkLabel = label; }
     virtual wxString GetLabel() const override            { return m_gtkLabel; }
@@ -484,11 +489,38 @@ private:
     // style provider for "background-image"
     GtkStyleProvider* m_styleProvider;
 
+    // backing store containing the window contents if it's enabled by
+    // EnableScrollBackingStore(), allowing to scroll the window without
+    // repainting all of it, and the part of it which must be repainted
+    cairo_surface_t* m_scrollBacking;
+    wxSize m_scrollBackingSize;
+    wxRegion m_scrollBackingInvalid;
+    bool m_useScrollBacking;
+    // true if the window was scrolled since it was painted the last time: the
+    // areas exposed by GTK are only known to be still valid in the backing
+    // store in this case, any other exposures are repainted
+    bool m_scrollBackingScrolled;
+
+    // prepare the backing store for painting the area exposed in the given
+    // window context, returns the context to use for painting or nullptr if
+    // nothing needs to be repainted
+    cairo_t* GTKBeginScrollBackingPaint(cairo_t* crWindow);
+
+    // copy the backing store to the window after painting it using the
+    // context returned by GTKBeginScrollBackingPaint(), which is destroyed
+    void GTKEndScrollBackingPaint(cairo_t* crWindow, cairo_t* cr);
+
+    // move the contents of the backing store when scrolling the window
+    void GTKScrollBacking(int dx, int dy);
+
 public:
     cairo_t* GTKPaintContext() const
     {
         return m_paintContext;
     }
+    // mark the given rectangle, in client coordinates, or the entire window
+    // if it's null, as needing to be repainted in the backing store, if any
+    void GTKInvalidateScrollBacking(const wxRect* rect = nullptr);
     void GTKSizeRevalidate();
     void GTKSendSizeEventIfNeeded();
 #endif
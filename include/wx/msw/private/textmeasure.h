@@ -16,7 +16,7 @@
 // wxTextMeasure for MSW.
 // ----------------------------------------------------------------------------
 
-class wxTextMeasure : public wxTextMeasureBase
+class WXDLLIMPEXP_CORE wxTextMeasure : public wxTextMeasureBase
 {
 public:
     explicit wxTextMeasure(const wxDC *dc, const wxFont *font = nullptr)
@@ -19,6 +19,7 @@
 // ----------------------------------------------------------------------------
 
 class WXDLLIMPEXP_FWD_CORE wxDC;
+class WXDLLIMPEXP_FWD_CORE wxRect;
 
 class WXDLLIMPEXP_CORE wxOverlay
 {
@@ -36,6 +37,11 @@ public:
 
     void SetOpacity(int alpha);
 
+    // declares that the next frame, i.e. the drawing done using the next
+    // wxDCOverlay, will only draw inside the given rectangle, which allows
+    // the generic implementation to save and restore only this area
+    void SetNextFrameArea(const wxRect& rect);
+
 private:
     friend class WXDLLIMPEXP_FWD_CORE wxDCOverlay;
 
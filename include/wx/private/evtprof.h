@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/evtprof.h
+// Purpose:     Helper for measuring the event handlers calls
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_EVTPROF_H_
+#define _WX_PRIVATE_EVTPROF_H_
+
+#include "wx/evtprof.h"
+
+#if wxUSE_EVENT_PROFILER
+
+#include <typeinfo>
+
+// ----------------------------------------------------------------------------
+// wxEventProfilerCall: measures a single call of an event handler
+// ----------------------------------------------------------------------------
+
+// Objects of this class must only be created if wxEventProfiler::IsEnabled()
+// returns true and the call is recorded when they're destroyed.
+class wxEventProfilerCall
+{
+public:
+    // Profile calling the given functor for the event.
+    wxEventProfilerCall(wxEvtHandler* handler,
+                        const wxEventFunctor& functor,
+                        const wxEvent& event);
+
+    // Profile calling the function of the given type without any functor,
+    // this is used for the async method calls which are executed directly.
+    wxEventProfilerCall(wxEvtHandler* handler,
+                        const std::type_info& func,
+                        const wxEvent& event);
+
+    ~wxEventProfilerCall();
+
+private:
+    void Start();
+
+    // Note that we can't keep the pointer to the handler because it could be
+    // deleted by the handler function itself.
+    const std::type_info& m_handlerType;
+    const std::type_info& m_func;
+    const std::type_info& m_eventClass;
+    const wxEventType m_eventType;
+
+    // The method called by the functor, if any.
+    const wxEventFunction m_method = nullptr;
+
+    // Nesting level of this call and its start time in nanoseconds.
+    int m_depth = 0;
+    wxLongLong_t m_start = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxEventProfilerCall);
+};
+
+#endif // wxUSE_EVENT_PROFILER
+
+#endif // _WX_PRIVATE_EVTPROF_H_
@@ -39,6 +39,7 @@ public:
     virtual void Clear(wxDC* dc) = 0;
     virtual void Reset() = 0;
     virtual void SetOpacity(int WXUNUSED(alpha)) { }
+    virtual void SetNextFrameArea(const wxRect& WXUNUSED(rect)) { }
 };
 
 #endif // _WX_PRIVATE_OVERLAY_H_
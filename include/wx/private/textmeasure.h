@@ -18,7 +18,7 @@ class WXDLLIMPEXP_FWD_CORE wxWindow;
 // wxTextMeasure: class used to measure text extent.
 // ----------------------------------------------------------------------------
 
-class wxTextMeasureBase
+class WXDLLIMPEXP_CORE wxTextMeasureBase
 {
 public:
     // The first ctor argument must be non-null, i.e. each object of this class
@@ -52,6 +52,14 @@ public:
         return GetLargestStringExtent(strings.size(), &strings[0]);
     }
 
+    // Get the extents of all the given, possibly multiline, strings at once,
+    // which is much faster than calling GetMultiLineTextExtent() for each of
+    // them. The sizes array must have at least strings.size() elements.
+    void GetTextExtents(const wxArrayString& strings, wxSize* sizes);
+
+    // Return the width of the widest of the given, possibly multiline, strings.
+    int GetMaxTextWidth(const wxArrayString& strings);
+
     // Fill the array with the widths for each "0..N" substrings for N from 1
     // to text.length().
     //
@@ -132,6 +140,13 @@ protected:
     // would just return (0, 0) in this case.
     int GetEmptyLineHeight();
 
+    // The implementation of GetMultiLineTextExtent(), which must be called
+    // while measuring, i.e. with a MeasuringGuard.
+    void DoGetMultiLineTextExtent(const wxString& text,
+                                  wxCoord *width,
+                                  wxCoord *height,
+                                  wxCoord *heightOneLine);
+
     // Return a valid font: if one was given to us in the ctor, use this one,
     // otherwise use the current font of the associated wxDC or wxWindow.
     wxFont GetFont() const;
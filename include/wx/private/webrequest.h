@@ -11,6 +11,7 @@
 #define _WX_PRIVATE_WEBREQUEST_H_
 
 #include "wx/ffile.h"
+#include "wx/future.h"
 
 #include "wx/private/refcountermt.h"
 
@@ -107,6 +108,10 @@ public:
 
     wxEvtHandler* GetHandler() const { return m_handler; }
 
+    // Return the future made ready by ProcessStateEvent() when the request
+    // terminates.
+    wxFuture<wxWebRequestEvent> GetFuture();
+
 protected:
     wxString m_method;
     wxWebRequest::Storage m_storage;
@@ -148,6 +153,10 @@ private:
     // Initially false, set to true after the first call to Cancel().
     bool m_cancelled;
 
+    // Only created if GetFuture() is called, fulfilled when the request
+    // terminates, but not when it becomes unauthorized.
+    std::unique_ptr< wxPromise<wxWebRequestEvent> > m_promise;
+
     wxDECLARE_NO_COPY_CLASS(wxWebRequestImpl);
 };
 
@@ -17,6 +17,7 @@
     #include "wx/stream.h"
 #endif
 
+#include "wx/future.h"
 #include "wx/utils.h"       // for wxSignal
 
 // the wxProcess creation flags
@@ -190,4 +191,15 @@ typedef void (wxEvtHandler::*wxProcessEventFunction)(wxProcessEvent&);
 #define EVT_END_PROCESS(id, func) \
    wx__DECLARE_EVT1(wxEVT_END_PROCESS, id, wxProcessEventHandler(func))
 
+// ----------------------------------------------------------------------------
+// wxExecuteAsync: launch a process and get the future for its exit code
+// ----------------------------------------------------------------------------
+
+// The returned future becomes ready, in the main thread, with the exit code of
+// the process when it terminates or with -1 if it couldn't be launched.
+WXDLLIMPEXP_BASE wxFuture<int>
+wxExecuteAsync(const wxString& command,
+               int flags = wxEXEC_ASYNC,
+               const wxExecuteEnv *env = nullptr);
+
 #endif // _WX_PROCESSH__
@@ -23,6 +23,7 @@
 
 class WXDLLIMPEXP_FWD_CORE wxDC;
 class WXDLLIMPEXP_FWD_CORE wxWindow;
+class WXDLLIMPEXP_FWD_RIBBON wxRibbonGradientCache;
 
 enum wxRibbonArtSetting
 {
@@ -773,6 +774,9 @@ protected:
     double m_cached_tab_separator_visibility;
     long m_flags;
 
+    // Cache of the gradient bitmaps used for drawing the backgrounds.
+    wxRibbonGradientCache* m_gradient_cache;
+
     int m_tab_separation_size;
     int m_page_border_left;
     int m_page_border_top;
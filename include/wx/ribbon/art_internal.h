@@ -14,6 +14,14 @@
 
 #if wxUSE_RIBBON
 
+#include "wx/bitmap.h"
+#include "wx/colour.h"
+#include "wx/gdicmn.h"
+
+#include <map>
+
+class WXDLLIMPEXP_FWD_CORE wxDC;
+
 WXDLLIMPEXP_RIBBON wxColour wxRibbonInterpolateColour(
                                 const wxColour& start_colour,
                                 const wxColour& end_colour,
@@ -75,6 +83,75 @@ public:
 WXDLLIMPEXP_RIBBON wxRibbonHSLColour wxRibbonShiftLuminance(
                                 wxRibbonHSLColour colour, float amount);
 
+/*
+   Cache of the bitmaps with pre-rendered gradients used by the art providers
+   for filling the backgrounds of the ribbon elements.
+
+   Linear gradient only changes along its direction, so a strip of it can be
+   repeated in the other direction to fill a rectangle of any size and only the
+   length of the gradient needs to be a part of the cache key, together with
+   its colours and the DPI scale factor of the DC it is drawn on. This means
+   that all elements of the same height, e.g. all buttons in a button bar,
+   share the same cache entry. The strip is made as wide as the widest
+   rectangle filled with it, up to a limit, so that filling it requires a
+   single blit and, as its width is rounded up to a power of 2, it only needs
+   to be redrawn a few times when the elements are resized in the direction
+   perpendicular to the gradient.
+*/
+class WXDLLIMPEXP_RIBBON wxRibbonGradientCache
+{
+public:
+    wxRibbonGradientCache() = default;
+
+    // Same as wxDC::GradientFillLinear(), but using the cached bitmap.
+    void GradientFillLinear(wxDC& dc,
+                            const wxRect& rect,
+                            const wxColour& start_colour,
+                            const wxColour& end_colour,
+                            wxDirection direction = wxSOUTH);
+
+    // Fill the rectangle with the part of the vertical gradient going from
+    // start_colour at start_position to end_colour at end_position, where the
+    // positions are in the same coordinates as rect. This is used for drawing
+    // the parts of the backgrounds spanning several windows.
+    void GradientFillPartial(wxDC& dc,
+                             const wxRect& rect,
+                             const wxColour& start_colour,
+                             const wxColour& end_colour,
+                             int start_position,
+                             int end_position);
+
+    // Remove all the cached bitmaps, e.g. when the colour scheme changes.
+    void Clear() { m_bitmaps.clear(); }
+
+private:
+    struct Key
+    {
+        wxUint32 start_colour;
+        wxUint32 end_colour;
+        int direction;
+        int length;
+        double scale;
+
+        bool operator<(const Key& other) const;
+    };
+
+    // Return the bitmap with the gradient of the given length and at least
+    // the given width, unless it exceeds the maximal width of the cached
+    // bitmaps, creating it if necessary, or an invalid bitmap if it can't be
+    // used with this DC.
+    wxBitmap GetBitmap(wxDC& dc,
+                       const wxColour& start_colour,
+                       const wxColour& end_colour,
+                       wxDirection direction,
+                       int length,
+                       int width);
+
+    std::map<Key, wxBitmap> m_bitmaps;
+
+    wxDECLARE_NO_COPY_CLASS(wxRibbonGradientCache);
+};
+
 #endif // wxUSE_RIBBON
 
 #endif // _WX_RIBBON_ART_INTERNAL_H_
@@ -0,0 +1,188 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/threadpool.h
+// Purpose:     wxThreadPool and wxTaskGroup classes for running tasks
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_THREADPOOL_H_
+#define _WX_THREADPOOL_H_
+
+#include "wx/thread.h"
+
+#if wxUSE_THREADS
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <utility>
+
+class WXDLLIMPEXP_FWD_BASE wxEvtHandler;
+class wxThreadPoolImpl;
+class wxTaskGroupState;
+
+// ----------------------------------------------------------------------------
+// wxCancellationToken: allows cancelling the tasks which check it
+// ----------------------------------------------------------------------------
+
+// All copies of the token share the same state, so cancelling any of them
+// cancels all the others too.
+class wxCancellationToken
+{
+public:
+    wxCancellationToken()
+        : m_cancelled(std::make_shared<std::atomic<bool>>(false))
+    {
+    }
+
+    void Cancel() { m_cancelled->store(true); }
+    bool IsCancelled() const { return m_cancelled->load(); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> m_cancelled;
+};
+
+// ----------------------------------------------------------------------------
+// wxThreadPool: a fixed number of worker threads executing the tasks
+// ----------------------------------------------------------------------------
+
+// Each worker thread has its own queue of tasks: the tasks created by the
+// task running in a worker are added to its queue and executed in LIFO order
+// by it, while the idle workers steal the oldest tasks from the other ones.
+class WXDLLIMPEXP_BASE wxThreadPool
+{
+public:
+    typedef std::function<void ()> Task;
+
+    // Create the pool with the given number of worker threads, by default the
+    // number of CPUs.
+    explicit wxThreadPool(int numWorkers = -1);
+
+    // Wait for all the tasks already submitted to complete and stop the
+    // worker threads.
+    ~wxThreadPool();
+
+    // Return the pool shared by the entire application, which is created
+    // when this function is called for the first time. It must not be called
+    // after the library shutdown, when this pool is destroyed.
+    static wxThreadPool& GetDefault();
+
+    int GetWorkerCount() const;
+
+    // Return true if called from one of the worker threads of this pool.
+    bool IsWorkerThread() const;
+
+
+    // Execute the given task asynchronously, without any way to know when it
+    // is done (but see wxTaskGroup).
+    void Post(Task task);
+
+    // Execute the given callable asynchronously and return the future that
+    // can be used to retrieve its result or the exception thrown by it.
+    template <typename F>
+    auto Submit(F&& func) -> std::future<decltype(func())>
+    {
+        typedef decltype(func()) R;
+
+        auto task = std::make_shared< std::packaged_task<R ()> >
+                    (
+                        std::forward<F>(func)
+                    );
+
+        std::future<R> future = task->get_future();
+        Post([task]() { (*task)(); });
+
+        return future;
+    }
+
+    // Call func(i) for all i in [begin, end) range in parallel, splitting it
+    // in chunks of the given size (if it is 0, it is chosen automatically).
+    //
+    // This function blocks until all the calls complete, and the calling
+    // thread participates in the work too. If the token is cancelled, the
+    // remaining chunks are skipped. If any call throws, the exception is
+    // rethrown from this function after waiting for the other chunks.
+    template <typename F>
+    void ParallelFor(size_t begin, size_t end, size_t grain, const F& func,
+                     const wxCancellationToken& token = wxCancellationToken())
+    {
+        DoParallelFor(begin, end, grain,
+                      [&func](size_t first, size_t last)
+                      {
+                          for ( size_t i = first; i < last; i++ )
+                              func(i);
+                      },
+                      token);
+    }
+
+
+    // Execute one of the pending tasks in the current thread, if there are
+    // any, and return true, or just return false if there are none.
+    bool RunPendingTask();
+
+private:
+    void DoParallelFor(size_t begin, size_t end, size_t grain,
+                       const std::function<void (size_t, size_t)>& func,
+                       const wxCancellationToken& token);
+
+    wxThreadPoolImpl* const m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadPool);
+};
+
+// ----------------------------------------------------------------------------
+// wxTaskGroup: allows waiting for completion of several tasks
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxTaskGroup
+{
+public:
+    explicit wxTaskGroup(wxThreadPool& pool = wxThreadPool::GetDefault());
+
+    // Note that the destructor doesn't wait for the tasks to complete, call
+    // Wait() explicitly if necessary.
+    ~wxTaskGroup();
+
+    // Execute the task in the pool as part of this group. The task is skipped
+    // if the group is cancelled before it starts.
+    void Run(wxThreadPool::Task task);
+
+    // Wait for all the tasks of the group to complete, executing the tasks of
+    // this group which haven't started yet in the calling thread while
+    // waiting. If any of the tasks threw an exception, the first one of them
+    // is rethrown from here.
+    void Wait();
+
+    // Return true if all the tasks of the group have completed.
+    bool IsDone() const;
+
+    // Cancel the tasks which haven't started yet, the running tasks can check
+    // IsCancelled() or the token to stop early.
+    void Cancel();
+    bool IsCancelled() const;
+    wxCancellationToken GetCancellationToken() const;
+
+    // Call the given function in the main thread, using CallAfter() on
+    // wxTheApp, once all the tasks of the group complete. If they have already
+    // completed, it is called during the next event loop iteration. If the
+    // handler is specified, the function is not called if it is destroyed
+    // before this happens. This function must be called from the main thread.
+    void ContinueWith(const std::function<void ()>& func,
+                      wxEvtHandler* handler = nullptr);
+
+private:
+    wxThreadPool& m_pool;
+
+    // The state is shared with the tasks and so remains alive until all of
+    // them complete, even if this object is destroyed.
+    std::shared_ptr<wxTaskGroupState> m_state;
+
+    wxDECLARE_NO_COPY_CLASS(wxTaskGroup);
+};
+
+#endif // wxUSE_THREADS
+
+#endif // _WX_THREADPOOL_H_
@@ -442,6 +442,15 @@
 // Recommended setting: 1
 #define wxUSE_STOPWATCH     1
 
+// Use wxEventProfiler class measuring the time taken by the event handlers.
+//
+// Default is 1
+//
+// Recommended setting: 1, the cost of checking whether the profiler is
+// enabled when calling the event handlers is negligible, but you can set it
+// to 0 to avoid it completely.
+#define wxUSE_EVENT_PROFILER 1
+
 // Set wxUSE_FSWATCHER to 1 if you want to enable wxFileSystemWatcher
 //
 // Default is 1
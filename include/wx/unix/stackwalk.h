@@ -85,6 +85,10 @@ public:
     void ProcessFrames(size_t skip);
     void FreeStack();
 
+    // process the frames at the addresses returned by backtrace() called
+    // elsewhere, e.g. in another thread
+    void ProcessAddresses(void* const* addresses, size_t count);
+
 private:
     int InitFrames(wxStackFrame *arr, size_t n, void **addresses, char **syminfo);
 
@@ -37,12 +37,14 @@ private:
 #if wxUSE_WEBREQUEST
 
 #include "wx/event.h"
+#include "wx/future.h"
 #include "wx/object.h"
 #include "wx/stream.h"
 #include "wx/versioninfo.h"
 
 class wxWebResponse;
 class wxWebSession;
+class WXDLLIMPEXP_FWD_NET wxWebRequestEvent;
 class wxWebSessionFactory;
 
 typedef struct wxWebRequestHandleOpaque* wxWebRequestHandle;
@@ -170,6 +172,11 @@ public:
 
     void Start();
 
+    // Start the request and return the future which becomes ready with the
+    // final state event once the request completes, fails or is cancelled,
+    // but not when it becomes unauthorized as it may still continue then.
+    wxFuture<wxWebRequestEvent> StartAsync();
+
     void Cancel();
 
     wxWebResponse GetResponse() const;
@@ -1151,6 +1151,12 @@ public:
         // return true if the window contents is double buffered by the system
     virtual bool IsDoubleBuffered() const { return false; }
 
+        // enable or disable keeping the window contents in a backing store
+        // which is moved by ScrollWindow() instead of repainting the window,
+        // return false if not supported by the current platform
+    virtual bool EnableScrollBackingStore(bool WXUNUSED(enable) = true)
+        { return false; }
+
         // the update region of the window contains the areas which must be
         // repainted by the program
     const wxRegion& GetUpdateRegion() const { return m_updateRegion; }
@@ -1342,6 +1348,16 @@ public:
     // do the window-specific processing after processing the update event
     virtual void DoUpdateWindowUI(wxUpdateUIEvent& event) ;
 
+    // register this window to receive wxUpdateUIEvents in
+    // wxUPDATE_UI_PROCESS_REGISTERED mode or unregister it
+    void RegisterForUpdateUI(bool registerWindow = true);
+    bool IsRegisteredForUpdateUI() const { return m_registeredForUpdateUI; }
+
+    // send wxUpdateUIEvents to all the registered windows, this is done
+    // automatically during idle time after wxUpdateUIEvent::RequestUpdate()
+    // call when using wxUPDATE_UI_PROCESS_REGISTERED mode
+    static void UpdateRegisteredWindowsUI();
+
 #if wxUSE_MENUS
     // show popup menu at the given position, generate events for the items
     // selected in it
@@ -1811,6 +1827,13 @@ protected:
     bool                 m_isEnabled:1;
     bool                 m_isBeingDeleted:1;
 
+    // was RegisterForUpdateUI() called for this window?
+    bool                 m_registeredForUpdateUI:1;
+
+    // were the event handlers of this window checked for the idle event
+    // handlers in wxIDLE_PROCESS_SUBSCRIBED mode?
+    bool                 m_idleHandlersChecked:1;
+
     // was the window colours/font explicitly changed by user?
     bool                 m_hasBgCol:1;
     bool                 m_hasFgCol:1;
@@ -188,4 +188,45 @@ public:
     */
     wxPoint2DDouble TransformDistance(const wxPoint2DDouble& p) const;
     void TransformDistance(wxDouble* dx, wxDouble* dy) const;
+
+    /**
+        Applies this matrix to an array of points.
+
+        This is equivalent to calling TransformPoint() for each of them, but
+        is more efficient when transforming many points.
+
+        @param in
+            The array of @a n points to transform.
+        @param out
+            The array of @a n points receiving the result, it may be the
+            same as @a in to transform the points in place.
+        @param n
+            The number of points.
+
+        @since 3.3.0
+    */
+    void TransformPoints(const wxPoint2DDouble* in,
+                         wxPoint2DDouble* out,
+                         size_t n) const;
+
+    /**
+        Computes the bounding boxes of an array of transformed rectangles.
+
+        Each output rectangle is the smallest axis-aligned rectangle
+        containing the corresponding input rectangle transformed by this
+        matrix, e.g. when it includes a rotation.
+
+        @param in
+            The array of @a n rectangles to transform.
+        @param out
+            The array of @a n rectangles receiving the result, it may be the
+            same as @a in.
+        @param n
+            The number of rectangles.
+
+        @since 3.3.0
+    */
+    void TransformRects(const wxRect2DDouble* in,
+                        wxRect2DDouble* out,
+                        size_t n) const;
 };
@@ -0,0 +1,143 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        bmpcache.h
+// Purpose:     interface of wxScaledBitmapCache
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxScaledBitmapCache
+
+    Global cache of bitmaps rescaled to a different scale factor.
+
+    When a bitmap is drawn on a device context using a different scale
+    factor, e.g. a bitmap with the scale factor of 1 is drawn on a window
+    on a display using 150% scaling, it has to be rescaled, which is done
+    every time it is drawn by default. This class allows to avoid doing it
+    by keeping the rescaled variants of the bitmaps, which are used by
+    wxDC::DrawBitmap() when the cache is enabled by calling Enable().
+
+    The cache entries are identified by the bitmap data, i.e. all the copies
+    of the same wxBitmap share the same entries, the scale factor and the
+    resize quality. The cache doesn't keep any references to the source
+    bitmaps and modifying the bitmap using its public functions makes its
+    existing entries unused, however the cache can't detect the direct changes
+    to the bitmap pixels done using wxPixelData, so Remove() must be called
+    for such bitmaps to avoid drawing their outdated variants.
+
+    The entries which are not used any more, e.g. because their source bitmap
+    was destroyed, are not removed immediately but only when the total size
+    of the cached bitmaps exceeds the limit set by SetMaxBytes(), in the least
+    recently used order.
+
+    Note that this class is not thread-safe and must be used from the main
+    thread only, as all the other GUI classes.
+
+    This class only has static functions and can't be instantiated.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @since 3.3.0
+*/
+class wxScaledBitmapCache
+{
+public:
+    /**
+        Statistics about the cache use returned by GetStats().
+    */
+    struct Stats
+    {
+        /// Number of lookups which found the bitmap in the cache.
+        size_t hits;
+
+        /// Number of lookups which had to create a new rescaled bitmap.
+        size_t misses;
+
+        /// Number of least recently used entries removed because the cache
+        /// size limit was reached.
+        size_t evictions;
+
+        /// Current number of entries in the cache.
+        size_t count;
+
+        /// Approximate amount of memory, in bytes, used by the cached bitmaps.
+        size_t bytes;
+    };
+
+    /**
+        Enable or disable the use of the cache.
+
+        The cache is disabled by default. Disabling it also clears it.
+    */
+    static void Enable(bool enable = true);
+
+    /**
+        Return @true if the cache is enabled.
+    */
+    static bool IsEnabled();
+
+    /**
+        Return the variant of the bitmap with the given scale factor.
+
+        The physical size of the returned bitmap is the size of the original
+        bitmap multiplied by the ratio of @a scale and its scale factor, so
+        that its logical size remains the same.
+
+        If the cache is disabled, or the bitmap already uses the given scale
+        factor, or it is monochrome, the bitmap itself is returned.
+
+        @param bitmap The bitmap to rescale.
+        @param scale The scale factor of the bitmap to return, typically the
+            content scale factor of the device context it will be drawn on.
+        @param quality The quality to use when rescaling the bitmap. The
+            default nearest neighbour method is the one used by
+            wxDC::DrawBitmap() for all the cached bitmaps, as it corresponds
+            to what it does when it rescales the bitmap itself.
+    */
+    static wxBitmap
+    GetScaled(const wxBitmap& bitmap,
+              double scale,
+              wxImageResizeQuality quality = wxIMAGE_QUALITY_NEAREST);
+
+    /**
+        Remove all the variants of the given bitmap from the cache.
+
+        This function must be called after changing the bitmap contents
+        directly using wxPixelData.
+    */
+    static void Remove(const wxBitmap& bitmap);
+
+    /**
+        Remove all the entries from the cache.
+    */
+    static void Clear();
+
+    /**
+        Set the maximal amount of memory, in bytes, used by the cached bitmaps.
+
+        When adding a new entry would exceed this limit, the least recently
+        used entries are removed from the cache. The bitmaps bigger than the
+        limit are not cached at all.
+
+        The default limit is 16MiB.
+    */
+    static void SetMaxBytes(size_t maxBytes);
+
+    /**
+        Return the maximal amount of memory used by the cached bitmaps.
+
+        @see SetMaxBytes()
+    */
+    static size_t GetMaxBytes();
+
+    /**
+        Return the current statistics of the cache use.
+    */
+    static Stats GetStats();
+
+    /**
+        Reset the hit, miss and eviction counters returned by GetStats().
+    */
+    static void ResetStats();
+};
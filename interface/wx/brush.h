@@ -347,7 +347,7 @@ wxBrush* wxRED_BRUSH;
 
     @see wxBrush
 */
-class wxBrushList
+class wxBrushList : public wxGDIObjListBase
 {
 public:
     /**
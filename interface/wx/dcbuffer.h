@@ -17,6 +17,11 @@
 // is private style and not returned by GetStyle.
 #define wxBUFFER_USES_SHARED_BUFFER 0x04
 
+// Keeps the buffer bitmap of wxBufferedPaintDC between paint events and
+// only redraws the parts of it which were invalidated by RefreshBuffer() and
+// not by Refresh(); implies wxBUFFER_CLIENT_AREA
+#define wxBUFFER_RETAINED           0x08
+
 
 /**
     @class wxBufferedDC
@@ -195,6 +200,58 @@ wxDC* wxAutoBufferedPaintDCFactory(wxWindow* window);
     wxScrolled::PrepareDC() on it as it already does this internally for the
     real underlying wxPaintDC.
 
+    By default, the buffer contents are not preserved between the paint events
+    and the entire window needs to be redrawn every time. For the windows
+    which are expensive to redraw, wxBUFFER_RETAINED style can be used to keep
+    a separate buffer for each window and redraw only the parts of it which
+    have really changed. When using this style, calling wxWindow::Refresh()
+    just copies the buffer contents to the screen again and the application
+    must use RefreshBuffer() or ScrollBuffer() to indicate the parts of the
+    buffer to be redrawn, e.g.
+    @code
+    MyCanvas::MyCanvas(wxWindow* parent) : wxWindow(parent, wxID_ANY)
+    {
+        SetBackgroundStyle(wxBG_STYLE_PAINT);
+        Bind(wxEVT_PAINT, &MyCanvas::OnPaint, this);
+    }
+
+    void MyCanvas::OnPaint(wxPaintEvent&)
+    {
+        wxBufferedPaintDC dc(this, wxBUFFER_RETAINED);
+
+        // Only the items intersecting the damaged region need to be drawn,
+        // the drawing is clipped to this region anyhow.
+        for ( const auto& item : m_items )
+        {
+            if ( dc.GetDamagedRegion().Contains(item.GetRect()) != wxOutRegion )
+                item.Draw(dc);
+        }
+    }
+
+    void MyCanvas::OnItemChanged(const Item& item)
+    {
+        wxRect rect = item.GetRect();
+        wxBufferedPaintDC::RefreshBuffer(this, &rect);
+    }
+    @endcode
+
+    The entire buffer is considered damaged when it's drawn for the first
+    time and only the newly appeared part of the window when it is resized.
+
+    @attention When using wxBUFFER_RETAINED, the native update region, i.e.
+        the region returned by wxWindow::GetUpdateRegion(), is @e not added
+        to the damaged region. This means that neither wxWindow::Refresh()
+        nor wxWindow::RefreshRect() nor the window being exposed by the
+        windowing system result in redrawing anything: the existing, and
+        possibly stale, buffer contents are just copied to the screen. Any
+        code changing the window appearance, including the code in the base
+        classes or in the other parts of the program calling Refresh() on
+        this window, must call RefreshBuffer() instead. In particular, the
+        buffer must be explicitly refreshed or discarded after changing the
+        window colours or font, as the window itself only calls Refresh()
+        in this case. If this is not possible, wxBUFFER_RETAINED should not
+        be used.
+
     @library{wxcore}
     @category{dc}
 
@@ -212,7 +269,10 @@ public:
         Pass wxBUFFER_CLIENT_AREA for the @a style parameter to indicate that
         just the client area of the window is buffered, or
         wxBUFFER_VIRTUAL_AREA to indicate that the buffer bitmap covers the
-        virtual area.
+        virtual area. Additionally, wxBUFFER_RETAINED can be used to keep the
+        internal buffer between paint events, it can't be combined with
+        wxBUFFER_VIRTUAL_AREA and is ignored if a bitmap is explicitly
+        provided.
     */
     wxBufferedPaintDC(wxWindow* window, wxBitmap& buffer,
                       int style = wxBUFFER_CLIENT_AREA);
@@ -225,5 +285,69 @@ public:
         this object, using a wxPaintDC.
     */
     virtual ~wxBufferedPaintDC();
+
+    /**
+        Returns the part of the window which needs to be redrawn.
+
+        This region is only meaningful when using wxBUFFER_RETAINED style, it
+        is empty if nothing needs to be redrawn and the window is repainted
+        only because it was exposed or Refresh() was called. Drawing on the
+        DC is clipped to this region.
+
+        @since 3.3.0
+    */
+    const wxRegion& GetDamagedRegion() const;
+
+    /**
+        Marks the part of the retained buffer as needing to be redrawn and
+        refreshes the window.
+
+        This function must be used to update the contents of a window using
+        wxBUFFER_RETAINED style instead of wxWindow::Refresh(), which only
+        copies the existing buffer contents to the screen again, even if they
+        are out of date.
+
+        @param window The window using wxBUFFER_RETAINED style.
+        @param rect The rectangle to redraw in client coordinates or @NULL
+            to redraw the entire window.
+
+        @since 3.3.0
+    */
+    static void RefreshBuffer(wxWindow* window, const wxRect* rect = nullptr);
+
+    /**
+        Scrolls the contents of the retained buffer.
+
+        This function moves the contents of the given part of the buffer by
+        the specified offset, marks only the part of it uncovered by scrolling
+        as needing to be redrawn and refreshes the window, so that only a
+        thin strip has to be redrawn when scrolling by a few pixels.
+
+        @param window The window using wxBUFFER_RETAINED style.
+        @param dx Amount to scroll horizontally, positive to move the contents
+            to the right.
+        @param dy Amount to scroll vertically, positive to move the contents
+            down.
+        @param rect The rectangle to scroll in client coordinates or @NULL to
+            scroll the entire window.
+        @return @false if there is no buffer to scroll yet, in which case
+            nothing is done, as the window will be entirely redrawn anyhow.
+
+        @since 3.3.0
+    */
+    static bool ScrollBuffer(wxWindow* window, int dx, int dy,
+                             const wxRect* rect = nullptr);
+
+    /**
+        Frees the memory used by the retained buffer of the window.
+
+        The buffer is freed automatically when the window is destroyed, but
+        this function may be used to do it earlier, e.g. when the window is
+        hidden. The buffer will be recreated and entirely redrawn when the
+        window is painted the next time.
+
+        @since 3.3.0
+    */
+    static void DiscardBuffer(wxWindow* window);
 };
 
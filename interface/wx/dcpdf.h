@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        dcpdf.h
+// Purpose:     interface of wxPDFFileDC
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxPDFFileDC
+
+    A wxPDFFileDC is a device context onto which graphics and text can be
+    drawn, and the output produced as a vector file, in PDF format.
+
+    Like wxSVGFileDC, it is a write-only device context intended to be used
+    instead of a wxDC to produce a file corresponding to the screen display,
+    so raster operations like GetPixel() are not supported. Unlike
+    wxPostScriptDC, it doesn't require any external tools to produce PDF.
+
+    The output is written to the file progressively: the contents of every
+    page are compressed and written when the page is finished, so the entire
+    document is never kept in memory. Each distinct bitmap is embedded in the
+    file only once, even if it is drawn many times, on the same or different
+    pages, and its alpha channel, if any, is preserved.
+
+    The document consists of a single page unless StartPage() and EndPage()
+    are used to create several of them. A page is started automatically when
+    something is drawn on the DC and the document is finished either by
+    calling EndDoc() or when the DC is destroyed.
+
+    Text is drawn using the standard PDF fonts (Helvetica, Times and Courier)
+    which don't need to be embedded in the file, but only support the
+    characters of Windows-1252 encoding, other characters are replaced with
+    question marks. The text extents returned by this DC are computed using
+    the metrics of these fonts and so correspond to the text in the output
+    file, even if they differ from the extents of the same text on screen.
+    Hatched brushes are drawn as solid ones.
+
+    This class is only available if @c wxUSE_ZLIB is enabled.
+
+    @library{wxcore}
+    @category{dc}
+
+    @since 3.3.0
+*/
+
+class wxPDFFileDC : public wxDC
+{
+public:
+    /**
+        Initializes a wxPDFFileDC with the given @a filename, @a width and
+        @a height, expressed in pixels at @a dpi resolution, and an optional
+        @a title stored in the document information.
+
+        The default size corresponds to an A4 page at 72 DPI, i.e. with one
+        pixel per point.
+
+        Use IsOk() to check if the file could be created.
+    */
+    wxPDFFileDC(const wxString& filename, int width = 595, int height = 842,
+                double dpi = 72, const wxString& title = wxString());
+
+    /**
+        Fills the entire page using the wxDC::SetBackground() brush.
+
+        Does nothing if the background brush is transparent, which is the
+        default.
+    */
+    void Clear();
+
+    /**
+        Does nothing, as the document is started when the DC is created.
+
+        Returns @true if the output file was successfully created.
+    */
+    bool StartDoc(const wxString& message);
+
+    /**
+        Finishes the document and closes the file.
+
+        This function is called automatically from the destructor if it wasn't
+        called before, but calling it explicitly allows to reuse the file
+        immediately. Nothing can be drawn on the DC after calling it.
+    */
+    void EndDoc();
+
+    /**
+        Starts a new page, ending the current one, if any.
+    */
+    void StartPage();
+
+    /**
+        Finishes the current page and writes it to the file.
+    */
+    void EndPage();
+
+    /**
+        Function not implemented in this DC class.
+    */
+    void CrossHair(wxCoord x, wxCoord y);
+
+    /**
+        Function not implemented in this DC class.
+    */
+    bool FloodFill(wxCoord x, wxCoord y, const wxColour& colour,
+                   wxFloodFillStyle style = wxFLOOD_SURFACE);
+
+    /**
+        Function not implemented in this DC class.
+    */
+    bool GetPixel(wxCoord x, wxCoord y, wxColour* colour) const;
+
+    /**
+        Function not implemented in this DC class.
+    */
+    void SetPalette(const wxPalette& palette);
+
+    /**
+        Function not implemented in this DC class.
+    */
+    void SetLogicalFunction(wxRasterOperationMode function);
+};
@@ -5,6 +5,41 @@
 // Licence:     wxWindows licence
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+    Compression used for the bitmaps in wxPostScriptDC output.
+
+    @see wxPostScriptDC::SetImageCompression()
+
+    @since 3.3.0
+*/
+enum wxPostScriptImageCompression
+{
+    /**
+        Don't compress the bitmaps and output them in ASCII hex format.
+
+        This makes the output usable with PostScript Level 1 printers, but
+        bitmaps take twice more space than their raw data. This is the
+        default.
+    */
+    wxPS_IMAGE_COMPRESSION_NONE,
+
+    /**
+        Compress the bitmaps using RunLengthDecode filter.
+
+        This requires PostScript Level 2 support and is only effective for the
+        bitmaps containing big areas of the same colour.
+    */
+    wxPS_IMAGE_COMPRESSION_RLE,
+
+    /**
+        Compress the bitmaps using FlateDecode filter.
+
+        This requires PostScript Level 3 support. If wxWidgets was built
+        without zlib support, RunLengthDecode filter is used instead.
+    */
+    wxPS_IMAGE_COMPRESSION_FLATE
+};
+
 /**
     @class wxPostScriptDC
 
@@ -32,5 +67,29 @@ public:
     */
     wxPostScriptDC(const wxPrintData& printData);
 
+    /**
+        Set the compression used for the bitmaps drawn on this DC.
+
+        Compressed bitmaps are output using ASCII85 encoding which makes
+        them much smaller than the uncompressed ones, but requires PostScript
+        Level 2 or later. By default, wxPS_IMAGE_COMPRESSION_NONE is used to
+        keep the output compatible with all PostScript devices, so the
+        compression needs to be explicitly enabled by calling this function.
+
+        This function should be called before StartDoc() as the PostScript
+        language level required by the document is declared in its header.
+
+        @since 3.3.0
+    */
+    void SetImageCompression(wxPostScriptImageCompression compression);
+
+    /**
+        Get the compression used for the bitmaps drawn on this DC.
+
+        @see SetImageCompression()
+
+        @since 3.3.0
+    */
+    wxPostScriptImageCompression GetImageCompression() const;
 };
 
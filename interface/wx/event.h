@@ -252,6 +252,53 @@ public:
     */
     int StopPropagation();
 
+    /**
+        Statistics about the events allocated on the heap returned by
+        GetAllocStats().
+
+        @since 3.3.0
+    */
+    struct AllocStats
+    {
+        /// Number of events allocated on the heap.
+        size_t allocations;
+
+        /// Number of the allocations which reused the memory of a previously
+        /// deleted event instead of allocating it.
+        size_t reused;
+
+        /// Number of memory blocks currently kept for reuse.
+        size_t pooled;
+    };
+
+    /**
+        Return the statistics about the events allocated on the heap.
+
+        The events created with @c new, e.g. by Clone() when queuing them or
+        by wxEvtHandler::CallAfter(), don't allocate memory directly but use
+        a pool of the memory blocks freed by the previously deleted events of
+        the same size. This avoids allocating memory for each event when many
+        of them are queued and processed and this function allows to check
+        how efficient this is.
+
+        The freed blocks are kept in a cache specific to the current thread
+        and are moved to and from the pool shared by all threads in batches,
+        so that the events deleted in one thread can be reused by another one
+        without locking for each of them. Note that the statistics are not
+        synchronized with the pool, so the returned values are only
+        approximate if events are being allocated in other threads.
+
+        @since 3.3.0
+    */
+    static AllocStats GetAllocStats();
+
+    /**
+        Reset the allocation and reuse counters returned by GetAllocStats().
+
+        @since 3.3.0
+    */
+    static void ResetAllocStats();
+
 protected:
     /**
         Indicates how many levels the event can propagate.
@@ -462,6 +509,35 @@ public:
      */
     virtual void QueueEvent(wxEvent *event);
 
+    /**
+        Queue an event for processing later, replacing any pending event with
+        the same key.
+
+        This function works like QueueEvent() and is also safe to call from
+        any thread, but if an event queued by this function with the same @a
+        key for this handler is still pending, @a event replaces it instead of
+        being added to the queue. The new event is processed at the position
+        of the event it replaces, i.e. as if it had been queued when the first
+        event with this key was, and the replaced event is deleted without
+        being processed.
+
+        This allows to avoid flooding the event queue with events which only
+        represent the latest state of something, e.g. progress notifications
+        from a worker thread: the number of events processed is bounded by the
+        number of different keys, whatever the number of events queued.
+
+        @param event
+            A heap-allocated event to be queued, this function takes ownership
+            of it. This parameter shouldn't be @NULL.
+        @param key
+            Arbitrary value identifying the events which can replace each
+            other. The keys are specific to this handler, i.e. events queued
+            for different handlers are never coalesced.
+
+        @since 3.3.0
+     */
+    void QueueEventCoalesced(wxEvent *event, wxUIntPtr key);
+
     /**
         Post an event to be processed later.
 
@@ -564,6 +640,39 @@ public:
     template<typename T>
     void CallAfter(const T& functor);
 
+    /**
+         Asynchronously call the given functor, replacing any pending call
+         with the same key.
+
+         This function is similar to CallAfter(), but if a functor queued by
+         this function with the same @a key for this object hasn't been called
+         yet, it is replaced by the new @a functor and only the latter will be
+         called. This is useful for notifications where only the latest state
+         matters, e.g. progress updates from a worker thread, as it ensures
+         that the main thread only executes a single call for each key, no
+         matter how many times this function was called.
+
+         Example of use in a worker thread:
+         @code
+         for ( int n = 0; n < count; n++ ) {
+             ... do the work ...
+
+             frame->CallAfterCoalesced(ProgressKey, [frame, n]() {
+                 frame->UpdateProgress(n);
+             });
+         }
+         @endcode
+
+         @param key Arbitrary value identifying the calls to coalesce. The
+            keys are specific to this object and are shared with
+            QueueEventCoalesced().
+         @param functor The functor to call.
+
+         @since 3.3.0
+     */
+    template<typename T>
+    void CallAfterCoalesced(wxUIntPtr key, const T& functor);
+
     /**
         Processes an event, searching event tables and calling zero or more suitable
         event handler function(s).
@@ -1077,6 +1186,87 @@ public:
     ///@}
 
 
+    /**
+        @name Idle events subscription
+
+        These functions are only used in wxIDLE_PROCESS_SUBSCRIBED mode, see
+        wxIdleEvent::SetMode().
+    */
+    ///@{
+
+    /**
+        Subscribe this handler to the idle events or unsubscribe it.
+
+        In wxIDLE_PROCESS_SUBSCRIBED mode, idle events are only sent to the
+        subscribed event handlers. Binding a @c wxEVT_IDLE handler using
+        Bind() while this mode is active subscribes the handler automatically
+        (or the window it is pushed on, see below), and unbinding the last
+        such handler unsubscribes it, so this function only needs to be called
+        for the handlers using @c EVT_IDLE in their static event table and for
+        the handlers which bound @c wxEVT_IDLE before switching to this mode.
+        Note that this is also done automatically for the windows, including
+        their pushed event handlers, when they get their first idle event
+        after switching to this mode or changing their handlers, but not for
+        the other event handlers.
+
+        For a window, it is the window itself that is subscribed if any of
+        the handlers in its chain processes idle events. The event is then
+        processed by the window in the same way as in the other modes, i.e.
+        starting with the first handler pushed on it and with the window as
+        the event object. For the other handlers, the event is processed by
+        the handler and the next handlers in its chain, with the subscribed
+        handler as the event object, and is not sent again to the next
+        handlers even if they're subscribed too. Unlike in the other modes,
+        idle events are sent to all subscribed handlers, including the ones
+        which are not windows or associated with a window, which never get
+        idle events otherwise.
+
+        Note that the windows tree is still traversed during idle time in
+        this mode, as wxWindow::OnInternalIdle() needs to be called for all
+        windows, so this mode only avoids the cost of processing the idle
+        events themselves.
+
+        The handlers are unsubscribed automatically when they're destroyed.
+
+        @since 3.3.0
+    */
+    void SubscribeToIdleEvents(bool subscribe = true);
+
+    /**
+        Returns @true if this handler is subscribed to the idle events.
+
+        @see SubscribeToIdleEvents()
+
+        @since 3.3.0
+    */
+    bool IsSubscribedToIdleEvents() const;
+
+    /**
+        Returns @true if this handler processes idle events.
+
+        This function checks if there are any @c wxEVT_IDLE handlers bound
+        to this object or in its static event table.
+
+        @since 3.3.0
+    */
+    bool HasIdleEventHandlers() const;
+
+    /**
+        Sends the idle event to all the subscribed handlers.
+
+        This function is called by wxWidgets itself from wxApp idle processing
+        when using wxIDLE_PROCESS_SUBSCRIBED mode and normally doesn't need to
+        be called by the application.
+
+        @return @true if any handler requested more idle events.
+
+        @since 3.3.0
+    */
+    static bool SendIdleEventToSubscribers(wxIdleEvent& event);
+
+    ///@}
+
+
     /**
         @name Event handler chaining
 
@@ -2340,7 +2530,14 @@ enum wxUpdateUIMode
 
         /** Send UI update events to windows that have
             the wxWS_EX_PROCESS_UI_UPDATES flag specified. */
-    wxUPDATE_UI_PROCESS_SPECIFIED
+    wxUPDATE_UI_PROCESS_SPECIFIED,
+
+        /** Send UI update events only to the windows registered using
+            wxWindow::RegisterForUpdateUI() and only after
+            wxUpdateUIEvent::RequestUpdate() is called.
+
+            @since 3.3.0 */
+    wxUPDATE_UI_PROCESS_REGISTERED
 };
 
 
@@ -2379,6 +2576,13 @@ enum wxUpdateUIMode
         between updates. You may need to call wxWindow::UpdateWindowUI at critical points,
         for example when a dialog is about to be shown, in case the user sees a slight
         delay before windows are updated.
+    @li Call wxUpdateUIEvent::SetMode with a value of wxUPDATE_UI_PROCESS_REGISTERED,
+        call wxWindow::RegisterForUpdateUI() for every window that should receive
+        update events and call wxUpdateUIEvent::RequestUpdate() whenever the state
+        of the application changes. The update events are then sent only to the
+        registered windows and only once after each RequestUpdate() call, instead
+        of being sent to all windows during each idle time, which is much more
+        efficient for the applications with many windows.
 
     Note that although events are sent in idle time, defining a wxIdleEvent handler
     for a window does not affect this because the events are sent from wxWindow::OnInternalIdle
@@ -2426,6 +2630,49 @@ public:
     */
     static bool CanUpdate(wxWindow* window);
 
+    /**
+        Returns @true if RequestUpdate() had been called since the last time
+        the registered windows were updated.
+
+        @since 3.3.0
+    */
+    static bool IsUpdateRequested();
+
+    /**
+        Request sending update events to the registered windows.
+
+        This function should be called whenever the state of the application,
+        which is checked by the update UI event handlers, changes when using
+        wxUPDATE_UI_PROCESS_REGISTERED mode. The update events will be sent
+        to all the windows registered using wxWindow::RegisterForUpdateUI()
+        during the next idle time, and calling this function several times
+        before it happens only results in a single update.
+
+        Note that the registered windows whose parent is hidden are not updated,
+        so this function may need to be called after showing such windows.
+
+        Unlike most of the other functions, this one can be called from any
+        thread, e.g. from a worker thread changing the application state.
+
+        @see SetMode(), wxWindow::UpdateRegisteredWindowsUI()
+
+        @since 3.3.0
+    */
+    static void RequestUpdate();
+
+    /**
+        Resets the flag set by RequestUpdate().
+
+        This is called by wxWidgets itself before updating the registered
+        windows and normally doesn't need to be called by the application.
+
+        @return @true if RequestUpdate() had been called since the last time
+            the flag was reset.
+
+        @since 3.3.0
+    */
+    static bool ResetUpdateRequest();
+
     /**
         Check or uncheck the UI element.
     */
@@ -4154,7 +4401,16 @@ enum wxIdleMode
     wxIDLE_PROCESS_ALL,
 
         /** Send idle events to windows that have the wxWS_EX_PROCESS_IDLE flag specified */
-    wxIDLE_PROCESS_SPECIFIED
+    wxIDLE_PROCESS_SPECIFIED,
+
+        /**
+            Send idle events only to the event handlers subscribed to them.
+
+            See wxEvtHandler::SubscribeToIdleEvents().
+
+            @since 3.3.0
+         */
+    wxIDLE_PROCESS_SUBSCRIBED
 };
 
 
@@ -4187,6 +4443,15 @@ enum wxIdleMode
     style for every window which should receive idle events, all the other ones
     will not receive them in this case.
 
+    Alternatively, you can use wxIDLE_PROCESS_SUBSCRIBED mode, in which idle
+    events are sent only to the event handlers which are subscribed to them, see
+    wxEvtHandler::SubscribeToIdleEvents(). As the handlers binding @c wxEVT_IDLE
+    and the windows with @c EVT_IDLE in their event tables are subscribed
+    automatically, this mode usually doesn't require any changes to the
+    application code, while the idle events are not processed by all the
+    windows any more. Notice that wxWindow::OnInternalIdle() is still called
+    for all windows in this mode.
+
     @beginEventTable{wxIdleEvent}
     @event{EVT_IDLE(func)}
         Process a @c wxEVT_IDLE event.
@@ -336,3 +336,115 @@ public:
 };
 
 
+
+/**
+    @class wxEventLoopWatchdog
+
+    Detects the main thread not processing events for too long.
+
+    When started, the watchdog runs a background thread that checks whether
+    the main event loop is still processing events. The watchdog is notified
+    whenever an event is processed by wxEvtHandler::ProcessEvent() in the
+    main thread, as well as whenever the event loop dispatches events or
+    processes idle events.
+    If it doesn't do this within the given threshold, the main thread is
+    considered to be stuck. This happens, for example, if an event handler
+    performs a long blocking operation or is in a deadlock.
+
+    When a stall is detected, the watchdog retrieves the stack of the main
+    thread, if possible, and either calls the function set with
+    SetCallback() or logs the stack using wxLogWarning(). Each stall is only
+    reported once, no matter how long it lasts. Note that the messages logged
+    from the watchdog thread are only shown once the main thread flushes the
+    log, so using a callback writing the report to a file directly is
+    preferable if the application may never recover from the stall.
+
+    The stack of the main thread can currently be retrieved only under Unix
+    systems and only when wxUSE_STACKWALKER is enabled. To do it, the watchdog
+    interrupts the main thread with a signal, @c SIGUSR2 by default, and
+    installs its own handler for this signal while it is running, replacing
+    any existing handler, which is only restored by Stop(). So this signal
+    must not be used for anything else by the application while the watchdog
+    is running, and a different one may be passed to Start() if the
+    application already uses @c SIGUSR2. Note that the signal handler
+    uses @c backtrace() which, while it is not formally async-signal-safe,
+    is safe to use in practice with glibc once it had been called at least
+    once, which is ensured by Start(). Under the other platforms the stall
+    is reported without the stack.
+
+    Note that the watchdog periodically wakes up the event loop when it's
+    idle to check that it's not stuck, so the application will get a few
+    more idle events than usual while the watchdog is running.
+
+    All the functions of this class are static and it can't be instantiated.
+
+    @library{wxbase}
+    @category{appmanagement}
+
+    @since 3.3.0
+*/
+class wxEventLoopWatchdog
+{
+public:
+    /**
+        Type of the function called when a stall is detected.
+
+        The function is called from the watchdog thread, @e not the main
+        thread. Its first parameter is the time, in milliseconds, since the
+        main thread processed events for the last time. The second one is
+        its stack, with one frame per line. It is empty if the stack couldn't
+        be retrieved.
+    */
+    typedef std::function<void (long elapsed, const wxString& stack)> Callback;
+
+    /**
+        Start the watchdog.
+
+        This function must be called from the main thread. If the watchdog
+        is already running, it is restarted with the new threshold.
+
+        @param threshold The time, in milliseconds, after which the main
+            thread is considered to be stuck if it didn't process any events.
+        @param sig The signal used to retrieve the stack of the main thread
+            under Unix, e.g. @c SIGUSR1 or one of the real-time signals. The
+            handler of this signal is replaced by the watchdog one until
+            Stop() is called. The default value of 0 means using @c SIGUSR2.
+            This parameter is ignored under the other platforms.
+        @return @true if the watchdog thread was started successfully.
+    */
+    static bool Start(long threshold = 2000, int sig = 0);
+
+    /**
+        Stop the watchdog if it is running.
+
+        This function is called automatically when the library is shut down.
+    */
+    static void Stop();
+
+    /**
+        Return @true if the watchdog is currently running.
+
+        Unlike the other functions of this class, this one can be called from
+        any thread.
+    */
+    static bool IsRunning();
+
+    /**
+        Set the function to call when a stall is detected.
+
+        By default, the stalls are logged using wxLogWarning(). Call this
+        function with an empty @a callback to restore this behaviour.
+    */
+    static void SetCallback(const Callback& callback);
+
+    /**
+        Notify the watchdog that the main thread is processing events.
+
+        This function is called by wxWidgets itself from the event loop and
+        when processing the events, so it only needs to be called explicitly
+        by applications running some code in the main thread for a long time
+        without processing any events, but which is not stuck. It is very
+        cheap and may be called even when the watchdog is not running.
+    */
+    static void Heartbeat();
+};
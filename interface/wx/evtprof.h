@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        evtprof.h
+// Purpose:     interface of wxEventProfiler
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxEventProfiler
+
+    Collects statistics about the time taken by the event handlers.
+
+    When the profiler is enabled by calling Enable(), each call of an event
+    handler, whether it was connected using wxEvtHandler::Bind() or an event
+    table, as well as each function queued using wxEvtHandler::CallAfter(),
+    is measured and the calls of the same handler for the same event type are
+    aggregated together. The collected statistics can be retrieved using
+    GetStats() or Dump(), which is convenient for logging them, e.g.
+    @code
+        wxEventProfiler::Enable();
+        ... let the user do something slow ...
+        wxLogMessage("%s", wxEventProfiler::Dump());
+    @endcode
+
+    Additionally, the individual calls can be recorded after calling
+    EnableTrace() and saved in Chrome trace event format using
+    ExportChromeTrace(), to examine them in a trace viewer.
+
+    Note that the time of each individual handler call is measured, and not
+    the time taken by wxEvtHandler::ProcessEvent() as a whole. In particular,
+    the time spent in wxEvtHandler::ProcessEvent() itself, e.g. searching for
+    the handlers, and in the overridden wxEvtHandler::TryBefore() and
+    wxEvtHandler::TryAfter() or in wxApp::FilterEvent() is not counted.
+    Conversely, if several handlers are called for
+    the same event, because the previous ones skip it or because it
+    propagates upwards, each of them is measured separately.
+
+    When the profiler is not enabled, which is the default, the only overhead
+    is a single check of a flag for each handler call. When it is enabled,
+    measuring each call requires reading the clock twice and updating the
+    statistics of the current thread, which are only merged together when
+    they are retrieved, so while it's not free, it's cheap enough to be
+    enabled in production builds for some time. It is also possible to avoid
+    even the check of the flag by building wxWidgets with
+    @c wxUSE_EVENT_PROFILER set to 0, in which case this class is not
+    available.
+
+    Note that the handlers and the functions are identified using their C++
+    types, so the profiler requires RTTI support and Enable() does nothing if
+    it's not available. The class of the handler is the most derived class of
+    the wxEvtHandler object, while the description of the handler function is
+    the type of the functor used to call it which contains the type of the
+    lambda or the class of the function object used with Bind(). For the
+    handlers which are methods, a hash of the method pointer is also included
+    in the description to distinguish between the different methods of the
+    same class, as there is no way to get its name.
+
+    This class only has static functions and can't be instantiated.
+
+    @library{wxbase}
+    @category{events}
+
+    @since 3.3.0
+*/
+class wxEventProfiler
+{
+public:
+    /**
+        Statistics for all calls of the same handler for the same event type.
+    */
+    struct Entry
+    {
+        /// The type of the event.
+        wxEventType eventType;
+
+        /// The name of the C++ class of the event.
+        wxString eventClass;
+
+        /// The name of the C++ class of the event handler object.
+        wxString handlerClass;
+
+        /// The description of the function handling the event.
+        wxString handlerName;
+
+        /// Number of calls.
+        size_t count;
+
+        /// Total time taken by all the calls, in nanoseconds.
+        wxLongLong_t totalTime;
+
+        /// Time taken by the slowest call, in nanoseconds.
+        wxLongLong_t maxTime;
+
+        /**
+            Maximal nesting level of the calls.
+
+            This is 1 for the handlers which were always called from the
+            event loop directly, and 2 or more for the handlers called while
+            another handler was being executed, e.g. because it sent another
+            event or called wxYield().
+        */
+        int maxDepth;
+    };
+
+    /**
+        Start or stop collecting the statistics.
+
+        Disabling the profiler doesn't reset the statistics collected so far,
+        use Reset() to do it.
+    */
+    static void Enable(bool enable = true);
+
+    /**
+        Return @true if the profiler is currently enabled.
+    */
+    static bool IsEnabled();
+
+    /**
+        Record the individual handler calls.
+
+        The trace is not recorded by default. After calling this function,
+        the first @a maxCalls calls are recorded, while the profiler is
+        enabled, and can be exported using ExportChromeTrace(). Passing 0
+        stops recording the trace.
+    */
+    static void EnableTrace(size_t maxCalls = 100000);
+
+    /**
+        Return the statistics collected since the last call to Reset().
+
+        The entries are sorted by the total time of the calls in decreasing
+        order.
+    */
+    static std::vector<Entry> GetStats();
+
+    /**
+        Return the statistics formatted as a table with one line per entry.
+    */
+    static wxString Dump();
+
+    /**
+        Forget all the statistics and the recorded trace.
+    */
+    static void Reset();
+
+    /**
+        Save the recorded trace to the given file.
+
+        The file uses Chrome trace event JSON format and can be opened in
+        chrome://tracing page of Chrome browser or in Perfetto UI.
+
+        @return @true if the file was written successfully.
+    */
+    static bool ExportChromeTrace(const wxString& filename);
+};
@@ -1362,7 +1362,7 @@ wxFont* wxSWISS_FONT;
 
     @see wxFont
 */
-class wxFontList
+class wxFontList : public wxGDIObjListBase
 {
 public:
     /**
@@ -0,0 +1,323 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        future.h
+// Purpose:     interface of wxFuture and wxPromise
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxPromise
+
+    Provides the value of the associated wxFuture.
+
+    The promise is used by the code performing an asynchronous operation to
+    make the result of this operation available to the code using the future
+    returned by GetFuture(), and to trigger the continuations registered with
+    wxFuture::Then().
+
+    Unlike @c std::promise, this class can be copied and all copies refer to
+    the same shared state. This allows capturing the promise in the lambdas
+    passed to wxEvtHandler::CallAfter() or wxEvtHandler::Bind(), for example.
+    The value can be set from any thread, but only once: either SetValue() or
+    SetException() must be called, and only for one of the copies.
+
+    If all the copies of the promise are destroyed without setting its value,
+    the associated future becomes ready with @c std::future_error exception
+    with @c std::future_errc::broken_promise code.
+
+    Example of wrapping an existing event-based API:
+    @code
+        wxFuture<wxString> AskForName(wxWindow* parent)
+        {
+            wxPromise<wxString> promise;
+
+            auto* const dlg = new wxTextEntryDialog(parent, "Name:");
+            dlg->Bind(wxEVT_WINDOW_MODAL_DIALOG_CLOSED,
+                      [dlg, promise](wxWindowModalDialogEvent& event) mutable
+                      {
+                          promise.SetValue(event.GetReturnCode() == wxID_OK
+                                            ? dlg->GetValue() : wxString());
+                          dlg->Destroy();
+                      });
+            dlg->ShowWindowModal();
+
+            return promise.GetFuture();
+        }
+    @endcode
+
+    @tparam T The type of the value, may be @c void.
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxFuture
+
+    @since 3.3.0
+*/
+template <typename T>
+class wxPromise
+{
+public:
+    /**
+        Create a new promise with a new shared state.
+    */
+    wxPromise();
+
+    /**
+        Return the future associated with this promise.
+
+        This function may be called several times, all the returned futures
+        refer to the same state.
+    */
+    wxFuture<T> GetFuture() const;
+
+    /**
+        Set the value of the promise, making the associated futures ready.
+
+        The continuations added using wxFuture::Then() overload without any
+        handler or pool are executed by this function, in the calling thread.
+
+        For wxPromise<void>, this function doesn't take any parameters.
+    */
+    void SetValue(T value);
+
+    /**
+        Set the exception of the promise, making the associated futures ready.
+
+        The exception is rethrown by wxFuture::Get() and propagated to the
+        futures returned by wxFuture::Then().
+
+        This function is only available if @c wxUSE_EXCEPTIONS is 1.
+    */
+    void SetException(const std::exception_ptr& exception);
+};
+
+/**
+    @class wxFuture
+
+    Result of an asynchronous operation, available in the future.
+
+    The future is usually obtained from the function starting an asynchronous
+    operation, such as wxRunAsync(), wxExecuteAsync() or
+    wxWebRequest::StartAsync(), or created from wxPromise. It becomes ready
+    when the operation completes, which can be checked using IsReady().
+
+    The main advantage of this class compared to @c std::future is that it
+    allows to chain the operations using Then(), which calls the given
+    function, called continuation, with the value of the future once it
+    becomes ready and returns the future for its result. The continuation
+    can be executed:
+        - immediately, in the thread making the future ready;
+        - in the main thread, using wxEvtHandler::CallAfter(), if the given
+          wxEvtHandler, e.g. a window, still exists at that time;
+        - in one of the worker threads of the given wxThreadPool.
+
+    This allows to express a sequence of the asynchronous operations without
+    nesting the event handlers, e.g.
+    @code
+        wxRunAsync([path]() { return LoadData(path); })
+            .Then([](const Data& data) { return Parse(data); })
+            .Then([this](const Document& doc) { ShowDocument(doc); }, this);
+    @endcode
+    Here LoadData() and Parse() are both executed in the worker thread of the
+    default pool and only ShowDocument() is executed in the main thread,
+    during the next event loop iteration after the document is parsed.
+
+    If the continuation returns wxFuture<U> itself, Then() returns wxFuture<U>
+    which becomes ready once the returned future is ready, which allows to
+    chain the asynchronous operations, and not just the functions.
+
+    If the future becomes ready with an exception, the continuations are not
+    called and the futures returned by Then() become ready with the same
+    exception. Similarly, if the continuation throws, the future returned by
+    Then() becomes ready with this exception. It is rethrown by Get().
+
+    All copies of the future refer to the same shared state and the future
+    can be used from any thread. Several continuations can be added to the
+    same future.
+
+    Default constructed future is invalid, and only IsValid() can be called
+    on it.
+
+    @tparam T The type of the value, may be @c void.
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxPromise, wxWhenAll(), wxWhenAny()
+
+    @since 3.3.0
+*/
+template <typename T>
+class wxFuture
+{
+public:
+    /**
+        Create an invalid future.
+    */
+    wxFuture();
+
+    /**
+        Return @true if the future is associated with a shared state.
+    */
+    bool IsValid() const;
+
+    /**
+        Return @true if the value or the exception is available.
+    */
+    bool IsReady() const;
+
+    /**
+        Block until the future becomes ready.
+
+        Note that this function must not be called in the main thread if the
+        future becomes ready only after executing some code in the main
+        thread, e.g. a continuation added by Then() with a window handler, as
+        this would deadlock.
+    */
+    void Wait() const;
+
+    /**
+        Wait until the future becomes ready and return its value.
+
+        If the future has an exception, it is rethrown by this function.
+
+        For wxFuture<void>, this function returns nothing.
+
+        @see TakeValue()
+    */
+    const T& Get() const;
+
+    /**
+        Wait until the future becomes ready and move its value out of it.
+
+        This function is similar to Get() but returns the value itself and
+        not a reference to it, which allows using futures with the move-only
+        types, such as @c std::unique_ptr<>, e.g.
+        @code
+            wxFuture< std::unique_ptr<Data> > future = LoadDataAsync();
+            std::unique_ptr<Data> data = future.TakeValue();
+        @endcode
+
+        As the value is shared by all copies of the future, it can be taken
+        only once and neither Get() nor TakeValue() may be called for this
+        future or any of its copies after this, nor should any continuations
+        accessing the value be added to it.
+
+        If the future has an exception, it is rethrown by this function.
+
+        This function is not available in wxFuture<void>.
+    */
+    T TakeValue();
+
+    /**
+        Call the given function with the value of this future once it becomes
+        ready.
+
+        The function is called in the thread making this future ready or, if
+        it already is, immediately by this function. This should only be used
+        for the functions executing quickly.
+
+        @param func The function called with the value of the future as its
+            argument, or without any arguments for wxFuture<void>. It may
+            return a value of any type.
+        @return The future for the value returned by the function.
+    */
+    template <typename F>
+    wxFuture<R> Then(F func) const;
+
+    /**
+        Call the given function with the value of this future once it becomes
+        ready in the main thread, if the given handler still exists.
+
+        The function is called using wxEvtHandler::CallAfter() on wxTheApp,
+        i.e. during the next event loop iteration after this future becomes
+        ready. The handler, which must be used in the main thread, as all
+        windows are, is not used to call the function but only to check if
+        it still exists: it can be safely destroyed at any moment and, if this
+        happens before the function is called, the function is not called at
+        all and the returned future becomes ready with @c std::future_error
+        exception. This allows to use the handler, e.g. a window, in the
+        function without any additional checks.
+
+        This overload must be called from the main thread.
+    */
+    template <typename F>
+    wxFuture<R> Then(F func, wxEvtHandler* handler) const;
+
+    /**
+        Call the given function with the value of this future once it becomes
+        ready in one of the worker threads of the given pool.
+
+        This overload is only available if @c wxUSE_THREADS is 1.
+    */
+    template <typename F>
+    wxFuture<R> Then(F func, wxThreadPool& pool) const;
+};
+
+
+/** @addtogroup group_funcmacro_thread */
+///@{
+
+/**
+    Return the future which is already ready with the given value.
+
+    This can be useful for the functions returning wxFuture when the result
+    is available immediately. There is also an overload without parameters
+    returning wxFuture<void>.
+
+    @header{wx/future.h}
+
+    @since 3.3.0
+*/
+template <typename T>
+wxFuture<T> wxMakeReadyFuture(T value);
+
+/**
+    Call the given function in the given pool and return the future for its
+    result.
+
+    This is similar to wxThreadPool::Submit() but returns wxFuture instead of
+    @c std::future, allowing to chain the continuations to it.
+
+    This function is only available if @c wxUSE_THREADS is 1.
+
+    @header{wx/future.h}
+
+    @since 3.3.0
+*/
+template <typename F>
+wxFuture<R> wxRunAsync(F func, wxThreadPool& pool = wxThreadPool::GetDefault());
+
+/**
+    Return the future which becomes ready when all the given futures are.
+
+    The returned future contains the values of all the futures in the same
+    order as they appear in the vector or, if any of them has an exception,
+    the exception of the first one of them. If the vector is empty, the
+    returned future is ready immediately.
+
+    For the vector of wxFuture<void>, the returned future is wxFuture<void>.
+
+    @header{wx/future.h}
+
+    @since 3.3.0
+*/
+template <typename T>
+wxFuture< std::vector<T> > wxWhenAll(const std::vector< wxFuture<T> >& futures);
+
+/**
+    Return the future which becomes ready when any of the given futures is.
+
+    The returned future contains the index of the first ready future in the
+    vector, which must not be empty. Note that this future doesn't become
+    ready with an exception, even if the first ready future has it.
+
+    @header{wx/future.h}
+
+    @since 3.3.0
+*/
+template <typename T>
+wxFuture<size_t> wxWhenAny(const std::vector< wxFuture<T> >& futures);
+
+///@}
@@ -808,6 +808,65 @@ public:
 const wxPoint wxDefaultPosition;
 
 
+/**
+    @class wxGDIObjListBase
+
+    Base class for wxPenList, wxBrushList and wxFontList.
+
+    The objects in these lists are indexed by their attributes, so finding
+    them doesn't become slower when the list grows. By default, the objects
+    are only deleted when the list itself is destroyed, i.e. on program
+    exit, but the number of objects kept in the list can be limited using
+    SetMaxCount().
+
+    Note that the objects returned by the lists are shared and must not be
+    modified.
+
+    @library{wxcore}
+    @category{gdi}
+*/
+class wxGDIObjListBase
+{
+public:
+    /**
+        Limit the number of objects in the list.
+
+        When the number of objects exceeds the given limit, the least recently
+        used ones are deleted. This is useful in long-running programs creating
+        many different objects.
+
+        @warning Setting the limit changes the lifetime of the objects returned
+            by the list: they may be deleted as soon as another object is
+            created, so any pointers to them kept by the caller become
+            dangling. Only use this function if the pointers returned by the
+            list are never stored, but used immediately and, if necessary,
+            copied, as wxPen, wxBrush and wxFont objects are cheap to copy.
+            By default there is no limit and the objects remain valid until
+            the program exit.
+
+        @param maxCount The maximal number of objects to keep in the list or
+            0, which is the default, for no limit.
+
+        @since 3.3.0
+    */
+    void SetMaxCount(size_t maxCount);
+
+    /**
+        Return the maximal number of objects set by SetMaxCount().
+
+        @since 3.3.0
+    */
+    size_t GetMaxCount() const;
+
+    /**
+        Return the number of objects currently in the list.
+
+        @since 3.3.0
+    */
+    size_t GetCount() const;
+};
+
+
 /**
     @class wxColourDatabase
 
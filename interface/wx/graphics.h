@@ -1892,6 +1892,32 @@ public:
     */
     virtual void TransformPoint(wxDouble* x, wxDouble* y) const;
 
+    /**
+        Applies this matrix to an array of points.
+
+        The @a out array may be the same as @a in. This function is more
+        efficient than calling TransformPoint() for each point, as it doesn't
+        call the native function for each of them.
+
+        @since 3.3.0
+    */
+    void TransformPoints(const wxPoint2DDouble* in,
+                         wxPoint2DDouble* out,
+                         size_t n) const;
+
+    /**
+        Computes the bounding boxes of an array of transformed rectangles.
+
+        The @a out array may be the same as @a in.
+
+        @see wxAffineMatrix2D::TransformRects()
+
+        @since 3.3.0
+    */
+    void TransformRects(const wxRect2DDouble* in,
+                        wxRect2DDouble* out,
+                        size_t n) const;
+
     /**
         Translates this matrix.
     */
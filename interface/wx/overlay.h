@@ -46,6 +46,50 @@ public:
         @since 3.3.0
     */
     void SetOpacity(int alpha);
+
+    /**
+        Declares the area which will be drawn in the next overlay frame.
+
+        A frame corresponds to the drawing done using a single wxDCOverlay
+        object and this function must be called before creating it. The
+        drawing done during this frame is clipped to the given rectangle,
+        expressed in the logical coordinates of the DC used with wxDCOverlay.
+
+        Calling this function is optional, but allows the generic overlay
+        implementation to save and restore only the given area of the window
+        instead of the entire overlay, which is much faster for small overlays
+        over big windows, e.g. when drawing a selection rectangle:
+        @code
+        void MyCanvas::OnMouseMove(wxMouseEvent& event)
+        {
+            const wxRect rect(m_startPos, event.GetPosition());
+
+            m_overlay.SetNextFrameArea(rect);
+
+            wxClientDC dc(this);
+            wxDCOverlay overlaydc(m_overlay, &dc);
+            overlaydc.Clear();
+
+            dc.SetPen(*wxBLACK_PEN);
+            dc.SetBrush(*wxTRANSPARENT_BRUSH);
+            dc.DrawRectangle(rect);
+        }
+        @endcode
+
+        If the frame only clears the overlay, e.g. when finishing drawing it,
+        an empty rectangle can be passed to this function to avoid saving
+        anything at all.
+
+        Even if this function is not called, only the parts of the window
+        really drawn over in the previous frames are restored by
+        wxDCOverlay::Clear(), as determined by the DC bounding box.
+
+        This function doesn't do anything when using the native overlay
+        implementations.
+
+        @since 3.3.0
+    */
+    void SetNextFrameArea(const wxRect& rect);
 };
 
 
@@ -651,7 +651,7 @@ wxPen* wxLIGHT_GREY_PEN;
 
     @see wxPen
 */
-class wxPenList
+class wxPenList : public wxGDIObjListBase
 {
 public:
     /**
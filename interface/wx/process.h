@@ -316,3 +316,41 @@ public:
 
 wxEventType wxEVT_END_PROCESS;
 
+
+/** @addtogroup group_funcmacro_procctrl */
+///@{
+
+/**
+    Execute the command asynchronously and return the future for its exit code.
+
+    This function is similar to wxExecute() called with wxEXEC_ASYNC flag and
+    a wxProcess object overriding wxProcess::OnTerminate(), but allows to
+    handle the process termination using wxFuture::Then() instead, e.g.
+    @code
+        wxExecuteAsync("make").Then([this](int rc)
+        {
+            m_statusLabel->SetLabel(rc == 0 ? "Built" : "Build failed");
+        });
+    @endcode
+
+    The returned future becomes ready, in the main thread, when the process
+    terminates. If the process couldn't be launched, it becomes ready with -1
+    immediately.
+
+    @param command
+        The command to execute, as for wxExecute().
+    @param flags
+        The same flags as for wxExecute(), except that wxEXEC_SYNC can't be
+        used.
+    @param env
+        An optional pointer to additional parameters for the child process.
+
+    @header{wx/process.h}
+
+    @since 3.3.0
+*/
+wxFuture<int> wxExecuteAsync(const wxString& command,
+                             int flags = wxEXEC_ASYNC,
+                             const wxExecuteEnv* env = nullptr);
+
+///@}
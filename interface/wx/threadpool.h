@@ -0,0 +1,318 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        threadpool.h
+// Purpose:     interface of wxThreadPool, wxTaskGroup and wxCancellationToken
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxCancellationToken
+
+    Token allowing to cancel the tasks which check it.
+
+    All copies of the token share the same state, so the token can be passed
+    by value to the tasks and calling Cancel() on any copy of it cancels all
+    the others too. Note that cancellation is cooperative: the running tasks
+    are not interrupted, but should check IsCancelled() periodically and stop
+    if it returns @true.
+
+    This class is only available if @c wxUSE_THREADS is 1.
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxThreadPool::ParallelFor(), wxTaskGroup
+
+    @since 3.3.0
+*/
+class wxCancellationToken
+{
+public:
+    /**
+        Create a new, not cancelled, token.
+    */
+    wxCancellationToken();
+
+    /**
+        Cancel this token and all its copies.
+
+        This function can be called from any thread.
+    */
+    void Cancel();
+
+    /**
+        Returns @true if Cancel() had been called on this token or any of its
+        copies.
+    */
+    bool IsCancelled() const;
+};
+
+/**
+    @class wxThreadPool
+
+    Thread pool executing the tasks using a fixed number of worker threads.
+
+    Creating a thread for each task is relatively expensive, so the tasks,
+    i.e. any callable objects, should be executed using a thread pool instead.
+    The application can create its own pools or use the global one returned by
+    GetDefault(). The tasks can be executed using one of the following
+    functions:
+        - Post() just executes the task asynchronously.
+        - Submit() returns @c std::future which can be used to wait for the
+          task completion and retrieve its result.
+        - ParallelFor() executes the same function for all elements of the
+          range in parallel.
+        - wxTaskGroup::Run() executes the task as part of a group, allowing to
+          wait for all its tasks to complete or cancel them.
+
+    Example:
+    @code
+        // Compute something in the background.
+        std::future<int> result = wxThreadPool::GetDefault().Submit(
+            []() { return ComputeSomething(); }
+        );
+
+        // Process all the items in parallel.
+        wxThreadPool::GetDefault().ParallelFor(0, items.size(), 0,
+            [&items](size_t i) { ProcessItem(items[i]); }
+        );
+    @endcode
+
+    Each worker thread has its own queue of tasks: the tasks created by the
+    tasks running in a worker thread are added to its own queue and executed
+    by it in LIFO order, while the idle workers steal the oldest tasks from
+    the queues of the other ones. The tasks created by the other threads are
+    added to a separate shared queue. This makes the pool efficient for both
+    independent tasks and the tasks recursively creating more tasks.
+
+    Note that the tasks must not use any GUI functions, as with any other
+    threads, but they can use wxEvtHandler::CallAfter() to run the code in
+    the main thread, see also wxTaskGroup::ContinueWith().
+
+    This class is only available if @c wxUSE_THREADS is 1.
+
+    @library{wxbase}
+    @category{threading}
+
+    @since 3.3.0
+*/
+class wxThreadPool
+{
+public:
+    /// Type of the task executed by the pool.
+    typedef std::function<void ()> Task;
+
+    /**
+        Create the pool with the given number of worker threads.
+
+        If @a numWorkers is not positive, the number of CPUs returned by
+        wxThread::GetCPUCount() is used.
+    */
+    explicit wxThreadPool(int numWorkers = -1);
+
+    /**
+        Destroy the pool.
+
+        The destructor waits until all the tasks already submitted to the pool
+        complete and then stops the worker threads. It must not be called from
+        a task executed by this pool.
+    */
+    ~wxThreadPool();
+
+    /**
+        Return the global pool.
+
+        This pool is created, using the number of CPUs as the number of
+        workers, when this function is called for the first time and is
+        destroyed when the library is shut down. This function must not be
+        called after this happens, e.g. from the destructors of the global
+        objects.
+    */
+    static wxThreadPool& GetDefault();
+
+    /**
+        Return the number of the worker threads.
+    */
+    int GetWorkerCount() const;
+
+    /**
+        Returns @true if called from one of the worker threads of this pool.
+    */
+    bool IsWorkerThread() const;
+
+    /**
+        Execute the given task asynchronously.
+
+        If the task throws an exception, wxApp::OnUnhandledException() is
+        called in the worker thread.
+    */
+    void Post(Task task);
+
+    /**
+        Execute the given callable object asynchronously and return the
+        future for its result.
+
+        The future can be used to wait until the task completes and get the
+        value returned by it or rethrow the exception thrown by it.
+    */
+    template <typename F>
+    std::future<R> Submit(F&& func);
+
+    /**
+        Call the given function for all values in the given range in parallel.
+
+        The range from @a begin, included, to @a end, excluded, is split into
+        chunks of @a grain elements which are processed by the worker threads
+        and the calling thread. If @a grain is 0, the size of the chunks is
+        chosen automatically to give several chunks to each thread.
+
+        This function blocks until all the calls complete. If the @a token is
+        cancelled, the remaining chunks are not processed. If any call throws
+        an exception, the remaining chunks are not processed either, and the
+        exception is rethrown from this function.
+
+        @param begin The first value of the range.
+        @param end One past the last value of the range.
+        @param grain The number of values in each chunk, or 0.
+        @param func Function called with each value, as @c func(i).
+        @param token Optional token allowing to cancel the processing.
+    */
+    template <typename F>
+    void ParallelFor(size_t begin, size_t end, size_t grain, const F& func,
+                     const wxCancellationToken& token = wxCancellationToken());
+
+    /**
+        Execute one of the pending tasks in the calling thread.
+
+        This function can be used to help with executing the tasks while
+        waiting for them. Note that the task executed by it can be any task
+        posted to the pool, so it shouldn't be used in the main thread if the
+        tasks could take a long time.
+
+        @return @true if a task was executed, @false if there were no pending
+            tasks.
+    */
+    bool RunPendingTask();
+};
+
+/**
+    @class wxTaskGroup
+
+    Group of the tasks which can be waited for or cancelled together.
+
+    The tasks are added to the group using Run() and executed by the pool
+    associated with the group. It is possible to either wait for all of them
+    to complete using Wait() or to be notified about their completion in the
+    main thread using ContinueWith(). The latter is convenient in the GUI
+    applications, e.g.
+    @code
+        void MyFrame::OnProcess(wxCommandEvent&)
+        {
+            wxTaskGroup group;
+            for ( auto& item : m_items )
+                group.Run([&item]() { item.Process(); });
+
+            group.ContinueWith([this]() { UpdateDisplay(); }, this);
+        }
+    @endcode
+
+    Note that the group object can be destroyed before its tasks complete,
+    as in the example above.
+
+    The tasks of the group can create more tasks in the same group and the
+    group is only considered to be done when all of them complete.
+
+    This class is only available if @c wxUSE_THREADS is 1.
+
+    @library{wxbase}
+    @category{threading}
+
+    @since 3.3.0
+*/
+class wxTaskGroup
+{
+public:
+    /**
+        Create the group executing the tasks in the given pool.
+    */
+    explicit wxTaskGroup(wxThreadPool& pool = wxThreadPool::GetDefault());
+
+    /**
+        Destroy the group.
+
+        The destructor doesn't wait for the tasks to complete, call Wait()
+        before destroying the group if necessary.
+    */
+    ~wxTaskGroup();
+
+    /**
+        Execute the task as part of this group.
+
+        The task is not executed at all if the group is cancelled before it
+        starts. If it throws an exception, the group is cancelled and the
+        exception is rethrown by Wait().
+    */
+    void Run(wxThreadPool::Task task);
+
+    /**
+        Wait until all the tasks of the group complete.
+
+        The calling thread executes the tasks of this group which haven't
+        started yet while waiting, so this function can be called from the
+        tasks executed by the pool too. Notice that the other tasks of the pool
+        are never executed by this function, so it doesn't block the main
+        thread for longer than the group itself takes when called from it.
+
+        If any of the tasks threw an exception, the first of these exceptions
+        is rethrown by this function.
+    */
+    void Wait();
+
+    /**
+        Returns @true if all the tasks of the group have completed.
+    */
+    bool IsDone() const;
+
+    /**
+        Cancel the tasks of the group.
+
+        The tasks which haven't started yet are not executed, while the
+        running tasks can check IsCancelled() or the token returned by
+        GetCancellationToken() to stop early.
+    */
+    void Cancel();
+
+    /**
+        Returns @true if Cancel() was called or if one of the tasks threw an
+        exception.
+    */
+    bool IsCancelled() const;
+
+    /**
+        Return the token which is cancelled when the group is.
+
+        This token can be passed to wxThreadPool::ParallelFor() called from
+        the tasks of the group, for example.
+    */
+    wxCancellationToken GetCancellationToken() const;
+
+    /**
+        Call the given function in the main thread once all the tasks of the
+        group complete.
+
+        The function is called using wxEvtHandler::CallAfter() on wxTheApp,
+        so it is executed during the next event loop iteration after the
+        completion of the last task. If all the tasks have already completed,
+        this happens during the next event loop iteration.
+
+        If @a handler is not @NULL, the function is only called if the handler
+        still exists at that time, which allows to safely use it, e.g. a
+        window, in the function even if it can be destroyed before the tasks
+        complete.
+
+        Only a single continuation can be set and this function must be called
+        from the main thread.
+    */
+    void ContinueWith(const std::function<void ()>& func,
+                      wxEvtHandler* handler = nullptr);
+};
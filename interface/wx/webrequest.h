@@ -270,6 +270,46 @@ public:
     */
     void Start();
 
+    /**
+        Send the request to the server asynchronously and return the future
+        for its result.
+
+        This function does the same thing as Start() and the events are still
+        sent to the handler associated with the request, but it also returns
+        the future which becomes ready with the copy of the last
+        wxWebRequestEvent once the request completes, fails or is cancelled.
+        This allows to chain the request with other asynchronous operations
+        using wxFuture::Then(), for example:
+        @code
+            wxWebRequest request = wxWebSession::GetDefault().CreateRequest(
+                this, "https://www.wxwidgets.org/"
+            );
+            request.StartAsync().Then([this](const wxWebRequestEvent& event)
+            {
+                if ( event.GetState() == wxWebRequest::State_Completed )
+                    m_text->SetValue(event.GetResponse().AsString());
+            });
+        @endcode
+
+        Note that the future does @e not become ready when the request state
+        changes to @c State_Unauthorized, as the request may still continue
+        after the credentials are provided using wxWebAuthChallenge, so the
+        application must handle @c wxEVT_WEBREQUEST_STATE events to detect
+        this state. If the credentials are provided, the future becomes ready
+        when the request terminates. Otherwise it becomes ready with
+        std::future_error exception once the last wxWebRequest object
+        referencing the request is destroyed.
+
+        The future is made ready in the main thread after the event is
+        processed by the handler. If the request uses @c Storage_File, the
+        data file is only available to the continuations executed
+        immediately, i.e. added by wxFuture::Then() overload without any
+        handler or pool.
+
+        @since 3.3.0
+    */
+    wxFuture<wxWebRequestEvent> StartAsync();
+
     /**
         Cancel an active request.
 
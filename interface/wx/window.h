@@ -3943,6 +3943,39 @@ public:
     */
     void SetDoubleBuffered(bool on);
 
+    /**
+        Enable or disable keeping the window contents in a backing store.
+
+        When the backing store is enabled, the window contents is painted into
+        an off-screen surface which is then copied to the window. ScrollWindow()
+        moves the contents of this surface and only the newly exposed parts of
+        the window are repainted, instead of the entire window, which makes
+        scrolling of windows with expensive paint handlers much faster.
+
+        The parts of the backing store exposed for any reason other than
+        scrolling, e.g. by Refresh(), RefreshRect(), Thaw() or a theme change,
+        as well as all of it after a change of the window size, are repainted
+        by the paint event handler. However the window is not repainted if it
+        is only scrolled, so Refresh() must still be called after any change
+        affecting the window appearance. Drawing on the window outside of the
+        paint event handler, e.g. using wxClientDC, is not preserved in the
+        backing store and the drawn area is repainted by the paint handler
+        when it is exposed the next time. Using wxBufferedPaintDC in the paint
+        handler is fine, as it just draws into the backing store.
+
+        The backing store is not used for windows with wxBG_STYLE_TRANSPARENT
+        background style.
+
+        @param enable @true to enable the backing store, @false to disable it
+            and free the memory used by it.
+        @return @true if the backing store is supported by the current
+            platform, which is currently only the case for wxGTK 3, or @false
+            otherwise.
+
+        @since 3.3.0
+    */
+    virtual bool EnableScrollBackingStore(bool enable = true);
+
     /**
         Returns @true if the window is retained, @false otherwise.
 
@@ -4067,6 +4100,47 @@ public:
     */
     virtual void UpdateWindowUI(long flags = wxUPDATE_UI_NONE);
 
+    /**
+        Register the window to receive wxUpdateUIEvent in
+        wxUPDATE_UI_PROCESS_REGISTERED mode or unregister it.
+
+        When wxUpdateUIEvent::SetMode() is used to select this mode, only the
+        registered windows get update UI events, and only after
+        wxUpdateUIEvent::RequestUpdate() is called, instead of all windows
+        getting them during each idle time. Note that UpdateWindowUI() is
+        called for the registered windows, so registering a wxFrame updates its
+        menu bar and toolbar too.
+
+        Registering the window requests an update to allow it to initialize
+        its state. The windows are unregistered automatically when they're
+        destroyed.
+
+        @see IsRegisteredForUpdateUI(), UpdateRegisteredWindowsUI()
+
+        @since 3.3.0
+    */
+    void RegisterForUpdateUI(bool registerWindow = true);
+
+    /**
+        Returns @true if RegisterForUpdateUI() was called for this window.
+
+        @since 3.3.0
+    */
+    bool IsRegisteredForUpdateUI() const;
+
+    /**
+        Send update UI events to all the windows registered using
+        RegisterForUpdateUI().
+
+        This is called automatically during idle time if
+        wxUpdateUIEvent::RequestUpdate() had been called in
+        wxUPDATE_UI_PROCESS_REGISTERED mode, but can also be called directly
+        to update the registered windows immediately.
+
+        @since 3.3.0
+    */
+    static void UpdateRegisteredWindowsUI();
+
     ///@}
 
 
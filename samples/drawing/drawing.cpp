@@ -2161,6 +2161,10 @@ void MyCanvas::OnMouseMove(wxMouseEvent &event)
         m_currentpoint = wxPoint( xx , yy ) ;
         wxRect newrect ( m_anchorpoint , m_currentpoint ) ;
 
+        // Only the area of the rectangle, including its border, needs to be
+        // saved and restored by the overlay.
+        m_overlay.SetNextFrameArea( wxRect(newrect).Inflate(2) );
+
         wxClientDC dc( this ) ;
         PrepareDC( dc ) ;
 
@@ -2197,6 +2201,9 @@ bool MyCanvas::StopRubberBanding()
         return false;
 
     {
+        // Nothing is drawn in the last frame, it is only cleared.
+        m_overlay.SetNextFrameArea( wxRect() );
+
         wxClientDC dc( this );
         PrepareDC( dc );
         wxDCOverlay overlaydc( m_overlay, &dc );
@@ -15,6 +15,24 @@
 #include "wx/affinematrix2d.h"
 #include "wx/math.h"
 
+#include <algorithm>
+
+// SSE2 is always available when targeting x86-64 and allows to transform a
+// point, whose coordinates fit into a single register, using just a few
+// instructions.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define wxAFFINE_USE_SSE2
+
+    #include <emmintrin.h>
+
+    // We load and store points and rectangles directly from/to memory.
+    wxCOMPILE_TIME_ASSERT( sizeof(wxPoint2DDouble) == 2*sizeof(double),
+                           BadPoint2DDoubleSize );
+    wxCOMPILE_TIME_ASSERT( sizeof(wxRect2DDouble) == 4*sizeof(double),
+                           BadRect2DDoubleSize );
+#endif
+
 // sets the matrix to the respective values
 void wxAffineMatrix2D::Set(const wxMatrix2D &mat2D, const wxPoint2DDouble &tr)
 {
@@ -173,6 +191,116 @@ wxAffineMatrix2D::DoTransformDistance(const wxPoint2DDouble& src) const
                            src.m_x * m_12 + src.m_y * m_22);
 }
 
+// applies the matrix to all the points in the array
+void
+wxAffineMatrix2D::DoTransformPoints(const wxPoint2DDouble* in,
+                                    wxPoint2DDouble* out,
+                                    size_t n) const
+{
+    if ( IsIdentity() )
+    {
+        if ( in != out )
+            std::copy(in, in + n, out);
+        return;
+    }
+
+#ifdef wxAFFINE_USE_SSE2
+    const __m128d c1 = _mm_set_pd(m_12, m_11);
+    const __m128d c2 = _mm_set_pd(m_22, m_21);
+    const __m128d t = _mm_set_pd(m_ty, m_tx);
+
+    for ( size_t i = 0; i < n; i++ )
+    {
+        const __m128d p = _mm_loadu_pd(&in[i].m_x);
+        const __m128d x = _mm_unpacklo_pd(p, p);
+        const __m128d y = _mm_unpackhi_pd(p, p);
+
+        _mm_storeu_pd(&out[i].m_x,
+                      _mm_add_pd(_mm_add_pd(_mm_mul_pd(x, c1),
+                                            _mm_mul_pd(y, c2)),
+                                 t));
+    }
+#else // !wxAFFINE_USE_SSE2
+    for ( size_t i = 0; i < n; i++ )
+    {
+        const wxDouble x = in[i].m_x,
+                       y = in[i].m_y;
+
+        out[i].m_x = x * m_11 + y * m_21 + m_tx;
+        out[i].m_y = x * m_12 + y * m_22 + m_ty;
+    }
+#endif // wxAFFINE_USE_SSE2/!wxAFFINE_USE_SSE2
+}
+
+// computes the bounding boxes of all the transformed rectangles
+//
+// Instead of transforming all 4 corners of each rectangle, transform its
+// centre and compute the half-extents of the bounding box of the transformed
+// rectangle as |M|*(w/2, h/2) where |M| is the matrix with absolute values of
+// the elements of the linear part of the transformation.
+void
+wxAffineMatrix2D::DoTransformRects(const wxRect2DDouble* in,
+                                   wxRect2DDouble* out,
+                                   size_t n) const
+{
+    if ( IsIdentity() )
+    {
+        if ( in != out )
+            std::copy(in, in + n, out);
+        return;
+    }
+
+#ifdef wxAFFINE_USE_SSE2
+    const __m128d c1 = _mm_set_pd(m_12, m_11);
+    const __m128d c2 = _mm_set_pd(m_22, m_21);
+    const __m128d t = _mm_set_pd(m_ty, m_tx);
+
+    // Clearing the sign bit gives the absolute value.
+    const __m128d signMask = _mm_set1_pd(-0.0);
+    const __m128d c1abs = _mm_andnot_pd(signMask, c1);
+    const __m128d c2abs = _mm_andnot_pd(signMask, c2);
+    const __m128d half = _mm_set1_pd(0.5);
+
+    for ( size_t i = 0; i < n; i++ )
+    {
+        const __m128d pos = _mm_loadu_pd(&in[i].m_x);
+        const __m128d size = _mm_loadu_pd(&in[i].m_width);
+
+        const __m128d ext = _mm_mul_pd(size, half);
+        const __m128d centre = _mm_add_pd(pos, ext);
+        const __m128d extAbs = _mm_andnot_pd(signMask, ext);
+
+        const __m128d newCentre =
+            _mm_add_pd(_mm_add_pd(
+                        _mm_mul_pd(_mm_unpacklo_pd(centre, centre), c1),
+                        _mm_mul_pd(_mm_unpackhi_pd(centre, centre), c2)),
+                       t);
+        const __m128d newExt =
+            _mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(extAbs, extAbs), c1abs),
+                       _mm_mul_pd(_mm_unpackhi_pd(extAbs, extAbs), c2abs));
+
+        _mm_storeu_pd(&out[i].m_x, _mm_sub_pd(newCentre, newExt));
+        _mm_storeu_pd(&out[i].m_width, _mm_add_pd(newExt, newExt));
+    }
+#else // !wxAFFINE_USE_SSE2
+    for ( size_t i = 0; i < n; i++ )
+    {
+        const wxDouble ex = in[i].m_width / 2,
+                       ey = in[i].m_height / 2;
+        const wxDouble cx = in[i].m_x + ex,
+                       cy = in[i].m_y + ey;
+
+        const wxDouble newEx = fabs(ex) * fabs(m_11) + fabs(ey) * fabs(m_21),
+                       newEy = fabs(ex) * fabs(m_12) + fabs(ey) * fabs(m_22);
+
+        out[i].m_x = cx * m_11 + cy * m_21 + m_tx - newEx;
+        out[i].m_y = cx * m_12 + cy * m_22 + m_ty - newEy;
+        out[i].m_width = 2 * newEx;
+        out[i].m_height = 2 * newEy;
+    }
+#endif // wxAFFINE_USE_SSE2/!wxAFFINE_USE_SSE2
+}
+
 bool wxAffineMatrix2D::IsIdentity() const
 {
     return m_11 == 1 && m_12 == 0 &&
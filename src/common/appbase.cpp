@@ -410,11 +410,21 @@ void wxAppConsoleBase::WakeUpIdle()
 
 bool wxAppConsoleBase::ProcessIdle()
 {
+#if wxUSE_THREADS
+    // let the watchdog know that we're not stuck
+    wxEventLoopWatchdog::Heartbeat();
+#endif // wxUSE_THREADS
+
     // synthesize an idle event and check if more of them are needed
     wxIdleEvent event;
     event.SetEventObject(this);
     ProcessEvent(event);
 
+    // and to the other handlers interested in it if we don't send it to all
+    // windows
+    if ( wxIdleEvent::GetMode() == wxIDLE_PROCESS_SUBSCRIBED )
+        wxEvtHandler::SendIdleEventToSubscribers(event);
+
 #if wxUSE_LOG
     // flush the logged messages if any (do this after processing the events
     // which could have logged new messages)
@@ -575,10 +585,9 @@ void wxAppConsoleBase::DeletePendingEvents()
     wxCHECK_RET( m_handlersWithPendingDelayedEvents.IsEmpty(),
                  "this helper list should be empty" );
 
-    for (unsigned int i=0; i<m_handlersWithPendingEvents.GetCount(); i++)
-        m_handlersWithPendingEvents[i]->DeletePendingEvents();
-
-    m_handlersWithPendingEvents.Clear();
+    // Each handler removes itself from the list in its DeletePendingEvents().
+    while (!m_handlersWithPendingEvents.IsEmpty())
+        m_handlersWithPendingEvents[0]->DeletePendingEvents();
 
     wxLEAVE_CRIT_SECT(m_handlersWithPendingEventsLocker);
 }
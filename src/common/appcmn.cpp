@@ -422,6 +422,10 @@ bool wxAppBase::ProcessIdle()
         node = node->GetNext();
     }
 
+    if ( wxUpdateUIEvent::GetMode() == wxUPDATE_UI_PROCESS_REGISTERED &&
+            wxUpdateUIEvent::ResetUpdateRequest() )
+        wxWindow::UpdateRegisteredWindowsUI();
+
     wxUpdateUIEvent::ResetUpdateTime();
 
     return needMore;
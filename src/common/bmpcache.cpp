@@ -0,0 +1,255 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/bmpcache.cpp
+// Purpose:     wxScaledBitmapCache implementation
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#if wxUSE_IMAGE
+
+#include "wx/bmpcache.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/math.h"
+    #include "wx/module.h"
+#endif
+
+#include <list>
+#include <map>
+
+namespace
+{
+
+struct CacheKey
+{
+    // The pointer to the source bitmap data is not enough to identify it, as
+    // the data may be destroyed and another one allocated at the same address
+    // later, or modified in place, so use its serial number too.
+    const wxObjectRefData* data;
+    unsigned long serial;
+    double scale;
+    wxImageResizeQuality quality;
+
+    bool operator<(const CacheKey& other) const
+    {
+        if ( data != other.data )
+            return std::less<const wxObjectRefData*>()(data, other.data);
+        if ( serial != other.serial )
+            return serial < other.serial;
+        if ( scale != other.scale )
+            return scale < other.scale;
+        return quality < other.quality;
+    }
+};
+
+// List of the keys, from the most to the least recently used one.
+typedef std::list<CacheKey> LRUList;
+
+struct CacheEntry
+{
+    wxBitmap scaled;
+    LRUList::iterator lru;
+};
+
+typedef std::map<CacheKey, CacheEntry> CacheMap;
+
+CacheMap gs_cache;
+LRUList gs_lru;
+wxScaledBitmapCache::Stats gs_stats;
+// The default limit is enough for a few hundred of typical toolbar icons.
+size_t gs_maxBytes = 16*1024*1024;
+bool gs_enabled = false;
+
+size_t GetBitmapBytes(const wxBitmap& bitmap)
+{
+    return static_cast<size_t>(bitmap.GetWidth())*bitmap.GetHeight()*4;
+}
+
+void EraseEntry(CacheMap::iterator it)
+{
+    gs_stats.bytes -= GetBitmapBytes(it->second.scaled);
+    gs_stats.count--;
+
+    gs_lru.erase(it->second.lru);
+    gs_cache.erase(it);
+}
+
+// Remove the least recently used entries until the total size of the cache
+// doesn't exceed the given limit.
+void EvictEntries(size_t maxBytes)
+{
+    while ( gs_stats.bytes > maxBytes && !gs_lru.empty() )
+    {
+        EraseEntry(gs_cache.find(gs_lru.back()));
+        gs_stats.evictions++;
+    }
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxScaledBitmapCache implementation
+// ----------------------------------------------------------------------------
+
+/* static */
+void wxScaledBitmapCache::Enable(bool enable)
+{
+    gs_enabled = enable;
+
+    if ( !enable )
+        Clear();
+}
+
+/* static */
+bool wxScaledBitmapCache::IsEnabled()
+{
+    return gs_enabled;
+}
+
+/* static */
+wxBitmap
+wxScaledBitmapCache::GetScaled(const wxBitmap& bitmap,
+                               double scale,
+                               wxImageResizeQuality quality)
+{
+    if ( !gs_enabled || !bitmap.IsOk() || scale <= 0 )
+        return bitmap;
+
+    const double bitmapScale = bitmap.GetScaleFactor();
+    if ( wxIsSameDouble(bitmapScale, scale) )
+        return bitmap;
+
+    // Monochrome bitmaps are drawn using the current text colours, so we
+    // can't convert them to an image without losing this information.
+    if ( bitmap.GetDepth() == 1 )
+        return bitmap;
+
+    const wxGDIRefData* const
+        data = static_cast<const wxGDIRefData*>(bitmap.GetRefData());
+    const CacheKey key = { data, data->GetSerial(), scale, quality };
+
+    const CacheMap::iterator it = gs_cache.find(key);
+    if ( it != gs_cache.end() )
+    {
+        gs_stats.hits++;
+
+        // Move the entry to the front of the LRU list.
+        gs_lru.splice(gs_lru.begin(), gs_lru, it->second.lru);
+
+        return it->second.scaled;
+    }
+
+    gs_stats.misses++;
+
+    const int width = wxRound(bitmap.GetWidth()*scale/bitmapScale);
+    const int height = wxRound(bitmap.GetHeight()*scale/bitmapScale);
+    if ( width <= 0 || height <= 0 )
+        return bitmap;
+
+    wxImage image = bitmap.ConvertToImage();
+    if ( !image.IsOk() )
+        return bitmap;
+
+    image.Rescale(width, height, quality);
+
+    const wxBitmap scaled(image, wxBITMAP_SCREEN_DEPTH, scale);
+    if ( !scaled.IsOk() )
+        return bitmap;
+
+    // Don't cache the bitmaps which wouldn't fit into the cache at all.
+    const size_t bytes = GetBitmapBytes(scaled);
+    if ( bytes > gs_maxBytes )
+        return scaled;
+
+    EvictEntries(gs_maxBytes - bytes);
+
+    gs_lru.push_front(key);
+
+    CacheEntry& entry = gs_cache[key];
+    entry.scaled = scaled;
+    entry.lru = gs_lru.begin();
+
+    gs_stats.bytes += bytes;
+    gs_stats.count++;
+
+    return scaled;
+}
+
+/* static */
+void wxScaledBitmapCache::Remove(const wxBitmap& bitmap)
+{
+    const wxObjectRefData* const data = bitmap.GetRefData();
+    if ( !data )
+        return;
+
+    // Remove the entries for all serial numbers as the old ones are useless.
+    const CacheKey first = { data, 0, 0.0, wxIMAGE_QUALITY_NEAREST };
+
+    CacheMap::iterator it = gs_cache.lower_bound(first);
+    while ( it != gs_cache.end() && it->first.data == data )
+        EraseEntry(it++);
+}
+
+/* static */
+void wxScaledBitmapCache::Clear()
+{
+    gs_cache.clear();
+    gs_lru.clear();
+
+    gs_stats.count = 0;
+    gs_stats.bytes = 0;
+}
+
+/* static */
+void wxScaledBitmapCache::SetMaxBytes(size_t maxBytes)
+{
+    gs_maxBytes = maxBytes;
+
+    EvictEntries(maxBytes);
+}
+
+/* static */
+size_t wxScaledBitmapCache::GetMaxBytes()
+{
+    return gs_maxBytes;
+}
+
+/* static */
+wxScaledBitmapCache::Stats wxScaledBitmapCache::GetStats()
+{
+    return gs_stats;
+}
+
+/* static */
+void wxScaledBitmapCache::ResetStats()
+{
+    gs_stats.hits =
+    gs_stats.misses =
+    gs_stats.evictions = 0;
+}
+
+// ----------------------------------------------------------------------------
+// wxScaledBitmapCacheModule: clears the cache on shutdown
+// ----------------------------------------------------------------------------
+
+class wxScaledBitmapCacheModule : public wxModule
+{
+public:
+    wxScaledBitmapCacheModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override { wxScaledBitmapCache::Clear(); }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxScaledBitmapCacheModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxScaledBitmapCacheModule, wxModule);
+
+#endif // wxUSE_IMAGE
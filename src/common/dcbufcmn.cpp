@@ -25,6 +25,8 @@
     #include "wx/module.h"
 #endif
 
+#include <unordered_map>
+
 // ============================================================================
 // implementation
 // ============================================================================
@@ -42,7 +44,17 @@ public:
     wxSharedDCBufferManager() { }
 
     virtual bool OnInit() override { return true; }
-    virtual void OnExit() override { wxDELETE(ms_buffer); }
+    virtual void OnExit() override
+    {
+        wxDELETE(ms_buffer);
+
+        for ( auto& kv : ms_retainedBuffers )
+        {
+            kv.first->Unbind(wxEVT_DESTROY,
+                             &wxSharedDCBufferManager::OnWindowDestroy);
+        }
+        ms_retainedBuffers.clear();
+    }
 
     static wxBitmap* GetBuffer(wxDC* dc, int w, int h)
     {
@@ -76,7 +88,163 @@ public:
         }
     }
 
+    // Return the buffer retained for the given window, (re)creating it if
+    // necessary, and the region which needs to be redrawn in it.
+    static wxBitmap* GetRetainedBuffer(wxWindow* window, wxDC* dc,
+                                       const wxSize& size, wxRegion& damaged)
+    {
+        RetainedBuffer& retained = GetRetainedData(window);
+        wxBitmap& buffer = retained.bitmap;
+
+        const double scale = dc ? dc->GetContentScaleFactor() : 1.0;
+        const wxSize sizeNew(wxMax(size.x, 1), wxMax(size.y, 1));
+
+        if ( !buffer.IsOk() || buffer.GetScaleFactor() != scale )
+        {
+            buffer.CreateWithLogicalSize(sizeNew, scale);
+            retained.damaged = wxRegion(wxRect(sizeNew));
+        }
+        else if ( buffer.GetLogicalSize() != sizeNew )
+        {
+            // Preserve the existing contents and only redraw the newly
+            // appeared part, if any, when the window is resized.
+            const wxSize sizeOld = buffer.GetLogicalSize();
+
+            wxBitmap bufferNew;
+            bufferNew.CreateWithLogicalSize(sizeNew, scale);
+            {
+                wxMemoryDC dcOld(buffer);
+                wxMemoryDC dcNew(bufferNew);
+                dcNew.Blit(0, 0, sizeOld.x, sizeOld.y, &dcOld, 0, 0);
+            }
+            buffer = bufferNew;
+
+            retained.damaged.Intersect(wxRect(sizeNew));
+            wxRegion newArea(wxRect(wxPoint(), sizeNew));
+            newArea.Subtract(wxRect(sizeOld));
+            retained.damaged.Union(newArea);
+        }
+
+        damaged = retained.damaged;
+        retained.damaged.Clear();
+
+        return &buffer;
+    }
+
+    static void RefreshRetainedBuffer(wxWindow* window, const wxRect* rect)
+    {
+        // Nothing to do if there is no buffer yet, it will be entirely drawn
+        // when it is created.
+        const auto it = ms_retainedBuffers.find(window);
+        if ( it != ms_retainedBuffers.end() && it->second.bitmap.IsOk() )
+        {
+            RetainedBuffer& retained = it->second;
+            retained.damaged.Union(rect ? *rect
+                                        : wxRect(retained.bitmap.GetLogicalSize()));
+        }
+    }
+
+    static bool ScrollRetainedBuffer(wxWindow* window, int dx, int dy,
+                                     const wxRect* rect)
+    {
+        const auto it = ms_retainedBuffers.find(window);
+        if ( it == ms_retainedBuffers.end() || !it->second.bitmap.IsOk() )
+            return false;
+
+        RetainedBuffer& retained = it->second;
+
+        const wxRect rectBuffer(retained.bitmap.GetLogicalSize());
+        const wxRect rectScroll = rect ? rect->Intersect(rectBuffer) : rectBuffer;
+
+        // This is the part of the scrolled rectangle still visible after
+        // scrolling, in its new position.
+        wxRect rectMoved = rectScroll;
+        rectMoved.Offset(dx, dy);
+        rectMoved.Intersect(rectScroll);
+        if ( !rectMoved.IsEmpty() )
+        {
+            // Use an intermediate bitmap as blitting from a DC onto itself
+            // with overlapping source and destination is not portable.
+            wxBitmap tmp;
+            tmp.CreateWithLogicalSize(rectMoved.GetSize(),
+                                      retained.bitmap.GetScaleFactor());
+
+            wxMemoryDC dcBuffer(retained.bitmap);
+            {
+                wxMemoryDC dcTmp(tmp);
+                dcTmp.Blit(0, 0, rectMoved.width, rectMoved.height,
+                           &dcBuffer, rectMoved.x - dx, rectMoved.y - dy);
+            }
+
+            wxMemoryDC dcTmp(tmp);
+            dcBuffer.Blit(rectMoved.x, rectMoved.y,
+                          rectMoved.width, rectMoved.height,
+                          &dcTmp, 0, 0);
+        }
+
+        // The damaged areas inside the scrolled rectangle move with it.
+        wxRegion damagedInside(retained.damaged);
+        damagedInside.Intersect(rectScroll);
+        damagedInside.Offset(dx, dy);
+        damagedInside.Intersect(rectScroll);
+
+        retained.damaged.Subtract(rectScroll);
+        retained.damaged.Union(damagedInside);
+
+        wxRegion uncovered(rectScroll);
+        uncovered.Subtract(rectMoved);
+        retained.damaged.Union(uncovered);
+
+        return true;
+    }
+
+    static void DiscardRetainedBuffer(wxWindow* window)
+    {
+        const auto it = ms_retainedBuffers.find(window);
+        if ( it != ms_retainedBuffers.end() )
+        {
+            it->second.bitmap = wxBitmap();
+            it->second.damaged.Clear();
+        }
+    }
+
 private:
+    struct RetainedBuffer
+    {
+        wxBitmap bitmap;
+
+        // The part of the bitmap which needs to be redrawn.
+        wxRegion damaged;
+    };
+
+    static RetainedBuffer& GetRetainedData(wxWindow* window)
+    {
+        const auto it = ms_retainedBuffers.find(window);
+        if ( it != ms_retainedBuffers.end() )
+            return it->second;
+
+        // Forget the buffer when the window is destroyed.
+        window->Bind(wxEVT_DESTROY, &wxSharedDCBufferManager::OnWindowDestroy);
+
+        return ms_retainedBuffers[window];
+    }
+
+    static void OnWindowDestroy(wxWindowDestroyEvent& event)
+    {
+        event.Skip();
+
+        // This event propagates upwards, so we can get it for the children
+        // of the window with the retained buffer too.
+        wxWindow* const window = event.GetWindow();
+        const auto it = ms_retainedBuffers.find(window);
+        if ( it != ms_retainedBuffers.end() )
+        {
+            window->Unbind(wxEVT_DESTROY,
+                           &wxSharedDCBufferManager::OnWindowDestroy);
+            ms_retainedBuffers.erase(it);
+        }
+    }
+
     static wxBitmap* DoCreateBuffer(wxDC* dc, int w, int h)
     {
         const double scale = dc ? dc->GetContentScaleFactor() : 1.0;
@@ -92,11 +260,15 @@ private:
     static wxBitmap *ms_buffer;
     static bool ms_usingSharedBuffer;
 
+    static std::unordered_map<wxWindow*, RetainedBuffer> ms_retainedBuffers;
+
     wxDECLARE_DYNAMIC_CLASS(wxSharedDCBufferManager);
 };
 
 wxBitmap* wxSharedDCBufferManager::ms_buffer = nullptr;
 bool wxSharedDCBufferManager::ms_usingSharedBuffer = false;
+std::unordered_map<wxWindow*, wxSharedDCBufferManager::RetainedBuffer>
+    wxSharedDCBufferManager::ms_retainedBuffers;
 
 wxIMPLEMENT_DYNAMIC_CLASS(wxSharedDCBufferManager, wxModule);
 
@@ -166,3 +338,62 @@ void wxBufferedDC::UnMask()
     if ( m_style & wxBUFFER_USES_SHARED_BUFFER )
         wxSharedDCBufferManager::ReleaseBuffer(m_buffer);
 }
+
+// ============================================================================
+// wxBufferedPaintDC
+// ============================================================================
+
+void wxBufferedPaintDC::InitRetained(wxWindow* window, int style)
+{
+    wxASSERT_MSG( !(style & wxBUFFER_VIRTUAL_AREA),
+                  wxT("wxBUFFER_RETAINED can't be used with wxBUFFER_VIRTUAL_AREA") );
+
+    wxBitmap* const buffer = wxSharedDCBufferManager::GetRetainedBuffer
+                             (
+                                window,
+                                &m_paintdc,
+                                window->GetClientSize(),
+                                m_damagedRegion
+                             );
+
+    Init(&m_paintdc, *buffer, (style & ~wxBUFFER_VIRTUAL_AREA) | wxBUFFER_CLIENT_AREA);
+
+    // Everything outside of the damaged region is still valid, so avoid
+    // drawing over it, even if the caller redraws everything.
+    if ( m_damagedRegion.IsEmpty() )
+        SetClippingRegion(0, 0, 0, 0);
+    else
+        SetDeviceClippingRegion(m_damagedRegion);
+}
+
+/* static */
+void wxBufferedPaintDC::RefreshBuffer(wxWindow* window, const wxRect* rect)
+{
+    wxCHECK_RET( window, wxT("null window") );
+
+    wxSharedDCBufferManager::RefreshRetainedBuffer(window, rect);
+
+    window->Refresh(false, rect);
+}
+
+/* static */
+bool wxBufferedPaintDC::ScrollBuffer(wxWindow* window, int dx, int dy,
+                                     const wxRect* rect)
+{
+    wxCHECK_MSG( window, false, wxT("null window") );
+
+    if ( !wxSharedDCBufferManager::ScrollRetainedBuffer(window, dx, dy, rect) )
+        return false;
+
+    // Only the uncovered part will be redrawn, the rest is just copied from
+    // the buffer.
+    window->Refresh(false, rect);
+
+    return true;
+}
+
+/* static */
+void wxBufferedPaintDC::DiscardBuffer(wxWindow* window)
+{
+    wxSharedDCBufferManager::DiscardRetainedBuffer(window);
+}
@@ -23,6 +23,7 @@
     #include "wx/geometry.h"
 #endif
 
+#include "wx/bmpcache.h"
 #include "wx/display.h"
 #include "wx/scopedarray.h"
 
@@ -274,7 +275,15 @@ void wxGCDCImpl::DoDrawBitmap( const wxBitmap &bmp, wxCoord x, wxCoord y,
     {
         // make a copy in case we need to remove its mask, if we don't modify
         // it the copy is cheap as bitmaps are reference-counted
-        wxBitmap bmpCopy(bmp);
+        //
+        // also use the cached variant of the bitmap with the same scale
+        // factor as the context, if available, to avoid rescaling it every
+        // time it's drawn
+        wxBitmap bmpCopy(wxScaledBitmapCache::GetScaled
+                         (
+                            bmp,
+                            m_graphicContext->GetContentScaleFactor()
+                         ));
         if ( !useMask && bmp.GetMask() )
             bmpCopy.SetMask(nullptr);
 
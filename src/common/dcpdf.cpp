@@ -0,0 +1,1570 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/dcpdf.cpp
+// Purpose:     wxPDFFileDC implementation
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+
+#ifndef WX_PRECOMP
+    #include "wx/dcmemory.h"
+    #include "wx/icon.h"
+    #include "wx/image.h"
+    #include "wx/math.h"
+#endif
+
+#include "wx/dcpdf.h"
+#include "wx/datetime.h"
+#include "wx/mstream.h"
+#include "wx/wfstream.h"
+#include "wx/zstream.h"
+
+// character widths of the standard fonts, generated from their AFM files:
+#if defined(__DARWIN__)
+    #include "../common/pdffonts.inc"
+#else
+    #include "pdffonts.inc"
+#endif
+
+// ----------------------------------------------------------
+// Global utilities
+// ----------------------------------------------------------
+
+// Device coordinates are pixels at the DPI given to the DC constructor, which
+// are mapped to PDF points by the transformation at the start of every page.
+#define XLOG2DEV(x)     ((double)LogicalToDeviceX(x))
+#define YLOG2DEV(y)     ((double)LogicalToDeviceY(y))
+#define XLOG2DEVREL(x)  ((double)LogicalToDeviceXRel(x))
+#define YLOG2DEVREL(y)  ((double)LogicalToDeviceYRel(y))
+
+namespace
+{
+
+// Format a number in the "C" locale using the minimal number of digits.
+wxString NumStr(double f)
+{
+    // Avoid "-0" in the output.
+    if ( fabs(f) < 0.0005 )
+        return wxS("0");
+
+    wxString s = wxString::FromCDouble(f, 3);
+    while ( s.Last() == '0' )
+        s.RemoveLast();
+    if ( s.Last() == '.' )
+        s.RemoveLast();
+
+    return s;
+}
+
+wxString ColourStr(const wxColour& c)
+{
+    return NumStr(c.Red() / 255.0) + wxS(" ") +
+           NumStr(c.Green() / 255.0) + wxS(" ") +
+           NumStr(c.Blue() / 255.0);
+}
+
+wxString PointStr(double x, double y)
+{
+    return NumStr(x) + wxS(" ") + NumStr(y);
+}
+
+// Convert a Unicode character to the WinAnsiEncoding used by the standard
+// fonts, return '?' for the characters not representable in it.
+char ToWinAnsi(wxUniChar ch)
+{
+    const wxUint32 c = ch.GetValue();
+    if ( (c >= 0x20 && c < 0x7f) || (c >= 0xa0 && c <= 0xff) )
+        return static_cast<char>(c);
+
+    // Characters in 0x80..0x9f range of CP1252.
+    static const wxUint16 s_cp1252[32] =
+    {
+        0x20ac, 0,      0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+        0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0,      0x017d, 0,
+        0,      0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+        0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0,      0x017e, 0x0178
+    };
+
+    for ( size_t n = 0; n < WXSIZEOF(s_cp1252); n++ )
+    {
+        if ( s_cp1252[n] == c && c != 0 )
+            return static_cast<char>(0x80 + n);
+    }
+
+    return '?';
+}
+
+// Return the text as PDF literal string, including the surrounding brackets.
+std::string TextLiteral(const wxString& text)
+{
+    std::string s;
+    s.reserve(text.length() + 2);
+
+    s += '(';
+    for ( wxString::const_iterator it = text.begin(); it != text.end(); ++it )
+    {
+        const char c = ToWinAnsi(*it);
+        switch ( c )
+        {
+            case '(':
+            case ')':
+            case '\\':
+                s += '\\';
+                break;
+        }
+        s += c;
+    }
+    s += ')';
+
+    return s;
+}
+
+// Return the text as a PDF text string encoded in UTF-16BE, as required for
+// the strings in the document information dictionary.
+wxString UnicodeTextString(const wxString& text)
+{
+    wxString s(wxS("<FEFF"));
+    for ( wxString::const_iterator it = text.begin(); it != text.end(); ++it )
+    {
+        wxUint32 c = (*it).GetValue();
+        if ( c > 0xffff )
+        {
+            c -= 0x10000;
+            s += wxString::Format(wxS("%04X%04X"),
+                                  0xd800 + (c >> 10), 0xdc00 + (c & 0x3ff));
+        }
+        else
+        {
+            s += wxString::Format(wxS("%04X"), c);
+        }
+    }
+    s += wxS(">");
+
+    return s;
+}
+
+// Metrics of one of the standard PDF fonts, in 1/1000 of the font size.
+struct StandardFont
+{
+    const char* name;
+
+    // Widths of the characters in WinAnsiEncoding starting from the space,
+    // or null for Courier fonts, in which all characters have the same width.
+    const wxUint16* widths;
+
+    int ascent;
+    int descent;
+
+    int GetCharWidth(unsigned char c) const
+    {
+        if ( !widths )
+            return 600;
+
+        return c >= 32 ? widths[c - 32] : 0;
+    }
+};
+
+const StandardFont s_standardFonts[] =
+{
+    { "Helvetica",             s_widthsHelvetica,             718, 207 },
+    { "Helvetica-Bold",        s_widthsHelveticaBold,         718, 207 },
+    { "Helvetica-Oblique",     s_widthsHelveticaOblique,      718, 207 },
+    { "Helvetica-BoldOblique", s_widthsHelveticaBoldOblique,  718, 207 },
+    { "Times-Roman",           s_widthsTimesRoman,            683, 217 },
+    { "Times-Bold",            s_widthsTimesBold,             676, 205 },
+    { "Times-Italic",          s_widthsTimesItalic,           683, 205 },
+    { "Times-BoldItalic",      s_widthsTimesBoldItalic,       699, 205 },
+    { "Courier",               nullptr,                       629, 157 },
+    { "Courier-Bold",          nullptr,                       626, 142 },
+    { "Courier-Oblique",       nullptr,                       629, 157 },
+    { "Courier-BoldOblique",   nullptr,                       626, 142 },
+};
+
+// Return the standard PDF font best corresponding to this font.
+const StandardFont& GetStandardFont(const wxFont& font)
+{
+    // Indices of the first font of each family in s_standardFonts, followed
+    // by its bold, italic and bold italic versions.
+    enum { Helvetica = 0, Times = 4, Courier = 8 } family;
+
+    const wxString face = font.GetFaceName().Lower();
+    if ( face.Contains(wxS("courier")) || face.Contains(wxS("mono")) )
+        family = Courier;
+    else if ( face.Contains(wxS("times")) ||
+                (face.Contains(wxS("serif")) && !face.Contains(wxS("sans"))) )
+        family = Times;
+    else if ( !face.empty() )
+        family = Helvetica;
+    else
+    {
+        switch ( font.GetFamily() )
+        {
+            case wxFONTFAMILY_ROMAN:
+            case wxFONTFAMILY_SCRIPT:
+                family = Times;
+                break;
+
+            case wxFONTFAMILY_MODERN:
+            case wxFONTFAMILY_TELETYPE:
+                family = Courier;
+                break;
+
+            default:
+                family = Helvetica;
+        }
+    }
+
+    const bool bold = font.GetWeight() >= wxFONTWEIGHT_SEMIBOLD;
+    const bool italic = font.GetStyle() != wxFONTSTYLE_NORMAL;
+
+    return s_standardFonts[family + (bold ? 1 : 0) + (italic ? 2 : 0)];
+}
+
+// Two independent 64-bit hashes of the image contents, collisions of both of
+// them are not a practical concern.
+class ImageHasher
+{
+public:
+    ImageHasher()
+        : m_hash1(wxULL(0xcbf29ce484222325)),
+          m_hash2(wxULL(0x84222325cbf29ce4))
+    {
+    }
+
+    void Update(const unsigned char* data, size_t len)
+    {
+        wxUint64 h1 = m_hash1,
+                 h2 = m_hash2;
+        for ( size_t n = 0; n < len; n++ )
+        {
+            // FNV-1a.
+            h1 ^= data[n];
+            h1 *= wxULL(0x100000001b3);
+
+            // Multiplicative hash with a different multiplier.
+            h2 = (h2 + data[n]) * wxULL(0x9e3779b97f4a7c15);
+        }
+        m_hash1 = h1;
+        m_hash2 = h2;
+    }
+
+    void Update(int value)
+    {
+        unsigned char buf[4];
+        for ( int n = 0; n < 4; n++ )
+            buf[n] = static_cast<unsigned char>((value >> (8*n)) & 0xff);
+        Update(buf, sizeof(buf));
+    }
+
+    wxUint64 GetHash1() const { return m_hash1; }
+    wxUint64 GetHash2() const { return m_hash2 ^ (m_hash2 >> 29); }
+
+private:
+    wxUint64 m_hash1;
+    wxUint64 m_hash2;
+};
+
+// Reserved object numbers, the objects 2 and 3 are written at the end, when
+// all pages and resources are known.
+enum
+{
+    PDF_OBJ_CATALOG = 1,
+    PDF_OBJ_PAGES,
+    PDF_OBJ_RESOURCES,
+    PDF_OBJ_INFO,
+    PDF_OBJ_FIRST_FREE
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------
+// wxPDFFileDC
+// ----------------------------------------------------------
+
+wxIMPLEMENT_ABSTRACT_CLASS(wxPDFFileDC, wxDC);
+
+// ----------------------------------------------------------
+// wxPDFFileDCImpl
+// ----------------------------------------------------------
+
+wxIMPLEMENT_ABSTRACT_CLASS(wxPDFFileDCImpl, wxDCImpl);
+
+wxPDFFileDCImpl::wxPDFFileDCImpl(wxPDFFileDC* owner, const wxString& filename,
+                                 int width, int height, double dpi,
+                                 const wxString& title)
+    : wxDCImpl(owner)
+{
+    Init(filename, width, height, dpi, title);
+}
+
+void wxPDFFileDCImpl::Init(const wxString& filename, int width, int height,
+                           double dpi, const wxString& title)
+{
+    m_width = width;
+    m_height = height;
+
+    m_dpi = dpi;
+
+    m_mm_to_pix_x = dpi / 25.4;
+    m_mm_to_pix_y = dpi / 25.4;
+
+    m_backgroundBrush = *wxTRANSPARENT_BRUSH;
+    m_textForegroundColour = *wxBLACK;
+    m_textBackgroundColour = *wxWHITE;
+
+    m_pen = *wxBLACK_PEN;
+    m_font = *wxNORMAL_FONT;
+    m_brush = *wxWHITE_BRUSH;
+
+    m_filename = filename;
+    m_title = title;
+
+    m_pageOpen = false;
+    m_docEnded = false;
+    m_shadingCount = 0;
+    m_clipNestingLevel = 0;
+
+    m_penApplied = false;
+    m_brushApplied = false;
+    m_strokeAlpha = -1;
+    m_fillAlpha = -1;
+    m_currentFontSize = 0;
+
+    m_offsets.assign(PDF_OBJ_FIRST_FREE, 0);
+
+    if ( m_filename.empty() )
+        m_outfile.reset();
+    else
+        m_outfile.reset(new wxFileOutputStream(m_filename));
+
+    m_OK = m_outfile && m_outfile->IsOk();
+    if ( !m_OK )
+        return;
+
+    // The second line contains some binary characters to indicate that the
+    // file is binary, as recommended by the PDF specification.
+    static const char header[] = "%PDF-1.4\n%\xe2\xe3\xcf\xd3\n";
+    WriteFile(header, sizeof(header) - 1);
+
+    BeginObject(PDF_OBJ_CATALOG);
+    WriteFile(wxString::Format(wxS("<< /Type /Catalog /Pages %d 0 R >>\nendobj\n"),
+                               PDF_OBJ_PAGES));
+
+    wxString info;
+    info << wxS("<< /Producer ") << UnicodeTextString(wxString(wxS("wxWidgets ")) + wxVERSION_NUM_DOT_STRING);
+    if ( !m_title.empty() )
+        info << wxS(" /Title ") << UnicodeTextString(m_title);
+#if wxUSE_DATETIME
+    info << wxS(" /CreationDate (")
+         << wxDateTime::Now().Format(wxS("D:%Y%m%d%H%M%S")) << wxS(")");
+#endif // wxUSE_DATETIME
+    info << wxS(" >>\nendobj\n");
+
+    BeginObject(PDF_OBJ_INFO);
+    WriteFile(info);
+}
+
+wxPDFFileDCImpl::~wxPDFFileDCImpl()
+{
+    DoEndDoc();
+}
+
+// ----------------------------------------------------------
+// Output helpers
+// ----------------------------------------------------------
+
+void wxPDFFileDCImpl::WriteFile(const char* data, size_t len)
+{
+    if ( !m_outfile )
+        return;
+
+    m_outfile->Write(data, len);
+    if ( !m_outfile->IsOk() )
+        m_OK = false;
+}
+
+void wxPDFFileDCImpl::WriteFile(const wxString& s)
+{
+    const wxScopedCharBuffer buf = s.utf8_str();
+    WriteFile(buf.data(), buf.length());
+}
+
+void wxPDFFileDCImpl::Emit(const char* data, size_t len)
+{
+    wxCHECK_RET( !m_docEnded, wxS("can't draw after the end of the document") );
+
+    if ( !m_OK )
+        return;
+
+    EnsurePage();
+
+    m_pageStream->Write(data, len);
+}
+
+void wxPDFFileDCImpl::Emit(const wxString& s)
+{
+    // All operators we generate are ASCII, the text is emitted separately.
+    const wxScopedCharBuffer buf = s.utf8_str();
+    Emit(buf.data(), buf.length());
+}
+
+int wxPDFFileDCImpl::NewObject()
+{
+    m_offsets.push_back(0);
+    return static_cast<int>(m_offsets.size() - 1);
+}
+
+void wxPDFFileDCImpl::BeginObject(int obj)
+{
+    if ( !m_outfile )
+        return;
+
+    m_offsets[obj] = m_outfile->TellO();
+    WriteFile(wxString::Format(wxS("%d 0 obj\n"), obj));
+}
+
+void wxPDFFileDCImpl::WriteStreamObject(int obj, const wxString& dict,
+                                        const unsigned char* data, size_t len)
+{
+    if ( !m_OK )
+        return;
+
+    // Compress the data directly into the file, without buffering it in
+    // memory, and write its length, which is unknown in advance, as a
+    // separate object.
+    const int lengthObj = NewObject();
+
+    BeginObject(obj);
+    WriteFile(wxString::Format(wxS("%s /Filter /FlateDecode /Length %d 0 R >>\nstream\n"),
+                               dict, lengthObj));
+
+    const wxFileOffset start = m_outfile->TellO();
+    {
+        wxZlibOutputStream zstream(*m_outfile, wxZ_DEFAULT_COMPRESSION, wxZLIB_ZLIB);
+        zstream.Write(data, len);
+        zstream.Close();
+    }
+    const wxFileOffset length = m_outfile->TellO() - start;
+
+    WriteFile(wxS("\nendstream\nendobj\n"));
+
+    BeginObject(lengthObj);
+    WriteFile(wxString::Format(wxS("%lld\nendobj\n"), static_cast<long long>(length)));
+}
+
+// ----------------------------------------------------------
+// Document and pages
+// ----------------------------------------------------------
+
+bool wxPDFFileDCImpl::StartDoc(const wxString& WXUNUSED(message))
+{
+    // The document header is written by the ctor already.
+    return m_OK && !m_docEnded;
+}
+
+void wxPDFFileDCImpl::EndDoc()
+{
+    DoEndDoc();
+}
+
+void wxPDFFileDCImpl::StartPage()
+{
+    wxCHECK_RET( !m_docEnded, wxS("can't start a page after the end of the document") );
+
+    if ( m_pageOpen )
+        EndPage();
+
+    m_pageBuffer.reset(new wxMemoryOutputStream);
+    m_pageStream.reset(new wxZlibOutputStream(*m_pageBuffer,
+                                              wxZ_DEFAULT_COMPRESSION,
+                                              wxZLIB_ZLIB));
+    m_pageOpen = true;
+
+    m_penApplied = false;
+    m_brushApplied = false;
+    m_fillColour = wxColour();
+    m_strokeAlpha = -1;
+    m_fillAlpha = -1;
+    m_currentFont.clear();
+    m_currentFontSize = 0;
+
+    // Map the device pixels to PDF points and flip the y axis to make it go
+    // downwards, as in wxDC.
+    const double scale = 72.0 / m_dpi;
+    Emit(wxString::Format(wxS("%s 0 0 %s 0 %s cm\n"),
+                          NumStr(scale), NumStr(-scale),
+                          NumStr(m_height * scale)));
+}
+
+void wxPDFFileDCImpl::EndPage()
+{
+    if ( !m_pageOpen )
+        return;
+
+    // Restore the graphics state saved by the clipping functions, just as
+    // content streams must be balanced.
+    if ( m_clipNestingLevel )
+    {
+        wxString s;
+        for ( ; m_clipNestingLevel; m_clipNestingLevel-- )
+            s += wxS("Q\n");
+        Emit(s);
+
+        wxDCImpl::DestroyClippingRegion();
+    }
+
+    m_pageStream->Close();
+    m_pageStream.reset();
+    m_pageOpen = false;
+
+    const size_t length = m_pageBuffer->GetSize();
+    wxStreamBuffer* const buffer = m_pageBuffer->GetOutputStreamBuffer();
+
+    const int contentsObj = NewObject();
+    BeginObject(contentsObj);
+    WriteFile(wxString::Format(wxS("<< /Filter /FlateDecode /Length %zu >>\nstream\n"),
+                               length));
+    WriteFile(static_cast<const char*>(buffer->GetBufferStart()), length);
+    WriteFile(wxS("\nendstream\nendobj\n"));
+
+    m_pageBuffer.reset();
+
+    const double scale = 72.0 / m_dpi;
+
+    const int pageObj = NewObject();
+    BeginObject(pageObj);
+    WriteFile(wxString::Format(wxS("<< /Type /Page /Parent %d 0 R /MediaBox [0 0 %s %s] ")
+                               wxS("/Resources %d 0 R /Contents %d 0 R >>\nendobj\n"),
+                               PDF_OBJ_PAGES,
+                               NumStr(m_width * scale), NumStr(m_height * scale),
+                               PDF_OBJ_RESOURCES, contentsObj));
+
+    m_pages.push_back(pageObj);
+}
+
+void wxPDFFileDCImpl::EnsurePage()
+{
+    if ( !m_pageOpen )
+        StartPage();
+}
+
+void wxPDFFileDCImpl::DoEndDoc()
+{
+    if ( m_docEnded )
+        return;
+
+    // A valid PDF document must have at least one page.
+    if ( m_pageOpen || m_pages.empty() )
+    {
+        EnsurePage();
+        EndPage();
+    }
+
+    m_docEnded = true;
+
+    if ( !m_OK )
+        return;
+
+    wxString s;
+    for ( size_t n = 0; n < m_pages.size(); n++ )
+        s << m_pages[n] << wxS(" 0 R ");
+
+    BeginObject(PDF_OBJ_PAGES);
+    WriteFile(wxString::Format(wxS("<< /Type /Pages /Kids [%s] /Count %zu >>\nendobj\n"),
+                               s, m_pages.size()));
+
+    s = wxS("<< /ProcSet [/PDF /Text /ImageB /ImageC]");
+    if ( !m_fontResources.empty() )
+        s << wxS("\n/Font << ") << m_fontResources << wxS(">>");
+    if ( !m_imageResources.empty() )
+        s << wxS("\n/XObject << ") << m_imageResources << wxS(">>");
+    if ( !m_stateResources.empty() )
+        s << wxS("\n/ExtGState << ") << m_stateResources << wxS(">>");
+    if ( !m_shadingResources.empty() )
+        s << wxS("\n/Shading << ") << m_shadingResources << wxS(">>");
+    s << wxS(" >>\nendobj\n");
+
+    BeginObject(PDF_OBJ_RESOURCES);
+    WriteFile(s);
+
+    const wxFileOffset xref = m_outfile->TellO();
+
+    s.clear();
+    s << wxS("xref\n0 ") << m_offsets.size() << wxS("\n0000000000 65535 f \n");
+    for ( size_t n = 1; n < m_offsets.size(); n++ )
+    {
+        s += wxString::Format(wxS("%010lld 00000 n \n"),
+                              static_cast<long long>(m_offsets[n]));
+    }
+
+    s << wxString::Format(wxS("trailer\n<< /Size %zu /Root %d 0 R /Info %d 0 R >>\n"),
+                          m_offsets.size(), PDF_OBJ_CATALOG, PDF_OBJ_INFO)
+      << wxString::Format(wxS("startxref\n%lld\n%%%%EOF\n"),
+                          static_cast<long long>(xref));
+    WriteFile(s);
+
+    m_outfile->Close();
+    if ( !m_outfile->IsOk() )
+        m_OK = false;
+}
+
+// ----------------------------------------------------------
+// Resources
+// ----------------------------------------------------------
+
+wxString wxPDFFileDCImpl::GetFontResource(const wxFont& font)
+{
+    const wxString baseFont = GetStandardFont(font).name;
+
+    std::map<wxString, wxString>::const_iterator it = m_fonts.find(baseFont);
+    if ( it != m_fonts.end() )
+        return it->second;
+
+    const wxString name = wxString::Format(wxS("F%zu"), m_fonts.size() + 1);
+
+    const int obj = NewObject();
+    BeginObject(obj);
+    WriteFile(wxString::Format(wxS("<< /Type /Font /Subtype /Type1 /BaseFont /%s ")
+                               wxS("/Encoding /WinAnsiEncoding >>\nendobj\n"),
+                               baseFont));
+
+    m_fontResources << wxS("/") << name << wxS(" ") << obj << wxS(" 0 R ");
+    m_fonts[baseFont] = name;
+
+    return name;
+}
+
+wxString wxPDFFileDCImpl::GetAlphaResource(bool stroke, unsigned char alpha)
+{
+    const int key = (stroke ? 256 : 0) + alpha;
+
+    std::map<int, wxString>::const_iterator it = m_alphaStates.find(key);
+    if ( it != m_alphaStates.end() )
+        return it->second;
+
+    const wxString name = wxString::Format(wxS("GS%zu"), m_alphaStates.size() + 1);
+
+    const int obj = NewObject();
+    BeginObject(obj);
+    WriteFile(wxString::Format(wxS("<< /Type /ExtGState /%s %s >>\nendobj\n"),
+                               stroke ? wxS("CA") : wxS("ca"),
+                               NumStr(alpha / 255.0)));
+
+    m_stateResources << wxS("/") << name << wxS(" ") << obj << wxS(" 0 R ");
+    m_alphaStates[key] = name;
+
+    return name;
+}
+
+wxString wxPDFFileDCImpl::AddShading(const wxString& dict)
+{
+    const wxString name = wxString::Format(wxS("Sh%d"), ++m_shadingCount);
+
+    const int obj = NewObject();
+    BeginObject(obj);
+    WriteFile(dict + wxS("\nendobj\n"));
+
+    m_shadingResources << wxS("/") << name << wxS(" ") << obj << wxS(" 0 R ");
+
+    return name;
+}
+
+wxString wxPDFFileDCImpl::GetImageResource(const wxImage& image)
+{
+    const int w = image.GetWidth();
+    const int h = image.GetHeight();
+    const size_t numPixels = static_cast<size_t>(w) * h;
+    const unsigned char* const alpha = image.GetAlpha();
+
+    // Check if we had already written exactly the same image.
+    ImageHasher hasher;
+    hasher.Update(w);
+    hasher.Update(h);
+    hasher.Update(image.GetData(), 3*numPixels);
+    if ( alpha )
+        hasher.Update(alpha, numPixels);
+
+    ImageKey key;
+    key.hash1 = hasher.GetHash1();
+    key.hash2 = hasher.GetHash2();
+
+    std::map<ImageKey, wxString>::const_iterator it = m_images.find(key);
+    if ( it != m_images.end() )
+        return it->second;
+
+    const wxString name = wxString::Format(wxS("Im%zu"), m_images.size() + 1);
+
+    wxString dict = wxString::Format(wxS("<< /Type /XObject /Subtype /Image ")
+                                     wxS("/Width %d /Height %d /BitsPerComponent 8"),
+                                     w, h);
+
+    if ( alpha )
+    {
+        const int maskObj = NewObject();
+        WriteStreamObject(maskObj, dict + wxS(" /ColorSpace /DeviceGray"),
+                          alpha, numPixels);
+
+        dict << wxS(" /SMask ") << maskObj << wxS(" 0 R");
+    }
+
+    const int obj = NewObject();
+    WriteStreamObject(obj, dict + wxS(" /ColorSpace /DeviceRGB"),
+                      image.GetData(), 3*numPixels);
+
+    m_imageResources << wxS("/") << name << wxS(" ") << obj << wxS(" 0 R ");
+    m_images[key] = name;
+
+    return name;
+}
+
+// ----------------------------------------------------------
+// Graphics state
+// ----------------------------------------------------------
+
+void wxPDFFileDCImpl::SetPen(const wxPen& pen)
+{
+    m_pen = pen;
+    m_penApplied = false;
+}
+
+void wxPDFFileDCImpl::SetBrush(const wxBrush& brush)
+{
+    m_brush = brush;
+    m_brushApplied = false;
+}
+
+void wxPDFFileDCImpl::SetBackground(const wxBrush& brush)
+{
+    m_backgroundBrush = brush;
+}
+
+void wxPDFFileDCImpl::SetBackgroundMode(int mode)
+{
+    m_backgroundMode = mode;
+}
+
+void wxPDFFileDCImpl::SetFont(const wxFont& font)
+{
+    m_font = font;
+}
+
+void wxPDFFileDCImpl::ApplyAlpha(bool stroke, unsigned char alpha)
+{
+    int& current = stroke ? m_strokeAlpha : m_fillAlpha;
+    if ( current == alpha )
+        return;
+
+    current = alpha;
+    Emit(wxString::Format(wxS("/%s gs\n"), GetAlphaResource(stroke, alpha)));
+}
+
+void wxPDFFileDCImpl::ApplyFillColour(const wxColour& colour)
+{
+    ApplyAlpha(false, colour.Alpha());
+
+    if ( colour == m_fillColour )
+        return;
+
+    m_fillColour = colour;
+    m_brushApplied = false;
+    Emit(ColourStr(colour) + wxS(" rg\n"));
+}
+
+void wxPDFFileDCImpl::ApplyBrush()
+{
+    if ( m_brushApplied )
+        return;
+
+    // Hatched and stippled brushes are drawn as solid ones.
+    ApplyFillColour(m_brush.GetColour());
+    m_brushApplied = true;
+}
+
+void wxPDFFileDCImpl::ApplyPen()
+{
+    if ( m_penApplied )
+        return;
+
+    m_penApplied = true;
+
+    const wxColour& colour = m_pen.GetColour();
+    ApplyAlpha(true, colour.Alpha());
+
+    const double width = wxMax(1.0, XLOG2DEVREL(m_pen.GetWidth()));
+
+    wxString s;
+    s << ColourStr(colour) << wxS(" RG ") << NumStr(width) << wxS(" w ");
+
+    switch ( m_pen.GetCap() )
+    {
+        case wxCAP_BUTT:
+            s << wxS("0 J ");
+            break;
+
+        case wxCAP_PROJECTING:
+            s << wxS("2 J ");
+            break;
+
+        default:
+            s << wxS("1 J ");
+    }
+
+    switch ( m_pen.GetJoin() )
+    {
+        case wxJOIN_MITER:
+            s << wxS("0 j ");
+            break;
+
+        case wxJOIN_BEVEL:
+            s << wxS("2 j ");
+            break;
+
+        default:
+            s << wxS("1 j ");
+    }
+
+    // Dash lengths are expressed in the units of the pen width.
+    std::vector<double> dashes;
+    switch ( m_pen.GetStyle() )
+    {
+        case wxPENSTYLE_DOT:
+            dashes.push_back(1);
+            dashes.push_back(1);
+            break;
+
+        case wxPENSTYLE_LONG_DASH:
+            dashes.push_back(4);
+            dashes.push_back(2);
+            break;
+
+        case wxPENSTYLE_SHORT_DASH:
+            dashes.push_back(2);
+            dashes.push_back(2);
+            break;
+
+        case wxPENSTYLE_DOT_DASH:
+            dashes.push_back(4);
+            dashes.push_back(2);
+            dashes.push_back(1);
+            dashes.push_back(2);
+            break;
+
+        case wxPENSTYLE_USER_DASH:
+            {
+                wxDash* userDashes = nullptr;
+                const int count = m_pen.GetDashes(&userDashes);
+                for ( int n = 0; n < count; n++ )
+                    dashes.push_back(userDashes[n]);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    s << wxS("[");
+    for ( size_t n = 0; n < dashes.size(); n++ )
+        s << NumStr(dashes[n]*width) << wxS(" ");
+    s << wxS("] 0 d\n");
+
+    Emit(s);
+}
+
+const char* wxPDFFileDCImpl::GetPaintOperator(bool closed, bool evenOdd)
+{
+    const bool stroke = m_pen.IsNonTransparent();
+    const bool fill = closed && m_brush.IsNonTransparent();
+
+    if ( stroke )
+        ApplyPen();
+    if ( fill )
+        ApplyBrush();
+
+    if ( stroke && fill )
+        return evenOdd ? "b*\n" : "b\n";
+    if ( stroke )
+        return closed ? "s\n" : "S\n";
+    if ( fill )
+        return evenOdd ? "f*\n" : "f\n";
+
+    return nullptr;
+}
+
+// ----------------------------------------------------------
+// Drawing
+// ----------------------------------------------------------
+
+void wxPDFFileDCImpl::Clear()
+{
+    if ( !m_backgroundBrush.IsNonTransparent() )
+        return;
+
+    ApplyFillColour(m_backgroundBrush.GetColour());
+    Emit(wxString::Format(wxS("0 0 %d %d re f\n"), m_width, m_height));
+}
+
+void wxPDFFileDCImpl::DoDrawLine(wxCoord x1, wxCoord y1, wxCoord x2, wxCoord y2)
+{
+    const char* const op = GetPaintOperator(false);
+    if ( op )
+    {
+        Emit(PointStr(XLOG2DEV(x1), YLOG2DEV(y1)) + wxS(" m ") +
+             PointStr(XLOG2DEV(x2), YLOG2DEV(y2)) + wxS(" l ") + op);
+    }
+
+    CalcBoundingBox(x1, y1, x2, y2);
+}
+
+void wxPDFFileDCImpl::DoDrawLines(int n, const wxPoint points[],
+                                  wxCoord xoffset, wxCoord yoffset)
+{
+    if ( n <= 0 )
+        return;
+
+    const char* const op = GetPaintOperator(false);
+
+    wxString s;
+    for ( int i = 0; i < n; i++ )
+    {
+        const wxCoord x = points[i].x + xoffset;
+        const wxCoord y = points[i].y + yoffset;
+
+        s << PointStr(XLOG2DEV(x), YLOG2DEV(y)) << (i ? wxS(" l\n") : wxS(" m\n"));
+
+        CalcBoundingBox(x, y);
+    }
+
+    if ( op )
+        Emit(s + op);
+}
+
+void wxPDFFileDCImpl::DoDrawPoint(wxCoord x, wxCoord y)
+{
+    if ( !m_pen.IsNonTransparent() )
+        return;
+
+    // Draw a single pixel square using the pen colour.
+    ApplyFillColour(m_pen.GetColour());
+    Emit(PointStr(XLOG2DEV(x), YLOG2DEV(y)) + wxS(" 1 1 re f\n"));
+
+    CalcBoundingBox(x, y);
+}
+
+void wxPDFFileDCImpl::DoDrawPolygon(int n, const wxPoint points[],
+                                    wxCoord xoffset, wxCoord yoffset,
+                                    wxPolygonFillMode fillStyle)
+{
+    DoDrawPolyPolygon(1, &n, points, xoffset, yoffset, fillStyle);
+}
+
+void wxPDFFileDCImpl::DoDrawPolyPolygon(int n, const int count[],
+                                        const wxPoint points[],
+                                        wxCoord xoffset, wxCoord yoffset,
+                                        wxPolygonFillMode fillStyle)
+{
+    const char* const op = GetPaintOperator(true, fillStyle == wxODDEVEN_RULE);
+
+    wxString s;
+    int ofs = 0;
+    for ( int i = 0; i < n; ofs += count[i++] )
+    {
+        for ( int j = 0; j < count[i]; j++ )
+        {
+            const wxCoord x = points[ofs + j].x + xoffset;
+            const wxCoord y = points[ofs + j].y + yoffset;
+
+            s << PointStr(XLOG2DEV(x), YLOG2DEV(y)) << (j ? wxS(" l\n") : wxS(" m\n"));
+
+            CalcBoundingBox(x, y);
+        }
+
+        s << wxS("h\n");
+    }
+
+    if ( op )
+        Emit(s + op);
+}
+
+void wxPDFFileDCImpl::DoDrawRectangle(wxCoord x, wxCoord y,
+                                      wxCoord width, wxCoord height)
+{
+    const char* const op = GetPaintOperator(true);
+    if ( op )
+    {
+        Emit(PointStr(XLOG2DEV(x), YLOG2DEV(y)) + wxS(" ") +
+             PointStr(XLOG2DEVREL(width), YLOG2DEVREL(height)) + wxS(" re ") + op);
+    }
+
+    CalcBoundingBox(x, y, x + width, y + height);
+}
+
+void wxPDFFileDCImpl::DoDrawRoundedRectangle(wxCoord x, wxCoord y,
+                                             wxCoord width, wxCoord height,
+                                             double radius)
+{
+    if ( radius < 0.0 )
+    {
+        // Negative radius means proportion of the smallest dimension.
+        radius = -radius * wxMin(width, height);
+    }
+
+    const double w = XLOG2DEVREL(width);
+    const double h = YLOG2DEVREL(height);
+    const double r = wxMin(XLOG2DEVREL(wxRound(radius)),
+                           wxMin(fabs(w), fabs(h)) / 2);
+    if ( r <= 0 )
+    {
+        DoDrawRectangle(x, y, width, height);
+        return;
+    }
+
+    const char* const op = GetPaintOperator(true);
+    if ( op )
+    {
+        const double left = XLOG2DEV(x);
+        const double top = YLOG2DEV(y);
+        const double right = left + w;
+        const double bottom = top + h;
+
+        wxString s;
+        s << PointStr(left + r, top) << wxS(" m\n")
+          << PointStr(right - r, top) << wxS(" l\n");
+        AppendEllipticArc(s, right - r, top + r, r, r, 90, 0, false);
+        s << PointStr(right, bottom - r) << wxS(" l\n");
+        AppendEllipticArc(s, right - r, bottom - r, r, r, 0, -90, false);
+        s << PointStr(left + r, bottom) << wxS(" l\n");
+        AppendEllipticArc(s, left + r, bottom - r, r, r, -90, -180, false);
+        s << PointStr(left, top + r) << wxS(" l\n");
+        AppendEllipticArc(s, left + r, top + r, r, r, 180, 90, false);
+        s << wxS("h\n");
+
+        Emit(s + op);
+    }
+
+    CalcBoundingBox(x, y, x + width, y + height);
+}
+
+void wxPDFFileDCImpl::AppendEllipticArc(wxString& s,
+                                        double cx, double cy,
+                                        double rx, double ry,
+                                        double sa, double ea,
+                                        bool moveTo) const
+{
+    // Angles are counter-clockwise, as seen on the screen, i.e. with the y
+    // axis going down, and are split in parts of at most 90 degrees each, as
+    // a single Bezier curve can't approximate a bigger arc well enough.
+    const int parts = wxMax(1, static_cast<int>(ceil(fabs(ea - sa) / 90.0 - 1e-9)));
+    const double delta = wxDegToRad(ea - sa) / parts;
+    const double k = 4.0 / 3.0 * tan(delta / 4);
+
+    double a = wxDegToRad(sa);
+    double x1 = cx + rx*cos(a),
+           y1 = cy - ry*sin(a);
+
+    if ( moveTo )
+        s << PointStr(x1, y1) << wxS(" m\n");
+
+    for ( int n = 0; n < parts; n++ )
+    {
+        const double a2 = a + delta;
+        const double x2 = cx + rx*cos(a2),
+                     y2 = cy - ry*sin(a2);
+
+        s << PointStr(x1 - k*rx*sin(a), y1 - k*ry*cos(a)) << wxS(" ")
+          << PointStr(x2 + k*rx*sin(a2), y2 + k*ry*cos(a2)) << wxS(" ")
+          << PointStr(x2, y2) << wxS(" c\n");
+
+        a = a2;
+        x1 = x2;
+        y1 = y2;
+    }
+}
+
+void wxPDFFileDCImpl::DoDrawEllipse(wxCoord x, wxCoord y,
+                                    wxCoord width, wxCoord height)
+{
+    const char* const op = GetPaintOperator(true);
+    if ( op )
+    {
+        const double rx = XLOG2DEVREL(width) / 2;
+        const double ry = YLOG2DEVREL(height) / 2;
+
+        wxString s;
+        AppendEllipticArc(s, XLOG2DEV(x) + rx, YLOG2DEV(y) + ry,
+                          rx, ry, 0, 360, true);
+        s << wxS("h\n");
+
+        Emit(s + op);
+    }
+
+    CalcBoundingBox(x, y, x + width, y + height);
+}
+
+void wxPDFFileDCImpl::DoDrawEllipticArc(wxCoord x, wxCoord y,
+                                        wxCoord w, wxCoord h,
+                                        double sa, double ea)
+{
+    // If start is equal to end, a complete ellipse is drawn.
+    if ( sa == ea )
+    {
+        DoDrawEllipse(x, y, w, h);
+        return;
+    }
+
+    while ( ea < sa )
+        ea += 360;
+
+    const double rx = XLOG2DEVREL(w) / 2;
+    const double ry = YLOG2DEVREL(h) / 2;
+    const double cx = XLOG2DEV(x) + rx;
+    const double cy = YLOG2DEV(y) + ry;
+
+    wxString arc;
+    AppendEllipticArc(arc, cx, cy, rx, ry, sa, ea, true);
+
+    // As in the other ports, the brush is used for the pie but the pen only
+    // for the arc itself, without the lines to the centre.
+    if ( m_brush.IsNonTransparent() )
+    {
+        ApplyBrush();
+        Emit(arc + PointStr(cx, cy) + wxS(" l h f\n"));
+    }
+
+    if ( m_pen.IsNonTransparent() )
+    {
+        ApplyPen();
+        Emit(arc + wxS("S\n"));
+    }
+
+    CalcBoundingBox(x, y, x + w, y + h);
+}
+
+void wxPDFFileDCImpl::DoDrawArc(wxCoord x1, wxCoord y1,
+                                wxCoord x2, wxCoord y2,
+                                wxCoord xc, wxCoord yc)
+{
+    const double dx1 = x1 - xc,
+                 dy1 = y1 - yc;
+    const double radius = sqrt(dx1*dx1 + dy1*dy1);
+
+    double sa, ea;
+    if ( x1 == x2 && y1 == y2 )
+    {
+        // Full circle.
+        sa = 0;
+        ea = 360;
+    }
+    else
+    {
+        sa = wxRadToDeg(atan2(double(yc - y1), double(x1 - xc)));
+        ea = wxRadToDeg(atan2(double(yc - y2), double(x2 - xc)));
+        while ( ea <= sa )
+            ea += 360;
+    }
+
+    const double cx = XLOG2DEV(xc);
+    const double cy = YLOG2DEV(yc);
+    const double rx = XLOG2DEVREL(wxRound(radius));
+    const double ry = YLOG2DEVREL(wxRound(radius));
+
+    wxString s;
+    AppendEllipticArc(s, cx, cy, rx, ry, sa, ea, true);
+
+    // Draw the lines to the centre only if the pie is filled.
+    const bool closed = m_brush.IsNonTransparent();
+    if ( closed )
+        s << PointStr(cx, cy) << wxS(" l\n");
+
+    const char* const op = GetPaintOperator(closed);
+    if ( op )
+        Emit(s + op);
+
+    const wxCoord r = wxRound(radius);
+    CalcBoundingBox(xc - r, yc - r, xc + r, yc + r);
+}
+
+void wxPDFFileDCImpl::DoDrawText(const wxString& text, wxCoord x, wxCoord y)
+{
+    DoDrawRotatedText(text, x, y, 0.0);
+}
+
+void wxPDFFileDCImpl::DoDrawRotatedText(const wxString& text,
+                                        wxCoord x, wxCoord y,
+                                        double angle)
+{
+    if ( text.empty() )
+        return;
+
+    wxCoord w, h, heightLine;
+    GetOwner()->GetMultiLineTextExtent(text, &w, &h, &heightLine);
+
+    const double rad = wxDegToRad(angle);
+    const double sinA = sin(rad);
+    const double cosA = cos(rad);
+
+    CalcBoundingBox(x, y);
+    CalcBoundingBox(wxRound(x + w * cosA), wxRound(y - w * sinA));
+    CalcBoundingBox(wxRound(x + h * sinA), wxRound(y + h * cosA));
+    CalcBoundingBox(wxRound(x + h * sinA + w * cosA), wxRound(y + h * cosA - w * sinA));
+
+    // The font size in device units, the text extent is already expressed in
+    // them, as DoGetTextExtent() uses the same size.
+    const double fontSize = m_font.GetFractionalPointSize() * m_dpi / 72.0
+                                * fabs(m_scaleY);
+
+    const wxString font = GetFontResource(m_font);
+    if ( font != m_currentFont || fontSize != m_currentFontSize )
+    {
+        m_currentFont = font;
+        m_currentFontSize = fontSize;
+        Emit(wxString::Format(wxS("/%s %s Tf\n"), font, NumStr(fontSize)));
+    }
+
+    const wxArrayString lines = wxSplit(text, '\n', '\0');
+    for ( size_t lineNum = 0; lineNum < lines.size(); lineNum++ )
+    {
+        const wxString& line = lines[lineNum];
+
+        // Top left corner of this line and its baseline origin.
+        const double xRect = x + lineNum * heightLine * sinA;
+        const double yRect = y + lineNum * heightLine * cosA;
+
+        wxCoord ww, hh, desc;
+        DoGetTextExtent(line, &ww, &hh, &desc);
+
+        const double xText = xRect + (hh - desc) * sinA;
+        const double yText = yRect + (hh - desc) * cosA;
+
+        // Compute the device coordinates of the corners of the line.
+        const double dx = XLOG2DEV(wxRound(xRect));
+        const double dy = YLOG2DEV(wxRound(yRect));
+        const double bx = XLOG2DEV(wxRound(xText));
+        const double by = YLOG2DEV(wxRound(yText));
+        const double dw = XLOG2DEVREL(ww);
+        const double dh = YLOG2DEVREL(hh);
+
+        if ( m_backgroundMode == wxBRUSHSTYLE_SOLID )
+        {
+            ApplyFillColour(m_textBackgroundColour);
+
+            wxString s;
+            s << PointStr(dx, dy) << wxS(" m ")
+              << PointStr(dx + dw*cosA, dy - dw*sinA) << wxS(" l ")
+              << PointStr(dx + dw*cosA + dh*sinA, dy - dw*sinA + dh*cosA) << wxS(" l ")
+              << PointStr(dx + dh*sinA, dy + dh*cosA) << wxS(" l h f\n");
+            Emit(s);
+        }
+
+        ApplyFillColour(m_textForegroundColour);
+
+        Emit(wxString::Format(wxS("BT %s %s %s %s %s Tm "),
+                              NumStr(cosA), NumStr(-sinA),
+                              NumStr(-sinA), NumStr(-cosA),
+                              PointStr(bx, by)));
+
+        const std::string literal = TextLiteral(line);
+        Emit(literal.data(), literal.length());
+        Emit(" Tj ET\n", 7);
+
+        if ( m_font.GetUnderlined() || m_font.GetStrikethrough() )
+        {
+            // Draw the decoration lines using the text colour, without
+            // changing the current pen state.
+            const double thickness = wxMax(1.0, fontSize / 15);
+
+            wxString s;
+            s << wxS("q ") << ColourStr(m_textForegroundColour) << wxS(" RG ")
+              << NumStr(thickness) << wxS(" w 0 J [] 0 d\n");
+
+            if ( m_font.GetUnderlined() )
+            {
+                const double ofs = YLOG2DEVREL(desc) / 2;
+                s << PointStr(bx + ofs*sinA, by + ofs*cosA) << wxS(" m ")
+                  << PointStr(bx + ofs*sinA + dw*cosA, by + ofs*cosA - dw*sinA)
+                  << wxS(" l S\n");
+            }
+
+            if ( m_font.GetStrikethrough() )
+            {
+                const double ofs = -fontSize / 3;
+                s << PointStr(bx + ofs*sinA, by + ofs*cosA) << wxS(" m ")
+                  << PointStr(bx + ofs*sinA + dw*cosA, by + ofs*cosA - dw*sinA)
+                  << wxS(" l S\n");
+            }
+
+            s << wxS("Q\n");
+            Emit(s);
+        }
+    }
+}
+
+void wxPDFFileDCImpl::DoDrawBitmap(const wxBitmap& bmp, wxCoord x, wxCoord y,
+                                   bool useMask)
+{
+    wxCHECK_RET( bmp.IsOk(), wxS("invalid bitmap") );
+
+    wxImage image = bmp.ConvertToImage();
+    if ( image.HasMask() )
+    {
+        if ( useMask )
+            image.InitAlpha();
+        else
+            image.SetMask(false);
+    }
+
+    const wxString name = GetImageResource(image);
+
+    const wxCoord w = wxRound(bmp.GetLogicalWidth());
+    const wxCoord h = wxRound(bmp.GetLogicalHeight());
+    const double dw = XLOG2DEVREL(w);
+    const double dh = YLOG2DEVREL(h);
+
+    // The image is drawn in the unit square with its first row at the top,
+    // i.e. at y = 1, so map it to the bitmap rectangle inverting the y axis
+    // back to its normal direction.
+    Emit(wxString::Format(wxS("q %s 0 0 %s %s cm /%s Do Q\n"),
+                          NumStr(dw), NumStr(-dh),
+                          PointStr(XLOG2DEV(x), YLOG2DEV(y) + dh),
+                          name));
+
+    CalcBoundingBox(wxPoint(x, y), wxSize(w, h));
+}
+
+void wxPDFFileDCImpl::DoDrawIcon(const wxIcon& icon, wxCoord x, wxCoord y)
+{
+    DoDrawBitmap(icon, x, y, true);
+}
+
+bool wxPDFFileDCImpl::DoBlit(wxCoord xdest, wxCoord ydest,
+                             wxCoord width, wxCoord height,
+                             wxDC* source,
+                             wxCoord xsrc, wxCoord ysrc,
+                             wxRasterOperationMode rop,
+                             bool useMask,
+                             wxCoord WXUNUSED(xsrcMask), wxCoord WXUNUSED(ysrcMask))
+{
+    wxCHECK_MSG( rop == wxCOPY, false,
+                 wxS("wxPDFFileDC::DoBlit Call requested nonCopy mode; this is not possible") );
+    wxCHECK_MSG( !useMask, false,
+                 wxS("wxPDFFileDC::DoBlit Call requested mask; this is not possible") );
+
+    wxBitmap bitmap(width, height);
+    wxMemoryDC memDC;
+    memDC.SelectObject(bitmap);
+    memDC.Blit(0, 0, width, height, source, xsrc, ysrc);
+    memDC.SelectObject(wxNullBitmap);
+
+    DoDrawBitmap(bitmap, xdest, ydest);
+
+    return true;
+}
+
+void wxPDFFileDCImpl::DoFillShading(const wxRect& rect, const wxString& shading)
+{
+    Emit(wxString::Format(wxS("q %s %s re W n /%s sh Q\n"),
+                          PointStr(XLOG2DEV(rect.x), YLOG2DEV(rect.y)),
+                          PointStr(XLOG2DEVREL(rect.width), YLOG2DEVREL(rect.height)),
+                          shading));
+
+    CalcBoundingBox(rect);
+}
+
+void wxPDFFileDCImpl::DoGradientFillLinear(const wxRect& rect,
+                                           const wxColour& initialColour,
+                                           const wxColour& destColour,
+                                           wxDirection nDirection)
+{
+    const double left = XLOG2DEV(rect.x);
+    const double top = YLOG2DEV(rect.y);
+    const double right = left + XLOG2DEVREL(rect.width);
+    const double bottom = top + YLOG2DEVREL(rect.height);
+
+    double x1 = left, y1 = top, x2 = right, y2 = top;
+    switch ( nDirection )
+    {
+        case wxWEST:
+            x1 = right;
+            x2 = left;
+            break;
+
+        case wxNORTH:
+            x1 = x2 = left;
+            y1 = bottom;
+            y2 = top;
+            break;
+
+        case wxSOUTH:
+            x1 = x2 = left;
+            y2 = bottom;
+            break;
+
+        default:
+            break;
+    }
+
+    const wxString shading = AddShading(wxString::Format(
+        wxS("<< /ShadingType 2 /ColorSpace /DeviceRGB /Coords [%s %s] ")
+        wxS("/Function << /FunctionType 2 /Domain [0 1] /C0 [%s] /C1 [%s] /N 1 >> ")
+        wxS("/Extend [true true] >>"),
+        PointStr(x1, y1), PointStr(x2, y2),
+        ColourStr(initialColour), ColourStr(destColour)));
+
+    DoFillShading(rect, shading);
+}
+
+void wxPDFFileDCImpl::DoGradientFillConcentric(const wxRect& rect,
+                                               const wxColour& initialColour,
+                                               const wxColour& destColour,
+                                               const wxPoint& circleCenter)
+{
+    // Use the same radius as the generic implementation in wxDCImpl.
+    const double radius = wxMin(rect.width, rect.height) / 2;
+    const double cx = XLOG2DEV(rect.x + circleCenter.x);
+    const double cy = YLOG2DEV(rect.y + circleCenter.y);
+
+    const wxString shading = AddShading(wxString::Format(
+        wxS("<< /ShadingType 3 /ColorSpace /DeviceRGB /Coords [%s 0 %s %s] ")
+        wxS("/Function << /FunctionType 2 /Domain [0 1] /C0 [%s] /C1 [%s] /N 1 >> ")
+        wxS("/Extend [true true] >>"),
+        PointStr(cx, cy), PointStr(cx, cy), NumStr(XLOG2DEVREL(wxRound(radius))),
+        ColourStr(initialColour), ColourStr(destColour)));
+
+    DoFillShading(rect, shading);
+}
+
+// ----------------------------------------------------------
+// Clipping
+// ----------------------------------------------------------
+
+void wxPDFFileDCImpl::DoSetDeviceClippingRegion(const wxRegion& region)
+{
+    const wxRect box = region.GetBox();
+    const wxPoint logPos = DeviceToLogical(box.x, box.y);
+    const wxSize logDim = DeviceToLogicalRel(box.width, box.height);
+    DoSetClippingRegion(logPos.x, logPos.y, logDim.x, logDim.y);
+}
+
+void wxPDFFileDCImpl::DoSetClippingRegion(wxCoord x, wxCoord y,
+                                          wxCoord width, wxCoord height)
+{
+    // Use the standard form of the box, as wxDCImpl expects it.
+    if ( width < 0 )
+    {
+        width = -width;
+        x -= (width - 1);
+    }
+    if ( height < 0 )
+    {
+        height = -height;
+        y -= (height - 1);
+    }
+
+    // Clipping paths are intersected with the current one, as required, and
+    // can only be removed by restoring the previously saved graphics state.
+    Emit(wxString::Format(wxS("q %s %s re W n\n"),
+                          PointStr(XLOG2DEV(x), YLOG2DEV(y)),
+                          PointStr(XLOG2DEVREL(width), YLOG2DEVREL(height))));
+
+    m_clipNestingLevel++;
+
+    wxDCImpl::DoSetClippingRegion(x, y, width, height);
+}
+
+void wxPDFFileDCImpl::DestroyClippingRegion()
+{
+    if ( m_clipNestingLevel )
+    {
+        wxString s;
+        for ( ; m_clipNestingLevel; m_clipNestingLevel-- )
+            s += wxS("Q\n");
+        Emit(s);
+
+        // Restoring the graphics state also restored the attributes which
+        // could have been changed since it had been saved.
+        m_penApplied = false;
+        m_brushApplied = false;
+        m_fillColour = wxColour();
+        m_strokeAlpha = -1;
+        m_fillAlpha = -1;
+        m_currentFont.clear();
+        m_currentFontSize = 0;
+    }
+
+    wxDCImpl::DestroyClippingRegion();
+}
+
+// ----------------------------------------------------------
+// Text metrics and sizes
+// ----------------------------------------------------------
+
+void wxPDFFileDCImpl::DoGetTextExtent(const wxString& string,
+                                      wxCoord* x,
+                                      wxCoord* y,
+                                      wxCoord* descent,
+                                      wxCoord* externalLeading,
+                                      const wxFont* theFont) const
+{
+    // Use the metrics of the standard font used for drawing the text and not
+    // of the font itself, which may be quite different.
+    const wxFont& font = theFont ? *theFont : m_font;
+    const StandardFont& stdFont = GetStandardFont(font);
+
+    // The font size in device units, as in DoDrawRotatedText().
+    const double fontSize = font.GetFractionalPointSize() * m_dpi / 72.0;
+
+    if ( x )
+    {
+        int width = 0;
+        for ( wxString::const_iterator it = string.begin(); it != string.end(); ++it )
+            width += stdFont.GetCharWidth(static_cast<unsigned char>(ToWinAnsi(*it)));
+
+        *x = wxRound(width * fontSize / 1000);
+    }
+
+    if ( y )
+        *y = wxRound((stdFont.ascent + stdFont.descent) * fontSize / 1000);
+
+    if ( descent )
+        *descent = wxRound(stdFont.descent * fontSize / 1000);
+
+    if ( externalLeading )
+        *externalLeading = 0;
+}
+
+wxCoord wxPDFFileDCImpl::GetCharHeight() const
+{
+    wxCoord h;
+    DoGetTextExtent(wxS("x"), nullptr, &h);
+
+    return h;
+}
+
+wxCoord wxPDFFileDCImpl::GetCharWidth() const
+{
+    wxCoord w;
+    DoGetTextExtent(wxS("x"), &w, nullptr);
+
+    return w;
+}
+
+void wxPDFFileDCImpl::DoGetSizeMM(int* width, int* height) const
+{
+    if ( width )
+        *width = wxRound(m_width / m_mm_to_pix_x);
+
+    if ( height )
+        *height = wxRound(m_height / m_mm_to_pix_y);
+}
+
+wxSize wxPDFFileDCImpl::GetPPI() const
+{
+    return wxSize(wxRound(m_dpi), wxRound(m_dpi));
+}
+
+#endif // wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
@@ -44,7 +44,13 @@
 #include "wx/thread.h"
 
 #if wxUSE_BASE
+    #include "wx/private/evtprof.h"
+
+    #include <algorithm>
     #include <memory>
+    #include <new>
+    #include <unordered_map>
+    #include <vector>
 #endif // wxUSE_BASE
 
 #if wxUSE_GUI
@@ -365,6 +371,7 @@ wxEvent::wxEvent(int theId, wxEventType commandType)
     m_propagatedFrom = nullptr;
     m_wasProcessed = false;
     m_willBeProcessedAgain = false;
+    m_nextPending = nullptr;
 }
 
 wxEvent::wxEvent(const wxEvent& src)
@@ -381,6 +388,7 @@ wxEvent::wxEvent(const wxEvent& src)
     , m_isCommandEvent(src.m_isCommandEvent)
     , m_wasProcessed(false)
     , m_willBeProcessedAgain(false)
+    , m_nextPending(nullptr)
 {
 }
 
@@ -408,6 +416,400 @@ wxEvent& wxEvent::operator=(const wxEvent& src)
     return *this;
 }
 
+// ----------------------------------------------------------------------------
+// wxEvent memory pool
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// The sizes of the events allocated from the pool are rounded up to the
+// multiple of this value and the events bigger than the maximal size are
+// allocated directly from the heap.
+const size_t EVENT_POOL_GRANULARITY = 16;
+const size_t EVENT_POOL_MAX_SIZE = 512;
+const size_t EVENT_POOL_NUM_CLASSES = EVENT_POOL_MAX_SIZE / EVENT_POOL_GRANULARITY;
+
+// Number of the free blocks moved at once between the per-thread caches and
+// the shared pool.
+const size_t EVENT_POOL_BATCH_SIZE = 32;
+
+// Maximal number of the free blocks of each size kept in the per-thread cache
+// before moving a batch of them to the shared pool.
+const size_t EVENT_POOL_MAX_CACHED = 2*EVENT_POOL_BATCH_SIZE;
+
+// Maximal number of the batches of the free blocks of each size kept in the
+// shared pool.
+const size_t EVENT_POOL_MAX_BATCHES = 64;
+
+// Free memory block: the first one in a batch also links to the next batch.
+struct wxEventPoolBlock
+{
+    wxEventPoolBlock* next;
+    wxEventPoolBlock* nextBatch;
+};
+
+// List of the free blocks of the same size class.
+struct wxEventPoolList
+{
+    wxEventPoolBlock* head;
+    size_t count;
+};
+
+// Cache of the free blocks used by a single thread without any locking.
+//
+// Notice that this struct must be trivially destructible, as it can be used
+// after the destruction of the thread-local objects, e.g. when deleting the
+// events during the static objects destruction, see wxEventPoolCacheFlusher.
+struct wxEventPoolCache
+{
+    wxEventPoolList lists[EVENT_POOL_NUM_CLASSES];
+
+    // Set when wxEventPoolCacheFlusher for this thread was created.
+    bool registered;
+
+    // Set when the thread is exiting and the cache can't be used any more.
+    bool dead;
+};
+
+thread_local wxEventPoolCache gs_eventPoolCache;
+
+// Set by wxEventPoolModule on shutdown, after which the pool isn't used.
+std::atomic<bool> gs_eventPoolShutdown(false);
+
+// Pool of the memory blocks freed by the deleted events, with a separate
+// list of the free blocks for each size class.
+//
+// Events are typically allocated in one thread and freed in another one, e.g.
+// by CallAfter() and ProcessPendingEvents(), so the blocks are freed into the
+// cache of the current thread and when it becomes too big, a batch of them
+// is moved to the shared pool, from which the threads allocating the events
+// take them when their own cache is empty. This means that the lock is only
+// taken once per batch and not for each event.
+class wxEventPool
+{
+public:
+    wxEventPool()
+    {
+        for ( size_t n = 0; n < EVENT_POOL_NUM_CLASSES; n++ )
+        {
+            m_batches[n] = nullptr;
+            m_numBatches[n] = 0;
+        }
+    }
+
+    void* Alloc(size_t size, bool nothrow)
+    {
+        m_allocations.fetch_add(1, std::memory_order_relaxed);
+
+        if ( size > EVENT_POOL_MAX_SIZE )
+            return DoAlloc(size, nothrow);
+
+        const size_t n = GetClass(size);
+
+        wxEventPoolCache& cache = gs_eventPoolCache;
+        if ( !cache.dead &&
+                !gs_eventPoolShutdown.load(std::memory_order_relaxed) )
+        {
+            wxEventPoolList& list = cache.lists[n];
+            if ( !list.head )
+            {
+                if ( !cache.registered )
+                    RegisterCache(cache);
+
+                TakeBatch(n, list);
+            }
+
+            if ( wxEventPoolBlock* const block = list.head )
+            {
+                list.head = block->next;
+                list.count--;
+
+                m_reused.fetch_add(1, std::memory_order_relaxed);
+                m_pooled.fetch_sub(1, std::memory_order_relaxed);
+
+                return block;
+            }
+        }
+
+        // Allocate the block of the maximal size for this class, as it may
+        // be reused for any event of this class later.
+        return DoAlloc(GetClassSize(n), nothrow);
+    }
+
+    void Free(void* p, size_t size)
+    {
+        wxEventPoolCache& cache = gs_eventPoolCache;
+        if ( size > EVENT_POOL_MAX_SIZE || cache.dead ||
+                gs_eventPoolShutdown.load(std::memory_order_relaxed) )
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        if ( !cache.registered )
+            RegisterCache(cache);
+
+        const size_t n = GetClass(size);
+        wxEventPoolList& list = cache.lists[n];
+
+        wxEventPoolBlock* const block = static_cast<wxEventPoolBlock*>(p);
+        block->next = list.head;
+        list.head = block;
+        list.count++;
+
+        m_pooled.fetch_add(1, std::memory_order_relaxed);
+
+        if ( list.count > EVENT_POOL_MAX_CACHED )
+            GiveBatch(n, list);
+    }
+
+    // Return all the blocks from the given cache to the pool, or free them
+    // if the pool is not used any more.
+    void Flush(wxEventPoolCache& cache)
+    {
+        for ( size_t n = 0; n < EVENT_POOL_NUM_CLASSES; n++ )
+        {
+            wxEventPoolList& list = cache.lists[n];
+            while ( list.head )
+                GiveBatch(n, list);
+        }
+    }
+
+    // Free all the blocks in the pool and stop using it.
+    void Shutdown()
+    {
+        gs_eventPoolShutdown = true;
+
+        // The caches of the other threads are freed when they exit, but free
+        // the current thread cache, which will be never used any more, now.
+        Flush(gs_eventPoolCache);
+
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        for ( size_t n = 0; n < EVENT_POOL_NUM_CLASSES; n++ )
+        {
+            while ( wxEventPoolBlock* const batch = m_batches[n] )
+            {
+                m_batches[n] = batch->nextBatch;
+                FreeBlocks(batch);
+            }
+
+            m_numBatches[n] = 0;
+        }
+    }
+
+    wxEvent::AllocStats GetStats() const
+    {
+        wxEvent::AllocStats stats;
+        stats.allocations = m_allocations.load(std::memory_order_relaxed);
+        stats.reused = m_reused.load(std::memory_order_relaxed);
+        stats.pooled = m_pooled.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    void ResetStats()
+    {
+        m_allocations.store(0, std::memory_order_relaxed);
+        m_reused.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static size_t GetClass(size_t size)
+    {
+        return size ? (size - 1) / EVENT_POOL_GRANULARITY : 0;
+    }
+
+    static size_t GetClassSize(size_t n)
+    {
+        return (n + 1)*EVENT_POOL_GRANULARITY;
+    }
+
+    static void* DoAlloc(size_t size, bool nothrow)
+    {
+        return nothrow ? ::operator new(size, std::nothrow)
+                       : ::operator new(size);
+    }
+
+    static void RegisterCache(wxEventPoolCache& cache);
+
+    // Free the given list of blocks and return their number.
+    size_t FreeBlocks(wxEventPoolBlock* block)
+    {
+        size_t count = 0;
+        while ( block )
+        {
+            wxEventPoolBlock* const next = block->next;
+            ::operator delete(block);
+            block = next;
+            count++;
+        }
+
+        m_pooled.fetch_sub(count, std::memory_order_relaxed);
+
+        return count;
+    }
+
+    // Move a batch of blocks from the pool to the given empty list.
+    void TakeBatch(size_t n, wxEventPoolList& list)
+    {
+        wxEventPoolBlock* batch;
+        {
+            wxCRIT_SECT_LOCKER(lock, m_lock);
+
+            batch = m_batches[n];
+            if ( !batch )
+                return;
+
+            m_batches[n] = batch->nextBatch;
+            m_numBatches[n]--;
+        }
+
+        list.head = batch;
+        list.count = 0;
+        for ( wxEventPoolBlock* block = batch; block; block = block->next )
+            list.count++;
+    }
+
+    // Move a batch of blocks from the given list to the pool, or free them if
+    // the pool is full or not used any more.
+    void GiveBatch(size_t n, wxEventPoolList& list)
+    {
+        wxEventPoolBlock* const batch = list.head;
+
+        wxEventPoolBlock* last = batch;
+        size_t count = 1;
+        for ( ; count < EVENT_POOL_BATCH_SIZE && last->next; count++ )
+            last = last->next;
+
+        list.head = last->next;
+        list.count -= count;
+        last->next = nullptr;
+
+        {
+            wxCRIT_SECT_LOCKER(lock, m_lock);
+
+            if ( m_numBatches[n] < EVENT_POOL_MAX_BATCHES &&
+                    !gs_eventPoolShutdown.load(std::memory_order_relaxed) )
+            {
+                batch->nextBatch = m_batches[n];
+                m_batches[n] = batch;
+                m_numBatches[n]++;
+
+                return;
+            }
+        }
+
+        FreeBlocks(batch);
+    }
+
+#if wxUSE_THREADS
+    wxCriticalSection m_lock;
+#endif // wxUSE_THREADS
+
+    // Linked lists of the batches of the free blocks for each size class.
+    wxEventPoolBlock* m_batches[EVENT_POOL_NUM_CLASSES];
+    size_t m_numBatches[EVENT_POOL_NUM_CLASSES];
+
+    std::atomic<size_t> m_allocations{0};
+    std::atomic<size_t> m_reused{0};
+    std::atomic<size_t> m_pooled{0};
+
+    wxDECLARE_NO_COPY_CLASS(wxEventPool);
+};
+
+// The pool is intentionally never destroyed as the events can be deleted
+// during the static objects destruction, but its blocks are freed by
+// wxEventPoolModule on shutdown.
+wxEventPool& GetEventPool()
+{
+    static wxEventPool* const s_pool = new wxEventPool;
+
+    return *s_pool;
+}
+
+// Object returning the blocks cached by the thread to the pool when it exits.
+struct wxEventPoolCacheFlusher
+{
+    ~wxEventPoolCacheFlusher()
+    {
+        wxEventPoolCache& cache = gs_eventPoolCache;
+
+        GetEventPool().Flush(cache);
+        cache.dead = true;
+    }
+
+    void Register() { }
+};
+
+thread_local wxEventPoolCacheFlusher gs_eventPoolCacheFlusher;
+
+/* static */
+void wxEventPool::RegisterCache(wxEventPoolCache& cache)
+{
+    cache.registered = true;
+
+    // Using the thread-local object ensures that it is constructed and hence
+    // destroyed when this thread exits.
+    gs_eventPoolCacheFlusher.Register();
+}
+
+} // anonymous namespace
+
+#ifndef _WX_WANT_NEW_SIZET_WXCHAR_INT
+
+void *wxEvent::operator new(size_t size)
+{
+    return GetEventPool().Alloc(size, false);
+}
+
+void wxEvent::operator delete(void *buf, size_t size)
+{
+    if ( buf )
+        GetEventPool().Free(buf, size);
+}
+
+void *wxEvent::operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return GetEventPool().Alloc(size, true);
+}
+
+void wxEvent::operator delete(void *buf, const std::nothrow_t&) noexcept
+{
+    // This is only called if the constructor throws and we don't know the
+    // size here, but the block can always be freed directly.
+    ::operator delete(buf);
+}
+
+#endif // !_WX_WANT_NEW_SIZET_WXCHAR_INT
+
+/* static */
+wxEvent::AllocStats wxEvent::GetAllocStats()
+{
+    return GetEventPool().GetStats();
+}
+
+/* static */
+void wxEvent::ResetAllocStats()
+{
+    GetEventPool().ResetStats();
+}
+
+class wxEventPoolModule : public wxModule
+{
+public:
+    wxEventPoolModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override { GetEventPool().Shutdown(); }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxEventPoolModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxEventPoolModule, wxModule);
+
 #endif // wxUSE_BASE
 
 #if wxUSE_GUI
@@ -464,6 +866,18 @@ long wxUpdateUIEvent::sm_updateInterval = 0;
 
 wxUpdateUIMode wxUpdateUIEvent::sm_updateMode = wxUPDATE_UI_PROCESS_ALL;
 
+std::atomic<bool> wxUpdateUIEvent::sm_updateRequested(false);
+
+/* static */
+void wxUpdateUIEvent::RequestUpdate()
+{
+    sm_updateRequested = true;
+
+    // Make sure the idle time processing happens soon even if there are no
+    // other events, e.g. if this is called from a timer handler.
+    wxWakeUpIdle();
+}
+
 // Can we update?
 bool wxUpdateUIEvent::CanUpdate(wxWindowBase *win)
 {
@@ -474,6 +888,13 @@ bool wxUpdateUIEvent::CanUpdate(wxWindowBase *win)
        ((win->GetExtraStyle() & wxWS_EX_PROCESS_UI_UPDATES) == 0)))
         return false;
 
+    // In the registered mode only the registered windows are updated and
+    // they are updated only once per RequestUpdate() call, so the update
+    // interval (other than -1 disabling the updates entirely) is irrelevant.
+    const bool registeredOnly = GetMode() == wxUPDATE_UI_PROCESS_REGISTERED;
+    if ( registeredOnly && !win->IsRegisteredForUpdateUI() )
+        return false;
+
     // Don't update children of the hidden windows: this is useless as any
     // change to their state won't be seen by the user anyhow. Notice that this
     // argument doesn't apply to the hidden windows (with visible parent)
@@ -484,7 +905,7 @@ bool wxUpdateUIEvent::CanUpdate(wxWindowBase *win)
     if (sm_updateInterval == -1)
         return false;
 
-    if (sm_updateInterval == 0)
+    if (sm_updateInterval == 0 || registeredOnly)
         return true;
 
 #if wxUSE_STOPWATCH && wxUSE_LONGLONG
@@ -1160,93 +1581,511 @@ void wxEventHashTable::GrowEventTypeTable()
 }
 
 // ----------------------------------------------------------------------------
-// wxEvtHandler
+// wxDynamicEventIndex
 // ----------------------------------------------------------------------------
 
-wxEvtHandler::wxEvtHandler()
+namespace
 {
-    m_nextHandler = nullptr;
-    m_previousHandler = nullptr;
-    m_enabled = true;
-    m_dynamicEvents = nullptr;
-    m_pendingEvents = nullptr;
 
-    // no client data (yet)
-    m_clientData = nullptr;
-    m_clientDataType = wxClientData_None;
-}
+// Don't bother with the index for the handlers with only a few entries, for
+// which searching them linearly is fast enough.
+const size_t DYNAMIC_EVENTS_INDEX_THRESHOLD = 16;
 
-wxEvtHandler::~wxEvtHandler()
+} // anonymous namespace
+
+// Index of the dynamic event table entries by their event type and, for the
+// entries matching a single ID, by this ID too.
+//
+// Each bucket of the index contains the entries in the order of their
+// connection, with the sequence number allowing to merge the entries from
+// different buckets in this order. The unbound entries are set to null, just
+// as in the vector of the entries itself, and removed by Prune().
+class wxDynamicEventIndex
 {
-    Unlink();
+public:
+    struct Item
+    {
+        size_t seq;
+        wxDynamicEventTableEntry* entry;
+    };
 
-    if (m_dynamicEvents)
+    typedef std::vector<Item> Bucket;
+
+    wxDynamicEventIndex() = default;
+
+    void Add(wxDynamicEventTableEntry* entry)
     {
-        size_t cookie;
-        for ( wxDynamicEventTableEntry* entry = GetFirstDynamicEntry(cookie);
-              entry;
-              entry = GetNextDynamicEntry(cookie) )
+        const Item item = { m_nextSeq++, entry };
+        GetBucket(*entry).push_back(item);
+    }
+
+    void Remove(wxDynamicEventTableEntry* entry)
+    {
+        for ( Item& item : GetBucket(*entry) )
         {
-            // Remove ourselves from sink destructor notifications
-            // (this has usually been done, in wxTrackable destructor)
-            wxEvtHandler *eventSink = entry->m_fn->GetEvtHandler();
-            if ( eventSink )
+            if ( item.entry == entry )
             {
-                wxEventConnectionRef * const
-                    evtConnRef = FindRefInTrackerList(eventSink);
-                if ( evtConnRef )
-                {
-                    eventSink->RemoveNode(evtConnRef);
-                    delete evtConnRef;
-                }
+                item.entry = nullptr;
+                m_removed++;
+                break;
             }
-
-            delete entry->m_callbackUserData;
-            delete entry;
         }
-        delete m_dynamicEvents;
     }
 
-    // Remove us from the list of the pending events if necessary.
-    if (wxTheApp)
-        wxTheApp->RemovePendingEventHandler(this);
+    // Return true if there are any unbound entries.
+    bool NeedsPruning() const { return m_removed != 0; }
 
-    DeletePendingEvents();
+    void Prune()
+    {
+        // Notice that we never remove the buckets themselves, as they could
+        // be used by SearchDynamicEventTable() higher up the call stack.
+        for ( auto& kv : m_byType )
+            PruneBucket(kv.second);
+        for ( auto& kv : m_byTypeAndId )
+            PruneBucket(kv.second);
+
+        m_removed = 0;
+    }
 
-    // we only delete object data, not untyped
-    if ( m_clientDataType == wxClientData_Object )
-        delete m_clientObject;
-}
+    // Return the bucket for the entries with the given type and any ID or
+    // for the entries with the given type and this ID only, may return null.
+    Bucket* FindByType(wxEventType eventType)
+    {
+        const auto it = m_byType.find(eventType);
+        return it == m_byType.end() ? nullptr : &it->second;
+    }
 
-void wxEvtHandler::Unlink()
-{
-    // this event handler must take itself out of the chain of handlers:
+    Bucket* FindByTypeAndId(wxEventType eventType, int id)
+    {
+        const auto it = m_byTypeAndId.find(MakeKey(eventType, id));
+        return it == m_byTypeAndId.end() ? nullptr : &it->second;
+    }
 
-    if (m_previousHandler)
-        m_previousHandler->SetNextHandler(m_nextHandler);
+    // Return the number of the items of the bucket, which may be null, with
+    // the sequence numbers less than the given one.
+    static size_t CountBefore(const Bucket* bucket, size_t seq)
+    {
+        if ( !bucket )
+            return 0;
+
+        return std::lower_bound(bucket->begin(), bucket->end(), seq,
+                                [](const Item& item, size_t value)
+                                {
+                                    return item.seq < value;
+                                }) - bucket->begin();
+    }
 
-    if (m_nextHandler)
-        m_nextHandler->SetPreviousHandler(m_previousHandler);
+private:
+    static wxUint64 MakeKey(wxEventType eventType, int id)
+    {
+        return (static_cast<wxUint64>(static_cast<wxUint32>(eventType)) << 32) |
+                    static_cast<wxUint32>(id);
+    }
 
-    m_nextHandler = nullptr;
-    m_previousHandler = nullptr;
-}
+    Bucket& GetBucket(const wxDynamicEventTableEntry& entry)
+    {
+        if ( entry.m_id != wxID_ANY && entry.m_lastId == wxID_ANY )
+            return m_byTypeAndId[MakeKey(entry.m_eventType, entry.m_id)];
 
-bool wxEvtHandler::IsUnlinked() const
-{
-    return m_previousHandler == nullptr &&
-           m_nextHandler == nullptr;
-}
+        return m_byType[entry.m_eventType];
+    }
 
-wxEventFilter* wxEvtHandler::ms_filterList = nullptr;
+    static void PruneBucket(Bucket& bucket)
+    {
+        bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                    [](const Item& item) { return !item.entry; }),
+                     bucket.end());
+    }
 
-/* static */ void wxEvtHandler::AddFilter(wxEventFilter* filter)
-{
-    wxCHECK_RET( filter, "null filter" );
+    std::unordered_map<wxEventType, Bucket> m_byType;
+    std::unordered_map<wxUint64, Bucket> m_byTypeAndId;
 
-    filter->m_next = ms_filterList;
-    ms_filterList = filter;
-}
+    size_t m_nextSeq = 0;
+    size_t m_removed = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxDynamicEventIndex);
+};
+
+// ----------------------------------------------------------------------------
+// wxCoalescedEvents
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Type of the events used as placeholders for the coalesced events in the
+// pending events queue, they're never processed themselves.
+const wxEventType wxEVT_COALESCED_EVENT = wxNewEventType();
+
+class wxCoalescedEventSlot;
+
+} // anonymous namespace
+
+// Events queued by QueueEventCoalesced() and still pending for a handler.
+class wxCoalescedEvents
+{
+public:
+    wxCoalescedEvents() = default;
+
+    // Protects m_slots and the events stored in the slots, as they're
+    // accessed both by the threads queuing the events and by the one
+    // processing them.
+    wxCriticalSection m_lock;
+
+    std::unordered_map<wxUIntPtr, wxCoalescedEventSlot*> m_slots;
+
+    wxDECLARE_NO_COPY_CLASS(wxCoalescedEvents);
+};
+
+namespace
+{
+
+// This is the event actually added to the pending events queue, it contains
+// the last event queued with the given key and is replaced by it when it's
+// being processed, see wxEvtHandler::ProcessPendingEvents().
+class wxCoalescedEventSlot : public wxEvent
+{
+public:
+    wxCoalescedEventSlot(wxCoalescedEvents& coalesced,
+                         wxUIntPtr key,
+                         wxEvent* event)
+        : wxEvent(wxID_ANY, wxEVT_COALESCED_EVENT),
+          m_coalesced(coalesced),
+          m_key(key),
+          m_event(event)
+    {
+    }
+
+    ~wxCoalescedEventSlot()
+    {
+        // If we're destroyed without being processed, e.g. by
+        // DeletePendingEvents(), we need to remove ourselves from the map.
+        wxCriticalSectionLocker lock(m_coalesced.m_lock);
+
+        const auto it = m_coalesced.m_slots.find(m_key);
+        if ( it != m_coalesced.m_slots.end() && it->second == this )
+            m_coalesced.m_slots.erase(it);
+
+        delete m_event;
+    }
+
+    // Replace the event with the new one, must be called with the lock held.
+    void Replace(wxEvent* event)
+    {
+        delete m_event;
+        m_event = event;
+    }
+
+    // Take ownership of the event and remove this slot from the map, so that
+    // the events queued from now on are not coalesced with this one.
+    wxEvent* Release()
+    {
+        wxCriticalSectionLocker lock(m_coalesced.m_lock);
+
+        m_coalesced.m_slots.erase(m_key);
+
+        wxEvent* const event = m_event;
+        m_event = nullptr;
+        return event;
+    }
+
+    // Use the category of the real event, this matters for YieldFor().
+    virtual wxEventCategory GetEventCategory() const override
+    {
+        wxCriticalSectionLocker lock(m_coalesced.m_lock);
+
+        return m_event ? m_event->GetEventCategory() : wxEVT_CATEGORY_UNKNOWN;
+    }
+
+    virtual wxEvent* Clone() const override
+    {
+        wxFAIL_MSG( "coalesced events can't be cloned" );
+
+        return nullptr;
+    }
+
+private:
+    wxCoalescedEvents& m_coalesced;
+    const wxUIntPtr m_key;
+    wxEvent* m_event;
+
+    wxDECLARE_NO_COPY_CLASS(wxCoalescedEventSlot);
+};
+
+// The handlers subscribed to the idle events, used in wxIDLE_PROCESS_SUBSCRIBED
+// mode to send idle events to them only instead of all the windows.
+class wxIdleSubscribers
+{
+public:
+    static wxIdleSubscribers& Get()
+    {
+        // This object is intentionally never destroyed, as handlers can be
+        // unsubscribed from the destructors of the global objects.
+        static wxIdleSubscribers* const s_subscribers = new wxIdleSubscribers;
+
+        return *s_subscribers;
+    }
+
+    void Add(wxEvtHandler* handler)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        m_indices[handler] = m_handlers.size();
+        m_handlers.push_back(handler);
+    }
+
+    void Remove(wxEvtHandler* handler)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        const auto it = m_indices.find(handler);
+        wxCHECK_RET( it != m_indices.end(), "subscribed handler not found" );
+
+        size_t n = it->second;
+        m_indices.erase(it);
+
+        // Remove the handler by moving another one into its place. If we're
+        // called from ForEach() for an already processed handler, replace it
+        // with the last processed one first and make its position the next
+        // one to process, to avoid skipping the last handler moved there.
+        if ( m_iterating && n < m_next )
+        {
+            Move(--m_next, n);
+            n = m_next;
+        }
+
+        Move(m_handlers.size() - 1, n);
+        m_handlers.pop_back();
+    }
+
+    // Call the given function for all the subscribed handlers, taking into
+    // account that they can be subscribed or unsubscribed by it.
+    template <typename F>
+    void ForEach(const F& func)
+    {
+        {
+            wxCRIT_SECT_LOCKER(lock, m_lock);
+
+            // Don't iterate recursively, this could happen if a handler
+            // dispatches the events, e.g. by calling wxYield().
+            if ( m_iterating )
+                return;
+
+            m_iterating = true;
+            m_next = 0;
+        }
+
+        for ( ;; )
+        {
+            wxEvtHandler* handler;
+            {
+                wxCRIT_SECT_LOCKER(lock, m_lock);
+
+                if ( m_next == m_handlers.size() )
+                {
+                    m_iterating = false;
+                    break;
+                }
+
+                handler = m_handlers[m_next++];
+            }
+
+            func(handler);
+        }
+    }
+
+private:
+    wxIdleSubscribers() = default;
+
+    void Move(size_t from, size_t to)
+    {
+        if ( from == to )
+            return;
+
+        wxEvtHandler* const handler = m_handlers[from];
+        m_handlers[to] = handler;
+        m_indices[handler] = to;
+    }
+
+    wxCriticalSection m_lock;
+
+    // The subscribed handlers and the map from the handler to its index in
+    // the vector, allowing to remove the handlers in constant time.
+    std::vector<wxEvtHandler*> m_handlers;
+    std::unordered_map<wxEvtHandler*, size_t> m_indices;
+
+    // Index of the next handler to use while ForEach() is running.
+    size_t m_next = 0;
+    bool m_iterating = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxIdleSubscribers);
+};
+
+// Return the class info of wxWindow if the GUI library is used. We can't
+// refer to it directly from here, as this code is part of the base library.
+//
+// This is called for every idle event and Bind() or Unbind() call, so cache
+// the result of the lookup, which is fine as the class infos are registered
+// when the library defining them is loaded, before any windows can exist.
+const wxClassInfo* GetWindowClassInfo()
+{
+    static const wxClassInfo* const
+        s_windowClass = wxClassInfo::FindClass("wxWindow");
+
+    return s_windowClass;
+}
+
+// Return the window whose event handlers chain this handler is part of, or
+// the handler itself if it's not a window nor pushed on one.
+wxEvtHandler* GetIdleSubscriber(wxEvtHandler* handler)
+{
+    if ( const wxClassInfo* const windowClass = GetWindowClassInfo() )
+    {
+        for ( wxEvtHandler* h = handler; h; h = h->GetNextHandler() )
+        {
+            if ( h->IsKindOf(windowClass) )
+                return h;
+        }
+    }
+
+    return handler;
+}
+
+// Return the first handler of the chain of the given window, i.e. the same
+// thing as wxWindow::GetEventHandler() returns.
+wxEvtHandler* GetWindowEventHandler(wxEvtHandler* window)
+{
+    wxEvtHandler* handler = window;
+    while ( wxEvtHandler* const previous = handler->GetPreviousHandler() )
+        handler = previous;
+
+    return handler;
+}
+
+// Check whether the handler still needs to be subscribed to the idle events
+// after removing some of its handlers and unsubscribe it if it doesn't.
+void UpdateIdleSubscription(wxEvtHandler* handler)
+{
+    if ( handler->IsSubscribedToIdleEvents() &&
+            !handler->HasIdleEventHandlers() )
+        handler->SubscribeToIdleEvents(false);
+
+    // If the handler is pushed on a window, the window itself is subscribed,
+    // so check if any of the handlers in its chain still needs idle events.
+    wxEvtHandler* const window = GetIdleSubscriber(handler);
+    if ( window == handler || !window->IsSubscribedToIdleEvents() )
+        return;
+
+    for ( wxEvtHandler* h = GetWindowEventHandler(window);
+          h;
+          h = h->GetNextHandler() )
+    {
+        if ( h->HasIdleEventHandlers() )
+            return;
+    }
+
+    window->SubscribeToIdleEvents(false);
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxEvtHandler
+// ----------------------------------------------------------------------------
+
+wxEvtHandler::wxEvtHandler()
+{
+    m_nextHandler = nullptr;
+    m_previousHandler = nullptr;
+    m_enabled = true;
+    m_idleSubscribed = false;
+    m_dynamicEvents = nullptr;
+    m_dynamicEventsIndex = nullptr;
+    m_pendingIncoming = nullptr;
+    m_pendingFirst =
+    m_pendingLast = nullptr;
+    m_pendingRegistered = false;
+    m_coalescedEvents = nullptr;
+
+    // no client data (yet)
+    m_clientData = nullptr;
+    m_clientDataType = wxClientData_None;
+}
+
+wxEvtHandler::~wxEvtHandler()
+{
+    Unlink();
+
+    if ( m_idleSubscribed )
+        wxIdleSubscribers::Get().Remove(this);
+
+    if (m_dynamicEvents)
+    {
+        size_t cookie;
+        for ( wxDynamicEventTableEntry* entry = GetFirstDynamicEntry(cookie);
+              entry;
+              entry = GetNextDynamicEntry(cookie) )
+        {
+            // Remove ourselves from sink destructor notifications
+            // (this has usually been done, in wxTrackable destructor)
+            wxEvtHandler *eventSink = entry->m_fn->GetEvtHandler();
+            if ( eventSink )
+            {
+                wxEventConnectionRef * const
+                    evtConnRef = FindRefInTrackerList(eventSink);
+                if ( evtConnRef )
+                {
+                    eventSink->RemoveNode(evtConnRef);
+                    delete evtConnRef;
+                }
+            }
+
+            delete entry->m_callbackUserData;
+            delete entry;
+        }
+        delete m_dynamicEvents;
+        delete m_dynamicEventsIndex;
+    }
+
+    // This also removes us from the list of the pending events if necessary.
+    DeletePendingEvents();
+
+    delete m_coalescedEvents.load();
+
+    // we only delete object data, not untyped
+    if ( m_clientDataType == wxClientData_Object )
+        delete m_clientObject;
+}
+
+void wxEvtHandler::Unlink()
+{
+    // this event handler must take itself out of the chain of handlers:
+
+    if (m_previousHandler)
+        m_previousHandler->SetNextHandler(m_nextHandler);
+
+    if (m_nextHandler)
+        m_nextHandler->SetPreviousHandler(m_previousHandler);
+
+    m_nextHandler = nullptr;
+    m_previousHandler = nullptr;
+}
+
+bool wxEvtHandler::IsUnlinked() const
+{
+    return m_previousHandler == nullptr &&
+           m_nextHandler == nullptr;
+}
+
+wxEventFilter* wxEvtHandler::ms_filterList = nullptr;
+
+/* static */ void wxEvtHandler::AddFilter(wxEventFilter* filter)
+{
+    wxCHECK_RET( filter, "null filter" );
+
+    filter->m_next = ms_filterList;
+    ms_filterList = filter;
+}
 
 /* static */ void wxEvtHandler::RemoveFilter(wxEventFilter* filter)
 {
@@ -1308,37 +2147,130 @@ void wxEvtHandler::QueueEvent(wxEvent *event)
         return;
     }
 
-    // 1) Add this event to our list of pending events
-    wxENTER_CRIT_SECT( m_pendingEventsLock );
-
-    if ( !m_pendingEvents )
-        m_pendingEvents = new wxList;
-
-    m_pendingEvents->Append(event);
+    // 1) Add this event to our list of pending events: this is done without
+    //    any locking by pushing it on the stack of incoming events, which is
+    //    reversed by ProcessPendingEvents() to restore the FIFO order.
+    wxEvent* head = m_pendingIncoming.load(std::memory_order_relaxed);
+    do
+    {
+        event->m_nextPending = head;
+    }
+    while ( !m_pendingIncoming.compare_exchange_weak(head, event) );
 
     // 2) Add this event handler to list of event handlers that
-    //    have pending events.
-
-    wxTheApp->AppendPendingEventHandler(this);
-
-    // only release m_pendingEventsLock now because otherwise there is a race
-    // condition as described in the ticket #9093: we could process the event
-    // just added to m_pendingEvents in our ProcessPendingEvents() below before
-    // we had time to append this pointer to wxHandlersWithPendingEvents list; thus
-    // breaking the invariant that a handler should be in the list iff it has
-    // any pending events to process
-    wxLEAVE_CRIT_SECT( m_pendingEventsLock );
+    //    have pending events, if it's not there yet.
+    //
+    //    Notice that this must be done after adding the event to avoid the
+    //    race condition described in the ticket #9093: otherwise the handler
+    //    could remove itself from the list after processing the existing
+    //    events but before seeing this one. Conversely, if the handler is
+    //    just removing itself from the list, it will see our event when
+    //    checking for it after resetting m_pendingRegistered, see
+    //    UnregisterPendingEventHandler().
+    if ( !m_pendingRegistered.exchange(true) )
+        wxTheApp->AppendPendingEventHandler(this);
 
     // 3) Inform the system that new pending events are somewhere,
     //    and that these should be processed in idle time.
     wxWakeUpIdle();
 }
 
+void wxEvtHandler::QueueEventCoalesced(wxEvent *event, wxUIntPtr key)
+{
+    wxCHECK_RET( event, "null event can't be posted" );
+
+    wxCoalescedEvents* coalesced = m_coalescedEvents.load();
+    if ( !coalesced )
+    {
+        // This can be called from several threads at once, so only one of
+        // them must succeed in creating the map.
+        wxCoalescedEvents* const coalescedNew = new wxCoalescedEvents;
+        if ( m_coalescedEvents.compare_exchange_strong(coalesced, coalescedNew) )
+            coalesced = coalescedNew;
+        else
+            delete coalescedNew;
+    }
+
+    wxCoalescedEventSlot* slot;
+    {
+        wxCriticalSectionLocker lock(coalesced->m_lock);
+
+        wxCoalescedEventSlot*& slotExisting = coalesced->m_slots[key];
+        if ( slotExisting )
+        {
+            // The previous event is still pending, just replace it.
+            slotExisting->Replace(event);
+            return;
+        }
+
+        slot = new wxCoalescedEventSlot(*coalesced, key, event);
+        slotExisting = slot;
+    }
+
+    QueueEvent(slot);
+}
+
+void wxEvtHandler::TakeIncomingPendingEvents()
+{
+    wxEvent* incoming = m_pendingIncoming.exchange(nullptr);
+    if ( !incoming )
+        return;
+
+    // The incoming events are in LIFO order, so reverse them before appending.
+    wxEvent* const last = incoming;
+    wxEvent* first = nullptr;
+    while ( incoming )
+    {
+        wxEvent* const next = incoming->m_nextPending;
+        incoming->m_nextPending = first;
+        first = incoming;
+        incoming = next;
+    }
+
+    if ( m_pendingLast )
+        m_pendingLast->m_nextPending = first;
+    else
+        m_pendingFirst = first;
+
+    m_pendingLast = last;
+}
+
+void wxEvtHandler::UnregisterPendingEventHandler()
+{
+    wxTheApp->RemovePendingEventHandler(this);
+
+    // Reset the flag only after removing the handler from the list and check
+    // if any events were queued while we were doing it: if so, their
+    // QueueEvent() could have seen the flag still set and not added the
+    // handler to the list, so we must do it ourselves. If the flag is already
+    // set again, this is being done by QueueEvent() in another thread.
+    m_pendingRegistered = false;
+
+    if ( m_pendingIncoming.load() && !m_pendingRegistered.exchange(true) )
+        wxTheApp->AppendPendingEventHandler(this);
+}
+
 void wxEvtHandler::DeletePendingEvents()
 {
-    if (m_pendingEvents)
-        m_pendingEvents->DeleteContents(true);
-    wxDELETE(m_pendingEvents);
+    // As in UnregisterPendingEventHandler(), remove the handler from the list
+    // first and only then reset the flag. This must be done before taking the
+    // incoming events, so that any events queued after doing it add this
+    // handler to the list again.
+    if (wxTheApp)
+        wxTheApp->RemovePendingEventHandler(this);
+
+    m_pendingRegistered = false;
+
+    TakeIncomingPendingEvents();
+
+    while ( m_pendingFirst )
+    {
+        wxEvent* const event = m_pendingFirst;
+        m_pendingFirst = event->m_nextPending;
+        delete event;
+    }
+
+    m_pendingLast = nullptr;
 }
 
 void wxEvtHandler::ProcessPendingEvents()
@@ -1357,25 +2289,33 @@ void wxEvtHandler::ProcessPendingEvents()
 
     wxENTER_CRIT_SECT( m_pendingEventsLock );
 
-    // this method is only called by wxApp if this handler does have
-    // pending events
-    wxCHECK_RET( m_pendingEvents && !m_pendingEvents->IsEmpty(),
-                 "should have pending events if called" );
+    TakeIncomingPendingEvents();
+
+    // this method is normally only called by wxApp if this handler does have
+    // pending events, but they could have been deleted by DeletePendingEvents()
+    if ( !m_pendingFirst )
+    {
+        UnregisterPendingEventHandler();
+
+        wxLEAVE_CRIT_SECT( m_pendingEventsLock );
+
+        return;
+    }
 
-    wxList::compatibility_iterator node = m_pendingEvents->GetFirst();
-    wxEvent* pEvent = static_cast<wxEvent *>(node->GetData());
+    wxEvent* prev = nullptr;
+    wxEvent* pEvent = m_pendingFirst;
 
     // find the first event which can be processed now:
     wxEventLoopBase* evtLoop = wxEventLoopBase::GetActive();
     if (evtLoop && evtLoop->IsYielding())
     {
-        while (node && pEvent && !evtLoop->IsEventAllowedInsideYield(pEvent->GetEventCategory()))
+        while (pEvent && !evtLoop->IsEventAllowedInsideYield(pEvent->GetEventCategory()))
         {
-            node = node->GetNext();
-            pEvent = node ? static_cast<wxEvent *>(node->GetData()) : nullptr;
+            prev = pEvent;
+            pEvent = pEvent->m_nextPending;
         }
 
-        if (!node)
+        if (!pEvent)
         {
             // all our events are NOT processable now... signal this:
             wxTheApp->DelayPendingEventHandler(this);
@@ -1394,17 +2334,33 @@ void wxEvtHandler::ProcessPendingEvents()
     // it's important we remove event from list before processing it, else a
     // nested event loop, for example from a modal dialog, might process the
     // same event again.
-    m_pendingEvents->Erase(node);
+    if ( prev )
+        prev->m_nextPending = pEvent->m_nextPending;
+    else
+        m_pendingFirst = pEvent->m_nextPending;
+
+    if ( m_pendingLast == pEvent )
+        m_pendingLast = prev;
 
-    if ( m_pendingEvents->IsEmpty() )
+    pEvent->m_nextPending = nullptr;
+
+    if ( !m_pendingFirst )
     {
         // if there are no more pending events left, we don't need to
         // stay in this list
-        wxTheApp->RemovePendingEventHandler(this);
+        UnregisterPendingEventHandler();
     }
 
     wxLEAVE_CRIT_SECT( m_pendingEventsLock );
 
+    // Replace the placeholder for coalesced events with the real event.
+    if ( event->GetEventType() == wxEVT_COALESCED_EVENT )
+    {
+        event.reset(static_cast<wxCoalescedEventSlot*>(event.get())->Release());
+        if ( !event )
+            return;
+    }
+
     // We must not let exceptions escape from here, there is no outer exception
     // handler to catch them and so letting them do it would just terminate the
     // program.
@@ -1415,6 +2371,28 @@ void wxEvtHandler::ProcessPendingEvents()
     // of this object any more
 }
 
+namespace
+{
+
+// Call the handler via wxApp method, if possible, which allows the user to
+// catch any exceptions which may be thrown by any handler in the program in
+// one place.
+inline void
+DoCallEventHandler(wxEventFunctor& functor, wxEvtHandler *handler, wxEvent& event)
+{
+#if wxUSE_EXCEPTIONS
+    if ( wxTheApp )
+    {
+        wxTheApp->CallEventHandler(handler, functor, event);
+        return;
+    }
+#endif // wxUSE_EXCEPTIONS
+
+    functor(handler, event);
+}
+
+} // anonymous namespace
+
 /* static */
 bool wxEvtHandler::ProcessEventIfMatchesId(const wxEventTableEntryBase& entry,
                                            wxEvtHandler *handler,
@@ -1435,18 +2413,18 @@ bool wxEvtHandler::ProcessEventIfMatchesId(const wxEventTableEntryBase& entry,
         event.Skip(false);
         event.m_callbackUserData = entry.m_callbackUserData;
 
-#if wxUSE_EXCEPTIONS
-        if ( wxTheApp )
+#if wxUSE_EVENT_PROFILER && !defined(wxNO_RTTI)
+        // Only check for the profiler here to avoid any overhead when it's
+        // not used.
+        if ( wxEventProfiler::IsEnabled() )
         {
-            // call the handler via wxApp method which allows the user to catch
-            // any exceptions which may be thrown by any handler in the program
-            // in one place
-            wxTheApp->CallEventHandler(handler, *entry.m_fn, event);
+            wxEventProfilerCall profile(handler, *entry.m_fn, event);
+            DoCallEventHandler(*entry.m_fn, handler, event);
         }
         else
-#endif // wxUSE_EXCEPTIONS
+#endif // wxUSE_EVENT_PROFILER && !wxNO_RTTI
         {
-            (*entry.m_fn)(handler, event);
+            DoCallEventHandler(*entry.m_fn, handler, event);
         }
 
         if (!event.GetSkipped())
@@ -1512,6 +2490,14 @@ bool wxEvtHandler::ProcessEvent(wxEvent& event)
     // the event handler chain and possibly upwards the window hierarchy.
     if ( !event.WasProcessed() )
     {
+#if wxUSE_THREADS
+        // Let the watchdog know that the main thread is still dispatching
+        // events: this is necessary for the native event loops, which may be
+        // busy dispatching them without ever becoming idle.
+        if ( wxEventLoopWatchdog::IsRunning() && wxIsMainThread() )
+            wxEventLoopWatchdog::Heartbeat();
+#endif // wxUSE_THREADS
+
         for ( wxEventFilter* f = ms_filterList; f; f = f->m_next )
         {
             int rc = f->FilterEvent(event);
@@ -1636,7 +2622,23 @@ bool wxEvtHandler::TryHereOnly(wxEvent& event)
     if ( event.GetEventType() == wxEVT_ASYNC_METHOD_CALL &&
             event.GetEventObject() == this )
     {
-        static_cast<wxAsyncMethodCallEvent&>(event).Execute();
+        wxAsyncMethodCallEvent& asyncEvent =
+            static_cast<wxAsyncMethodCallEvent&>(event);
+
+#if wxUSE_EVENT_PROFILER && !defined(wxNO_RTTI)
+        if ( wxEventProfiler::IsEnabled() )
+        {
+            // Use the type of the event as the handler type, as it contains
+            // the type of the function called by it.
+            wxEventProfilerCall profile(this, typeid(asyncEvent), event);
+            asyncEvent.Execute();
+        }
+        else
+#endif // wxUSE_EVENT_PROFILER && !wxNO_RTTI
+        {
+            asyncEvent.Execute();
+        }
+
         return true;
     }
 
@@ -1781,6 +2783,20 @@ void wxEvtHandler::DoBind(int id,
     // than inserting the element at the front.
     m_dynamicEvents->push_back(entry);
 
+    if ( m_dynamicEventsIndex )
+    {
+        m_dynamicEventsIndex->Add(entry);
+    }
+    else if ( m_dynamicEvents->size() > DYNAMIC_EVENTS_INDEX_THRESHOLD )
+    {
+        m_dynamicEventsIndex = new wxDynamicEventIndex;
+        for ( wxDynamicEventTableEntry* const e : *m_dynamicEvents )
+        {
+            if ( e )
+                m_dynamicEventsIndex->Add(e);
+        }
+    }
+
     // Make sure we get to know when a sink is destroyed
     wxEvtHandler *eventSink = func->GetEvtHandler();
     if ( eventSink && eventSink != this )
@@ -1791,6 +2807,11 @@ void wxEvtHandler::DoBind(int id,
         else
             new wxEventConnectionRef(this, eventSink);
     }
+
+    // Don't waste time on maintaining the subscribers list if it's not used.
+    if ( entry->m_eventType == wxEVT_IDLE &&
+            wxIdleEvent::GetMode() == wxIDLE_PROCESS_SUBSCRIBED )
+        GetIdleSubscriber(this)->SubscribeToIdleEvents();
 }
 
 bool
@@ -1835,7 +2856,16 @@ wxEvtHandler::DoUnbind(int id,
             // this implementation detail.
             (*m_dynamicEvents)[cookie] = nullptr;
 
+            if ( m_dynamicEventsIndex )
+                m_dynamicEventsIndex->Remove(entry);
+
+            const bool wasIdle = entry->m_eventType == wxEVT_IDLE;
+
             delete entry;
+
+            if ( wasIdle )
+                UpdateIdleSubscription(this);
+
             return true;
         }
     }
@@ -1870,11 +2900,83 @@ wxEvtHandler::GetNextDynamicEntry(size_t& cookie) const
     return nullptr;
 }
 
+void wxEvtHandler::PruneDynamicEvents()
+{
+    DynamicEvents& dynamicEvents = *m_dynamicEvents;
+
+    size_t nNew = 0;
+    for ( size_t n = 0; n != dynamicEvents.size(); n++ )
+    {
+        if ( dynamicEvents[n] )
+            dynamicEvents[nNew++] = dynamicEvents[n];
+    }
+
+    wxASSERT( nNew != dynamicEvents.size() );
+    dynamicEvents.resize(nNew);
+
+    if ( m_dynamicEventsIndex )
+        m_dynamicEventsIndex->Prune();
+}
+
 bool wxEvtHandler::SearchDynamicEventTable( wxEvent& event )
 {
     wxCHECK_MSG( m_dynamicEvents, false,
                  wxT("caller should check that we have dynamic events") );
 
+    if ( m_dynamicEventsIndex )
+    {
+        // Only look at the entries for this event type, which can be either
+        // in the bucket for all IDs or in the one for this particular ID, and
+        // merge them to process them in reverse order of their connection.
+        //
+        // Notice that the buckets can change while the handlers are called:
+        // more entries can be appended to them or they can be pruned by a
+        // nested call to this function, so the positions in them can't be
+        // used to resume the iteration. Use the sequence number of the last
+        // processed entry instead, which remains valid even if the bucket is
+        // compacted as the entries remain sorted by it.
+        const wxEventType eventType = event.GetEventType();
+        const wxDynamicEventIndex::Bucket* const
+            byType = m_dynamicEventsIndex->FindByType(eventType);
+        const wxDynamicEventIndex::Bucket* const
+            byId = m_dynamicEventsIndex->FindByTypeAndId(eventType, event.GetId());
+
+        size_t seq = static_cast<size_t>(-1);
+        for ( ;; )
+        {
+            const size_t nType = wxDynamicEventIndex::CountBefore(byType, seq);
+            const size_t nId = wxDynamicEventIndex::CountBefore(byId, seq);
+
+            const wxDynamicEventIndex::Item* item;
+            if ( nId && (!nType || (*byId)[nId - 1].seq > (*byType)[nType - 1].seq) )
+                item = &(*byId)[nId - 1];
+            else if ( nType )
+                item = &(*byType)[nType - 1];
+            else
+                break;
+
+            seq = item->seq;
+
+            wxDynamicEventTableEntry* const entry = item->entry;
+            if ( !entry )
+                continue;
+
+            wxEvtHandler *handler = entry->m_fn->GetEvtHandler();
+            if ( !handler )
+               handler = this;
+            if ( ProcessEventIfMatchesId(*entry, handler, event) )
+            {
+                // See the comment below about not pruning in this case.
+                return true;
+            }
+        }
+
+        if ( m_dynamicEventsIndex->NeedsPruning() )
+            PruneDynamicEvents();
+
+        return false;
+    }
+
     DynamicEvents& dynamicEvents = *m_dynamicEvents;
 
     bool needToPruneDeleted = false;
@@ -1922,17 +3024,7 @@ bool wxEvtHandler::SearchDynamicEventTable( wxEvent& event )
     }
 
     if ( needToPruneDeleted )
-    {
-        size_t nNew = 0;
-        for ( size_t n = 0; n != dynamicEvents.size(); n++ )
-        {
-            if ( dynamicEvents[n] )
-                dynamicEvents[nNew++] = dynamicEvents[n];
-        }
-
-        wxASSERT( nNew != dynamicEvents.size() );
-        dynamicEvents.resize(nNew);
-    }
+        PruneDynamicEvents();
 
     return false;
 }
@@ -2007,6 +3099,9 @@ void wxEvtHandler::OnSinkDestroyed( wxEvtHandler *sink )
     {
         if ( entry->m_fn->GetEvtHandler() == sink )
         {
+            if ( m_dynamicEventsIndex )
+                m_dynamicEventsIndex->Remove(entry);
+
             delete entry->m_callbackUserData;
             delete entry;
 
@@ -2015,6 +3110,96 @@ void wxEvtHandler::OnSinkDestroyed( wxEvtHandler *sink )
             (*m_dynamicEvents)[cookie] = nullptr;
         }
     }
+
+    UpdateIdleSubscription(this);
+}
+
+// ----------------------------------------------------------------------------
+// idle events subscription
+// ----------------------------------------------------------------------------
+
+void wxEvtHandler::SubscribeToIdleEvents(bool subscribe)
+{
+    if ( subscribe == m_idleSubscribed )
+        return;
+
+    m_idleSubscribed = subscribe;
+
+    if ( subscribe )
+        wxIdleSubscribers::Get().Add(this);
+    else
+        wxIdleSubscribers::Get().Remove(this);
+}
+
+bool wxEvtHandler::HasIdleEventHandlers() const
+{
+    size_t cookie;
+    for ( const wxDynamicEventTableEntry* entry = GetFirstDynamicEntry(cookie);
+          entry;
+          entry = GetNextDynamicEntry(cookie) )
+    {
+        if ( entry->m_eventType == wxEVT_IDLE )
+            return true;
+    }
+
+    for ( const wxEventTable* table = GetEventTable();
+          table;
+          table = table->baseTable )
+    {
+        for ( const wxEventTableEntry* entry = table->entries;
+              entry->m_fn;
+              entry++ )
+        {
+            if ( entry->m_eventType == wxEVT_IDLE )
+                return true;
+        }
+    }
+
+    return false;
+}
+
+/* static */
+bool wxEvtHandler::SendIdleEventToSubscribers(wxIdleEvent& event)
+{
+    const wxClassInfo* const windowClass = GetWindowClassInfo();
+
+    wxIdleSubscribers::Get().ForEach([&event, windowClass](wxEvtHandler* handler)
+    {
+        // The application object gets the idle events anyhow and the objects
+        // about to be destroyed shouldn't get them at all.
+        if ( handler == wxTheApp || wxPendingDelete.Member(handler) )
+            return;
+
+        wxEvtHandler* first = handler;
+        if ( windowClass && handler->IsKindOf(windowClass) )
+        {
+            // Process the event in the same way as wxWindow::SendIdleEvents()
+            // does it in the other modes, i.e. starting with the handlers
+            // pushed on the window.
+            first = GetWindowEventHandler(handler);
+        }
+        else
+        {
+            // Don't send the event twice to the handlers which get it from
+            // the window they're pushed on or from the previous handler in
+            // the chain.
+            if ( GetIdleSubscriber(handler) != handler )
+                return;
+
+            for ( wxEvtHandler* h = handler->GetPreviousHandler();
+                  h;
+                  h = h->GetPreviousHandler() )
+            {
+                if ( h->IsSubscribedToIdleEvents() )
+                    return;
+            }
+        }
+
+        event.SetEventObject(handler);
+        first->SafelyProcessEvent(event);
+    });
+
+    return event.MoreRequested();
 }
 
 #endif // wxUSE_BASE
@@ -16,12 +16,33 @@
 
 #ifndef WX_PRECOMP
     #include "wx/app.h"
+    #include "wx/intl.h"
+    #include "wx/log.h"
+    #include "wx/module.h"
 #endif //WX_PRECOMP
 
 #include "wx/scopeguard.h"
 #include "wx/apptrait.h"
+#include "wx/stopwatch.h"
+#include "wx/thread.h"
 #include "wx/private/eventloopsourcesmanager.h"
 
+#if wxUSE_THREADS
+    #include <atomic>
+
+    #if wxUSE_STACKWALKER && defined(__UNIX__)
+        #define wxHAS_WATCHDOG_STACK
+
+        #include "wx/stackwalk.h"
+
+        #include <errno.h>
+        #include <execinfo.h>
+        #include <pthread.h>
+        #include <signal.h>
+        #include <string.h>
+    #endif
+#endif // wxUSE_THREADS
+
 // Counts currently existing event loops.
 //
 // As wxEventLoop can be only used from the main thread, there is no need to
@@ -233,6 +254,10 @@ bool wxEventLoopManual::ProcessEvents()
 
     const bool res = Dispatch();
 
+#if wxUSE_THREADS
+    wxEventLoopWatchdog::Heartbeat();
+#endif // wxUSE_THREADS
+
 #if wxUSE_EXCEPTIONS
     // Rethrow any exceptions which could have been produced by the handlers
     // ran by Dispatch().
@@ -395,3 +420,356 @@ void wxEventLoopManual::ScheduleExit(int rc)
 
 #endif // __WINDOWS__ || __WXMAC__ || __WXDFB__
 
+
+// ============================================================================
+// wxEventLoopWatchdog implementation
+// ============================================================================
+
+#if wxUSE_THREADS
+
+namespace
+{
+
+// Incremented by Heartbeat(), the watchdog thread only checks if it changes.
+std::atomic<unsigned> gs_watchdogHeartbeats(0);
+
+#ifdef wxHAS_WATCHDOG_STACK
+
+// The signal used to interrupt the main thread to get its stack by default.
+const int WATCHDOG_DEFAULT_SIGNAL = SIGUSR2;
+
+// The frames of the signal handler itself and of the signal trampoline.
+const int WATCHDOG_SKIP_FRAMES = 2;
+
+pthread_t gs_watchdogMainThread;
+
+// The signal used by the currently running watchdog and its previous action.
+int gs_watchdogSignal = WATCHDOG_DEFAULT_SIGNAL;
+struct sigaction gs_watchdogOldAction;
+
+// The stack of the main thread filled in by the signal handler, which sets the
+// depth to a non-negative value when it's done.
+void* gs_watchdogStack[100];
+std::atomic<int> gs_watchdogStackDepth(-1);
+
+// Note that backtrace() is not formally async-signal-safe, as POSIX doesn't
+// specify it at all. In practice, with glibc it only isn't safe to call it
+// for the first time, as it loads libgcc_s dynamically then, which is why
+// Start() calls it before installing this handler. Symbolizing the addresses
+// requires allocating memory and so is done in the watchdog thread later.
+void WatchdogSignalHandler(int WXUNUSED(sig))
+{
+    const int savedErrno = errno;
+
+    gs_watchdogStackDepth = backtrace(gs_watchdogStack,
+                                      WXSIZEOF(gs_watchdogStack));
+
+    errno = savedErrno;
+}
+
+class StallStackWalker : public wxStackWalker
+{
+public:
+    StallStackWalker() = default;
+
+    const wxString& GetStackTrace() const { return m_stackTrace; }
+
+protected:
+    virtual void OnStackFrame(const wxStackFrame& frame) override
+    {
+        m_stackTrace << wxString::Format("[%02u] ",
+                                         static_cast<unsigned>(frame.GetLevel()));
+
+        const wxString name = frame.GetName();
+        if ( !name.empty() )
+            m_stackTrace << name;
+        else
+            m_stackTrace << wxString::Format("%p", frame.GetAddress());
+
+        if ( frame.HasSourceLocation() )
+        {
+            m_stackTrace << wxString::Format(" at %s:%zu",
+                                             frame.GetFileName(),
+                                             frame.GetLine());
+        }
+
+        m_stackTrace << wxT('\n');
+    }
+
+private:
+    wxString m_stackTrace;
+};
+
+// Interrupt the main thread to get its stack and return it as a string.
+wxString GetMainThreadStack()
+{
+    gs_watchdogStackDepth = -1;
+
+    if ( pthread_kill(gs_watchdogMainThread, gs_watchdogSignal) != 0 )
+        return wxString();
+
+    // Give the main thread some time to handle the signal, but don't wait
+    // forever as it may be unable to do it, e.g. if it's stuck in the kernel.
+    int depth = -1;
+    for ( int n = 0; n < 100; n++ )
+    {
+        depth = gs_watchdogStackDepth;
+        if ( depth >= 0 )
+            break;
+
+        wxMilliSleep(5);
+    }
+
+    if ( depth <= WATCHDOG_SKIP_FRAMES )
+        return wxString();
+
+    StallStackWalker walker;
+    walker.ProcessAddresses(gs_watchdogStack + WATCHDOG_SKIP_FRAMES,
+                            depth - WATCHDOG_SKIP_FRAMES);
+    return walker.GetStackTrace();
+}
+
+// Restore the action of the signal used by the watchdog.
+void RestoreWatchdogSignalAction()
+{
+    // GetMainThreadStack() may have given up waiting for the signal while it
+    // is still pending, e.g. because the main thread blocks it, and restoring
+    // the old action, which is typically the default one terminating the
+    // process, would then make it fatal. Ignoring the signal discards any
+    // pending instances of it, so do this first.
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = SIG_IGN;
+    sigemptyset(&sa.sa_mask);
+    sigaction(gs_watchdogSignal, &sa, nullptr);
+
+    sigaction(gs_watchdogSignal, &gs_watchdogOldAction, nullptr);
+}
+
+#endif // wxHAS_WATCHDOG_STACK
+
+wxCriticalSection gs_watchdogCallbackLock;
+wxEventLoopWatchdog::Callback gs_watchdogCallback;
+
+class wxEventLoopWatchdogThread : public wxThread
+{
+public:
+    explicit wxEventLoopWatchdogThread(long threshold)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_threshold(threshold)
+    {
+    }
+
+    void RequestStop() { m_stop.Post(); }
+
+protected:
+    virtual ExitCode Entry() override;
+
+private:
+    void ReportStall(long elapsed);
+
+    const long m_threshold;
+
+    // Posted to stop the thread.
+    wxSemaphore m_stop;
+
+    wxDECLARE_NO_COPY_CLASS(wxEventLoopWatchdogThread);
+};
+
+wxEventLoopWatchdogThread* gs_watchdogThread = nullptr;
+
+// Same as gs_watchdogThread != nullptr, but can be checked from any thread.
+std::atomic<bool> gs_watchdogRunning(false);
+
+wxThread::ExitCode wxEventLoopWatchdogThread::Entry()
+{
+    // Check often enough to detect the stall soon after it exceeds the
+    // threshold.
+    const unsigned long interval = wxMax(m_threshold / 4, 10);
+
+    unsigned lastHeartbeats = gs_watchdogHeartbeats;
+    wxStopWatch sinceLastHeartbeat;
+    bool wokenUp = false,
+         reported = false;
+
+    while ( m_stop.WaitTimeout(interval) == wxSEMA_TIMEOUT )
+    {
+        const unsigned heartbeats = gs_watchdogHeartbeats;
+        if ( heartbeats != lastHeartbeats )
+        {
+            lastHeartbeats = heartbeats;
+            sinceLastHeartbeat.Start();
+            wokenUp =
+            reported = false;
+            continue;
+        }
+
+        // The main thread may be just waiting for the events to arrive, so
+        // wake it up: if it's not stuck, it will generate idle events and we
+        // will get a heartbeat soon.
+        if ( !wokenUp )
+        {
+            wxWakeUpIdle();
+            wokenUp = true;
+            continue;
+        }
+
+        // Only report each stall once.
+        const long elapsed = sinceLastHeartbeat.Time();
+        if ( elapsed >= m_threshold && !reported )
+        {
+            ReportStall(elapsed);
+            reported = true;
+        }
+    }
+
+    return nullptr;
+}
+
+void wxEventLoopWatchdogThread::ReportStall(long elapsed)
+{
+    wxString stack;
+#ifdef wxHAS_WATCHDOG_STACK
+    stack = GetMainThreadStack();
+#endif // wxHAS_WATCHDOG_STACK
+
+    wxEventLoopWatchdog::Callback callback;
+    {
+        wxCriticalSectionLocker lock(gs_watchdogCallbackLock);
+        callback = gs_watchdogCallback;
+    }
+
+    if ( callback )
+    {
+        callback(elapsed, stack);
+    }
+    else if ( stack.empty() )
+    {
+        wxLogWarning(_("The main thread has not processed events for %ld ms."),
+                     elapsed);
+    }
+    else
+    {
+        wxLogWarning(_("The main thread has not processed events for %ld ms, "
+                       "its stack is:\n%s"),
+                     elapsed, stack);
+    }
+}
+
+} // anonymous namespace
+
+/* static */
+bool wxEventLoopWatchdog::Start(long threshold, int sig)
+{
+    wxCHECK_MSG( wxIsMainThread(), false,
+                 "must be called from the main thread" );
+    wxCHECK_MSG( threshold > 0, false, "invalid threshold" );
+    wxCHECK_MSG( sig >= 0, false, "invalid signal" );
+
+    Stop();
+
+#ifdef wxHAS_WATCHDOG_STACK
+    gs_watchdogMainThread = pthread_self();
+    gs_watchdogSignal = sig ? sig : WATCHDOG_DEFAULT_SIGNAL;
+
+    // The first call to backtrace() may allocate memory, which must not be
+    // done in the signal handler, so ensure it's done here.
+    void* dummy[1];
+    backtrace(dummy, WXSIZEOF(dummy));
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = WatchdogSignalHandler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+    if ( sigaction(gs_watchdogSignal, &sa, &gs_watchdogOldAction) != 0 )
+    {
+        wxLogSysError(_("Failed to install signal handler"));
+        return false;
+    }
+#endif // wxHAS_WATCHDOG_STACK
+
+    gs_watchdogThread = new wxEventLoopWatchdogThread(threshold);
+    if ( gs_watchdogThread->Run() != wxTHREAD_NO_ERROR )
+    {
+        delete gs_watchdogThread;
+        gs_watchdogThread = nullptr;
+
+#ifdef wxHAS_WATCHDOG_STACK
+        sigaction(gs_watchdogSignal, &gs_watchdogOldAction, nullptr);
+#endif // wxHAS_WATCHDOG_STACK
+
+        return false;
+    }
+
+    gs_watchdogRunning = true;
+
+    return true;
+}
+
+/* static */
+void wxEventLoopWatchdog::Stop()
+{
+    if ( !gs_watchdogThread )
+        return;
+
+    gs_watchdogRunning = false;
+
+    gs_watchdogThread->RequestStop();
+    gs_watchdogThread->Wait();
+
+    delete gs_watchdogThread;
+    gs_watchdogThread = nullptr;
+
+#ifdef wxHAS_WATCHDOG_STACK
+    RestoreWatchdogSignalAction();
+#endif // wxHAS_WATCHDOG_STACK
+}
+
+/* static */
+bool wxEventLoopWatchdog::IsRunning()
+{
+    return gs_watchdogRunning.load(std::memory_order_relaxed);
+}
+
+/* static */
+void wxEventLoopWatchdog::SetCallback(const Callback& callback)
+{
+    wxCriticalSectionLocker lock(gs_watchdogCallbackLock);
+
+    gs_watchdogCallback = callback;
+}
+
+/* static */
+void wxEventLoopWatchdog::Heartbeat()
+{
+    gs_watchdogHeartbeats.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------------------------------
+// wxEventLoopWatchdogModule: stops the watchdog thread on shutdown
+// ----------------------------------------------------------------------------
+
+class wxEventLoopWatchdogModule : public wxModule
+{
+public:
+    wxEventLoopWatchdogModule()
+    {
+        // The watchdog thread must be stopped before threads are cleaned up.
+        AddDependency(wxClassInfo::FindClass("wxThreadModule"));
+    }
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override
+    {
+        wxEventLoopWatchdog::Stop();
+        wxEventLoopWatchdog::SetCallback(wxEventLoopWatchdog::Callback());
+    }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxEventLoopWatchdogModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxEventLoopWatchdogModule, wxModule);
+
+#endif // wxUSE_THREADS
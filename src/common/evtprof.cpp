@@ -0,0 +1,710 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/evtprof.cpp
+// Purpose:     wxEventProfiler implementation
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_EVENT_PROFILER
+
+#include "wx/private/evtprof.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/module.h"
+    #include "wx/thread.h"
+#endif
+
+#include "wx/ffile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+#ifdef HAVE_CXA_DEMANGLE
+    #include <cxxabi.h>
+#endif // HAVE_CXA_DEMANGLE
+
+std::atomic<bool> wxEventProfiler::ms_enabled(false);
+
+#ifndef wxNO_RTTI
+
+namespace
+{
+
+// Pointers to members can't be hashed directly nor converted to anything
+// else, so hash their object representation.
+size_t HashMethod(const wxEventFunction& method)
+{
+    unsigned char bytes[sizeof(wxEventFunction)];
+    memcpy(bytes, &method, sizeof(bytes));
+
+    size_t hash = 0;
+    for ( const unsigned char b : bytes )
+        hash = hash*31 + b;
+    return hash;
+}
+
+// All the calls with the same key are aggregated together in the statistics.
+//
+// Note that we use type_info pointers rather than std::type_index because
+// hashing the latter is much slower, as it hashes the type name, and the only
+// drawback is that the calls of the same handler could be counted separately
+// if the platform uses different type_info objects for the same type.
+struct CallKey
+{
+    wxEventType eventType;
+    const std::type_info* handlerType;
+    const std::type_info* func;
+    wxEventFunction method;
+
+    bool operator==(const CallKey& other) const
+    {
+        return eventType == other.eventType &&
+                handlerType == other.handlerType &&
+                    func == other.func &&
+                        method == other.method;
+    }
+};
+
+struct CallKeyHash
+{
+    size_t operator()(const CallKey& key) const
+    {
+        size_t hash = std::hash<int>()(key.eventType);
+        hash = hash*31 + std::hash<const void*>()(key.handlerType);
+        hash = hash*31 + std::hash<const void*>()(key.func);
+        if ( key.method )
+            hash = hash*31 + HashMethod(key.method);
+        return hash;
+    }
+};
+
+struct CallStats
+{
+    CallStats(const CallKey& key_, const std::type_info& eventClass_)
+        : key(key_),
+          eventClass(&eventClass_)
+    {
+    }
+
+    CallKey key;
+    const std::type_info* eventClass;
+
+    size_t count = 0;
+    wxLongLong_t totalTime = 0;
+    wxLongLong_t maxTime = 0;
+    int maxDepth = 0;
+};
+
+// A single call recorded in the trace.
+struct TraceRecord
+{
+    // Index of the call in ThreadProfilerData::m_calls.
+    size_t call;
+
+    // Start time and duration of the call.
+    wxLongLong_t start;
+    wxLongLong_t duration;
+
+    wxThreadIdType thread;
+    int depth;
+};
+
+wxLongLong_t GetCurrentTimeNS()
+{
+    using namespace std::chrono;
+
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Nesting level of the handlers being currently executed in this thread.
+thread_local int gs_depth = 0;
+
+// Statistics and trace collected by a single thread, or merged from several
+// of them.
+//
+// Each thread only updates its own data, so the lock is only contended when
+// the statistics are retrieved or reset from another thread.
+class ThreadProfilerData
+{
+public:
+    ThreadProfilerData() = default;
+
+    // Return the statistics for the given key, creating them if necessary.
+    size_t GetCallIndex(const CallKey& key, const std::type_info& eventClass)
+    {
+        const auto it = m_index.find(key);
+        if ( it != m_index.end() )
+            return it->second;
+
+        const size_t n = m_calls.size();
+        m_calls.emplace_back(key, eventClass);
+        m_index.emplace(key, n);
+
+        return n;
+    }
+
+    void Record(const CallKey& key,
+                const std::type_info& eventClass,
+                wxLongLong_t start,
+                wxLongLong_t duration,
+                int depth,
+                bool trace)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        const size_t n = GetCallIndex(key, eventClass);
+
+        CallStats& call = m_calls[n];
+        call.count++;
+        call.totalTime += duration;
+        if ( duration > call.maxTime )
+            call.maxTime = duration;
+        if ( depth > call.maxDepth )
+            call.maxDepth = depth;
+
+        if ( trace )
+        {
+            TraceRecord record;
+            record.call = n;
+            record.start = start;
+            record.duration = duration;
+#if wxUSE_THREADS
+            record.thread = wxThread::GetCurrentId();
+#else
+            record.thread = 0;
+#endif
+            record.depth = depth;
+
+            m_trace.push_back(record);
+        }
+    }
+
+    // Add the statistics and, optionally, the trace of this object to the
+    // other one.
+    void MergeInto(ThreadProfilerData& other, bool withTrace) const
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        std::vector<size_t> indices;
+        indices.reserve(m_calls.size());
+
+        for ( const auto& call : m_calls )
+        {
+            const size_t n = other.GetCallIndex(call.key, *call.eventClass);
+            indices.push_back(n);
+
+            CallStats& merged = other.m_calls[n];
+            merged.count += call.count;
+            merged.totalTime += call.totalTime;
+            if ( call.maxTime > merged.maxTime )
+                merged.maxTime = call.maxTime;
+            if ( call.maxDepth > merged.maxDepth )
+                merged.maxDepth = call.maxDepth;
+        }
+
+        if ( withTrace )
+        {
+            for ( TraceRecord record : m_trace )
+            {
+                record.call = indices[record.call];
+                other.m_trace.push_back(record);
+            }
+        }
+    }
+
+    void Clear()
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        m_index.clear();
+        m_calls.clear();
+        m_trace.clear();
+    }
+
+    const std::vector<CallStats>& GetCalls() const { return m_calls; }
+    const std::vector<TraceRecord>& GetTrace() const { return m_trace; }
+
+private:
+#if wxUSE_THREADS
+    mutable wxCriticalSection m_lock;
+#endif // wxUSE_THREADS
+
+    std::unordered_map<CallKey, size_t, CallKeyHash> m_index;
+    std::vector<CallStats> m_calls;
+
+    std::vector<TraceRecord> m_trace;
+
+    wxDECLARE_NO_COPY_CLASS(ThreadProfilerData);
+};
+
+// Global data keeping track of the data of all threads.
+class wxEventProfilerData
+{
+public:
+    wxEventProfilerData() = default;
+
+    void Register(ThreadProfilerData* data)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        m_threads.push_back(data);
+    }
+
+    // Called when the thread exits: preserve its data in m_finished.
+    void Unregister(ThreadProfilerData* data)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        data->MergeInto(m_finished, true);
+
+        m_threads.erase(std::find(m_threads.begin(), m_threads.end(), data));
+    }
+
+    // Return true if the call being recorded should be added to the trace.
+    bool ShouldTrace()
+    {
+        const size_t maxTrace = m_maxTrace.load(std::memory_order_relaxed);
+
+        return m_traceCount.load(std::memory_order_relaxed) < maxTrace &&
+                m_traceCount.fetch_add(1, std::memory_order_relaxed) < maxTrace;
+    }
+
+    void SetMaxTrace(size_t maxCalls)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        if ( !m_traceCount )
+            m_traceStart = GetCurrentTimeNS();
+
+        m_maxTrace = maxCalls;
+    }
+
+    void Reset()
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        for ( auto* const data : m_threads )
+            data->Clear();
+        m_finished.Clear();
+
+        m_traceCount = 0;
+        m_traceStart = GetCurrentTimeNS();
+    }
+
+    std::vector<wxEventProfiler::Entry> GetStats();
+
+    bool ExportChromeTrace(const wxString& filename);
+
+private:
+    // Merge the data of all threads, including the finished ones, into the
+    // given object.
+    void MergeAll(ThreadProfilerData& merged, bool withTrace);
+
+#if wxUSE_THREADS
+    wxCriticalSection m_lock;
+#endif // wxUSE_THREADS
+
+    // Data of all the currently running threads which have called any
+    // handlers while the profiler was enabled.
+    std::vector<ThreadProfilerData*> m_threads;
+
+    // Data merged from the threads which don't exist any more.
+    ThreadProfilerData m_finished;
+
+    // The number of calls recorded in the trace by all threads so far and
+    // the maximal number of them.
+    std::atomic<size_t> m_traceCount{0};
+    std::atomic<size_t> m_maxTrace{0};
+
+    wxLongLong_t m_traceStart = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxEventProfilerData);
+};
+
+// The data is intentionally never destroyed as the events can be processed
+// during the static objects destruction.
+wxEventProfilerData& GetProfilerData()
+{
+    static wxEventProfilerData* const s_data = new wxEventProfilerData;
+
+    return *s_data;
+}
+
+// Owns the data of the current thread, which is only created when the thread
+// calls a handler with the profiler enabled for the first time.
+class ThreadProfilerDataHolder
+{
+public:
+    ThreadProfilerDataHolder() = default;
+
+    ~ThreadProfilerDataHolder()
+    {
+        if ( m_data )
+        {
+            GetProfilerData().Unregister(m_data);
+            delete m_data;
+        }
+    }
+
+    ThreadProfilerData& Get()
+    {
+        if ( !m_data )
+        {
+            m_data = new ThreadProfilerData;
+            GetProfilerData().Register(m_data);
+        }
+
+        return *m_data;
+    }
+
+private:
+    ThreadProfilerData* m_data = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(ThreadProfilerDataHolder);
+};
+
+thread_local ThreadProfilerDataHolder gs_threadData;
+
+wxString GetTypeName(const std::type_info& type)
+{
+    const char* const name = type.name();
+
+#ifdef HAVE_CXA_DEMANGLE
+    int rc = -1;
+    char* const demangled = __cxxabiv1::__cxa_demangle(name, nullptr, nullptr, &rc);
+    if ( rc == 0 )
+    {
+        const wxString s = wxString::FromAscii(demangled);
+        free(demangled);
+        return s;
+    }
+#endif // HAVE_CXA_DEMANGLE
+
+    return wxString::FromAscii(name);
+}
+
+// Quote the string for using it in JSON.
+wxString QuoteJSON(const wxString& s)
+{
+    wxString quoted;
+    quoted.reserve(s.length() + 2);
+
+    quoted += '"';
+    for ( wxString::const_iterator it = s.begin(); it != s.end(); ++it )
+    {
+        const wxUniChar ch = *it;
+        if ( ch == '"' || ch == '\\' )
+        {
+            quoted += '\\';
+            quoted += ch;
+        }
+        else if ( ch < 0x20 )
+        {
+            quoted += wxString::Format("\\u%04x", static_cast<unsigned>(ch));
+        }
+        else
+        {
+            quoted += ch;
+        }
+    }
+    quoted += '"';
+
+    return quoted;
+}
+
+wxEventProfiler::Entry MakeEntry(const CallStats& call)
+{
+    wxEventProfiler::Entry entry;
+    entry.eventType = call.key.eventType;
+    entry.eventClass = GetTypeName(*call.eventClass);
+    entry.handlerClass = GetTypeName(*call.key.handlerType);
+    entry.handlerName = GetTypeName(*call.key.func);
+
+    // We can't get the name of the method, but at least distinguish between
+    // the different methods using the same functor type.
+    if ( call.key.method )
+    {
+        entry.handlerName += wxString::Format
+                             (
+                                " (method %08lx)",
+                                static_cast<unsigned long>(HashMethod(call.key.method))
+                             );
+    }
+
+    entry.count = call.count;
+    entry.totalTime = call.totalTime;
+    entry.maxTime = call.maxTime;
+    entry.maxDepth = call.maxDepth;
+
+    return entry;
+}
+
+void wxEventProfilerData::MergeAll(ThreadProfilerData& merged, bool withTrace)
+{
+    m_finished.MergeInto(merged, withTrace);
+
+    for ( const auto* const data : m_threads )
+        data->MergeInto(merged, withTrace);
+}
+
+std::vector<wxEventProfiler::Entry> wxEventProfilerData::GetStats()
+{
+    ThreadProfilerData merged;
+
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        MergeAll(merged, false);
+    }
+
+    std::vector<wxEventProfiler::Entry> entries;
+    entries.reserve(merged.GetCalls().size());
+    for ( const auto& call : merged.GetCalls() )
+        entries.push_back(MakeEntry(call));
+
+    std::sort(entries.begin(), entries.end(),
+              [](const wxEventProfiler::Entry& e1,
+                 const wxEventProfiler::Entry& e2)
+              {
+                  return e1.totalTime > e2.totalTime;
+              });
+
+    return entries;
+}
+
+bool wxEventProfilerData::ExportChromeTrace(const wxString& filename)
+{
+#if wxUSE_FFILE
+    wxFFile file(filename, "w");
+    if ( !file.IsOpened() )
+        return false;
+
+    ThreadProfilerData merged;
+    wxLongLong_t traceStart;
+
+    {
+        wxCRIT_SECT_LOCKER(lock, m_lock);
+
+        MergeAll(merged, true);
+        traceStart = m_traceStart;
+    }
+
+    // Compute the names only once for all the calls.
+    const std::vector<CallStats>& calls = merged.GetCalls();
+    std::vector<wxString> names, args;
+    names.reserve(calls.size());
+    args.reserve(calls.size());
+    for ( const auto& call : calls )
+    {
+        const wxEventProfiler::Entry entry = MakeEntry(call);
+        names.push_back(QuoteJSON(entry.handlerName));
+        args.push_back(wxString::Format
+                       (
+                        "\"cat\":%s,\"args\":{\"eventType\":%d,\"handlerClass\":%s",
+                        QuoteJSON(entry.eventClass),
+                        entry.eventType,
+                        QuoteJSON(entry.handlerClass)
+                       ));
+    }
+
+    wxString json("{\"traceEvents\":[");
+    bool first = true;
+    for ( const auto& record : merged.GetTrace() )
+    {
+        if ( !first )
+            json += ',';
+        first = false;
+
+        // Chrome uses the times in microseconds.
+        json += wxString::Format
+                (
+                    "\n{\"name\":%s,\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                    "\"pid\":1,\"tid\":%" wxLongLongFmtSpec "u,%s,\"depth\":%d}}",
+                    names[record.call],
+                    (record.start - traceStart) / 1000.,
+                    record.duration / 1000.,
+                    static_cast<wxULongLong_t>(record.thread),
+                    args[record.call],
+                    record.depth
+                );
+    }
+    json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return file.Write(json, wxConvUTF8) && file.Close();
+#else // !wxUSE_FFILE
+    wxUnusedVar(filename);
+
+    return false;
+#endif // wxUSE_FFILE/!wxUSE_FFILE
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxEventProfilerCall implementation
+// ----------------------------------------------------------------------------
+
+wxEventProfilerCall::wxEventProfilerCall(wxEvtHandler* handler,
+                                         const wxEventFunctor& functor,
+                                         const wxEvent& event)
+    : m_handlerType(typeid(*handler)),
+      m_func(typeid(functor)),
+      m_eventClass(typeid(event)),
+      m_eventType(event.GetEventType()),
+      m_method(functor.GetEvtMethod())
+{
+    Start();
+}
+
+wxEventProfilerCall::wxEventProfilerCall(wxEvtHandler* handler,
+                                         const std::type_info& func,
+                                         const wxEvent& event)
+    : m_handlerType(typeid(*handler)),
+      m_func(func),
+      m_eventClass(typeid(event)),
+      m_eventType(event.GetEventType())
+{
+    Start();
+}
+
+void wxEventProfilerCall::Start()
+{
+    m_depth = ++gs_depth;
+    m_start = GetCurrentTimeNS();
+}
+
+wxEventProfilerCall::~wxEventProfilerCall()
+{
+    const wxLongLong_t duration = GetCurrentTimeNS() - m_start;
+
+    gs_depth--;
+
+    const CallKey key = { m_eventType, &m_handlerType, &m_func, m_method };
+    gs_threadData.Get().Record(key, m_eventClass, m_start, duration, m_depth,
+                               GetProfilerData().ShouldTrace());
+}
+
+#endif // !wxNO_RTTI
+
+// ----------------------------------------------------------------------------
+// wxEventProfiler implementation
+// ----------------------------------------------------------------------------
+
+/* static */
+void wxEventProfiler::Enable(bool enable)
+{
+#ifdef wxNO_RTTI
+    wxCHECK_RET( !enable, "wxEventProfiler requires RTTI support" );
+#endif // wxNO_RTTI
+
+    ms_enabled = enable;
+}
+
+#ifndef wxNO_RTTI
+
+/* static */
+void wxEventProfiler::EnableTrace(size_t maxCalls)
+{
+    GetProfilerData().SetMaxTrace(maxCalls);
+}
+
+/* static */
+std::vector<wxEventProfiler::Entry> wxEventProfiler::GetStats()
+{
+    return GetProfilerData().GetStats();
+}
+
+/* static */
+void wxEventProfiler::Reset()
+{
+    GetProfilerData().Reset();
+}
+
+/* static */
+bool wxEventProfiler::ExportChromeTrace(const wxString& filename)
+{
+    return GetProfilerData().ExportChromeTrace(filename);
+}
+
+#else // wxNO_RTTI
+
+/* static */
+void wxEventProfiler::EnableTrace(size_t WXUNUSED(maxCalls))
+{
+}
+
+/* static */
+std::vector<wxEventProfiler::Entry> wxEventProfiler::GetStats()
+{
+    return std::vector<Entry>();
+}
+
+/* static */
+void wxEventProfiler::Reset()
+{
+}
+
+/* static */
+bool wxEventProfiler::ExportChromeTrace(const wxString& WXUNUSED(filename))
+{
+    return false;
+}
+
+#endif // !wxNO_RTTI/wxNO_RTTI
+
+/* static */
+wxString wxEventProfiler::Dump()
+{
+    wxString dump;
+    dump.Printf("%8s %12s %10s %5s  %s\n",
+                "Calls", "Total (ms)", "Max (ms)", "Depth", "Handler");
+
+    for ( const auto& entry : GetStats() )
+    {
+        dump += wxString::Format
+                (
+                    "%8lu %12.3f %10.3f %5d  %s for %s (%d) in %s\n",
+                    static_cast<unsigned long>(entry.count),
+                    entry.totalTime / 1e6,
+                    entry.maxTime / 1e6,
+                    entry.maxDepth,
+                    entry.handlerName,
+                    entry.eventClass,
+                    entry.eventType,
+                    entry.handlerClass
+                );
+    }
+
+    return dump;
+}
+
+// ----------------------------------------------------------------------------
+// wxEventProfilerModule: stops profiling on shutdown
+// ----------------------------------------------------------------------------
+
+class wxEventProfilerModule : public wxModule
+{
+public:
+    wxEventProfilerModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override
+    {
+        wxEventProfiler::Enable(false);
+        wxEventProfiler::EnableTrace(0);
+        wxEventProfiler::Reset();
+    }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxEventProfilerModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxEventProfilerModule, wxModule);
+
+#endif // wxUSE_EVENT_PROFILER
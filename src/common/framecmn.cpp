@@ -363,7 +363,11 @@ void wxFrameBase::OnInternalIdle()
     wxTopLevelWindow::OnInternalIdle();
 
 #if wxUSE_MENUS
-    if ( ShouldUpdateMenuFromIdle() && wxUpdateUIEvent::CanUpdate(this) )
+    // In wxUPDATE_UI_PROCESS_REGISTERED mode the menus are updated from
+    // UpdateWindowUI() called for the registered frames instead.
+    if ( ShouldUpdateMenuFromIdle() &&
+            wxUpdateUIEvent::GetMode() != wxUPDATE_UI_PROCESS_REGISTERED &&
+                wxUpdateUIEvent::CanUpdate(this) )
         DoMenuUpdates();
 #endif
 }
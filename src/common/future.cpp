@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/future.cpp
+// Purpose:     wxFuture and wxPromise implementation
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#include "wx/future.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+#endif // WX_PRECOMP
+
+#include "wx/weakref.h"
+
+#if wxUSE_EXCEPTIONS
+    #include <future>
+#endif // wxUSE_EXCEPTIONS
+
+// ============================================================================
+// wxFutureStateBase implementation
+// ============================================================================
+
+wxFutureStateBase::wxFutureStateBase()
+    : m_claimed(false),
+      m_ready(false)
+#if wxUSE_THREADS
+    , m_cond(m_mutex)
+#endif // wxUSE_THREADS
+{
+}
+
+wxFutureStateBase::~wxFutureStateBase()
+{
+}
+
+void wxFutureStateBase::Wait()
+{
+#if wxUSE_THREADS
+    wxMutexLocker lock(m_mutex);
+
+    while ( !m_ready )
+        m_cond.Wait();
+#else // !wxUSE_THREADS
+    // Without threads, nothing can make the state ready while we're waiting.
+    wxCHECK_RET( m_ready, "waiting for the future would block forever" );
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+}
+
+void wxFutureStateBase::OnReady(std::function<void ()> func)
+{
+    {
+#if wxUSE_THREADS
+        wxMutexLocker lock(m_mutex);
+#endif // wxUSE_THREADS
+
+        if ( !m_ready )
+        {
+            m_callbacks.push_back(std::move(func));
+            return;
+        }
+    }
+
+    func();
+}
+
+void wxFutureStateBase::MakeReady()
+{
+    std::vector< std::function<void ()> > callbacks;
+
+    {
+#if wxUSE_THREADS
+        wxMutexLocker lock(m_mutex);
+#endif // wxUSE_THREADS
+
+        m_ready.store(true, std::memory_order_release);
+        callbacks.swap(m_callbacks);
+
+#if wxUSE_THREADS
+        m_cond.Broadcast();
+#endif // wxUSE_THREADS
+    }
+
+    // Call the continuations without holding the lock as they may add more
+    // continuations to this state.
+    for ( const auto& callback : callbacks )
+        callback();
+}
+
+#if wxUSE_EXCEPTIONS
+
+bool wxFutureStateBase::SetException(const std::exception_ptr& exception)
+{
+    wxCHECK_MSG( exception, false, "null exception" );
+
+    if ( !Claim() )
+        return false;
+
+    m_exception = exception;
+
+    MakeReady();
+
+    return true;
+}
+
+#endif // wxUSE_EXCEPTIONS
+
+void wxFutureStateBase::Abandon()
+{
+#if wxUSE_EXCEPTIONS
+    if ( !m_claimed )
+    {
+        SetException(std::make_exception_ptr(
+            std::future_error(std::future_errc::broken_promise)));
+    }
+#endif // wxUSE_EXCEPTIONS
+
+    // Without exceptions, there is no way to report the error, so the state
+    // just never becomes ready.
+}
+
+// ============================================================================
+// wxPrivate::FutureHandlerRef implementation
+// ============================================================================
+
+namespace
+{
+
+// Delete the weak reference in the main thread, as this can't be done
+// concurrently with destroying the handler it refers to.
+void DeleteHandlerRef(wxWeakRef<wxEvtHandler>* ref)
+{
+    if ( wxIsMainThread() || !wxTheApp )
+    {
+        delete ref;
+        return;
+    }
+
+    wxTheApp->CallAfter([ref]() { delete ref; });
+}
+
+} // anonymous namespace
+
+wxPrivate::FutureHandlerRef::FutureHandlerRef(wxEvtHandler* handler)
+    : m_ref(new wxWeakRef<wxEvtHandler>(handler), DeleteHandlerRef)
+{
+    wxASSERT_MSG( wxIsMainThread(),
+                  "wxFuture::Then() with a handler must be called from the main thread" );
+}
+
+void
+wxPrivate::FutureHandlerRef::CallAfter(const std::function<void ()>& func) const
+{
+    wxCHECK_RET( wxTheApp, "no application to call the continuation" );
+
+    const std::shared_ptr< wxWeakRef<wxEvtHandler> > ref = m_ref;
+    wxTheApp->CallAfter([ref, func]()
+    {
+        // If the handler was destroyed, just drop the function, which makes
+        // the future for its result ready with the broken promise exception.
+        if ( ref->get() )
+            func();
+    });
+}
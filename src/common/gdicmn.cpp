@@ -31,10 +31,21 @@
     #include "wx/math.h"
 #endif
 
+#include <atomic>
+#include <list>
 #include <unordered_map>
 
 wxIMPLEMENT_ABSTRACT_CLASS(wxGDIObject, wxObject);
 
+/* static */
+unsigned long wxGDIRefData::GetNextSerial()
+{
+    // GDI objects may be created in the worker threads under some platforms.
+    static std::atomic<unsigned long> s_lastSerial(0);
+
+    return ++s_lastSerial;
+}
+
 
 WXDLLIMPEXP_DATA_CORE(wxBrushList*) wxTheBrushList;
 WXDLLIMPEXP_DATA_CORE(wxFontList*)  wxTheFontList;
@@ -736,64 +747,340 @@ void wxDeleteStockLists()
 // wxTheXXXList stuff (semi-obsolete)
 // ============================================================================
 
+// The objects are kept in a list in the order of their creation or, if the
+// maximal number of objects is limited, of their last use, so that the least
+// recently used object is always the first one. They are also indexed by the
+// hash of their attributes computed by the derived class to find them quickly.
+class wxGDIObjListImpl
+{
+public:
+    struct Entry
+    {
+        wxObject* obj;
+        size_t hash;
+    };
+
+    typedef std::list<Entry> List;
+
+    ~wxGDIObjListImpl()
+    {
+        for ( List::const_iterator it = m_objects.begin();
+              it != m_objects.end();
+              ++it )
+        {
+            delete it->obj;
+        }
+    }
+
+    // Mark the object as being the most recently used one.
+    wxObject* Use(List::iterator it)
+    {
+        if ( m_maxCount )
+            m_objects.splice(m_objects.end(), m_objects, it);
+
+        return it->obj;
+    }
+
+    // Delete the least recently used objects if there are too many of them.
+    void Trim()
+    {
+        if ( !m_maxCount )
+            return;
+
+        while ( m_objects.size() > m_maxCount )
+        {
+            const List::iterator oldest = m_objects.begin();
+
+            typedef std::unordered_multimap<size_t, List::iterator> Index;
+            const std::pair<Index::iterator, Index::iterator>
+                range = m_index.equal_range(oldest->hash);
+            for ( Index::iterator it = range.first; it != range.second; ++it )
+            {
+                if ( it->second == oldest )
+                {
+                    m_index.erase(it);
+                    break;
+                }
+            }
+
+            delete oldest->obj;
+            m_objects.erase(oldest);
+        }
+    }
+
+    List m_objects;
+    std::unordered_multimap<size_t, List::iterator> m_index;
+    size_t m_maxCount = 0;
+};
+
+namespace
+{
+
+inline size_t CombineHash(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+inline size_t GetColourHash(const wxColour& colour)
+{
+    return colour.IsOk() ? colour.GetRGBA() : 0;
+}
+
+} // anonymous namespace
+
 wxGDIObjListBase::wxGDIObjListBase()
+    : m_impl(new wxGDIObjListImpl)
 {
 }
 
 wxGDIObjListBase::~wxGDIObjListBase()
 {
-    for (wxList::compatibility_iterator node = list.GetFirst(); node; node = node->GetNext())
+    delete m_impl;
+}
+
+void wxGDIObjListBase::SetMaxCount(size_t maxCount)
+{
+    m_impl->m_maxCount = maxCount;
+    m_impl->Trim();
+}
+
+size_t wxGDIObjListBase::GetMaxCount() const
+{
+    return m_impl->m_maxCount;
+}
+
+size_t wxGDIObjListBase::GetCount() const
+{
+    return m_impl->m_objects.size();
+}
+
+wxObject*
+wxGDIObjListBase::Find(size_t hash, MatchFunc match, const void* data)
+{
+    // Note that we can't just return the first object with the same hash, as
+    // different objects may have the same hash and, also, the objects in the
+    // list may have been modified since they were added to it, in which case
+    // their hash doesn't correspond to their attributes any more.
+    typedef std::unordered_multimap<size_t, wxGDIObjListImpl::List::iterator> Index;
+    const std::pair<Index::iterator, Index::iterator>
+        range = m_impl->m_index.equal_range(hash);
+    for ( Index::iterator it = range.first; it != range.second; ++it )
     {
-        delete static_cast<wxObject*>(node->GetData());
+        if ( match(it->second->obj, data) )
+            return m_impl->Use(it->second);
     }
+
+    return nullptr;
 }
 
-wxPen *wxPenList::FindOrCreatePen (const wxColour& colour, int width, wxPenStyle style)
+wxObject* wxGDIObjListBase::FindAny(MatchFunc match, const void* data)
 {
-    for ( wxList::compatibility_iterator node = list.GetFirst();
-          node;
-          node = node->GetNext() )
+    for ( wxGDIObjListImpl::List::iterator it = m_impl->m_objects.begin();
+          it != m_impl->m_objects.end();
+          ++it )
     {
-        wxPen * const pen = (wxPen *) node->GetData();
-        if ( pen->GetWidth () == width &&
-                pen->GetStyle () == style &&
-                    pen->GetColour() == colour )
-            return pen;
+        if ( match(it->obj, data) )
+            return m_impl->Use(it);
     }
 
-    wxPen* pen = nullptr;
+    return nullptr;
+}
+
+void wxGDIObjListBase::Add(wxObject* obj, size_t hash)
+{
+    const wxGDIObjListImpl::Entry entry = { obj, hash };
+    m_impl->m_objects.push_back(entry);
+    m_impl->m_index.insert(std::make_pair(hash, --m_impl->m_objects.end()));
+
+    m_impl->Trim();
+}
+
+namespace
+{
+
+struct PenAttributes
+{
+    const wxColour& colour;
+    int width;
+    wxPenStyle style;
+};
+
+size_t GetPenHash(const wxColour& colour, int width, wxPenStyle style)
+{
+    size_t hash = GetColourHash(colour);
+    hash = CombineHash(hash, width);
+    hash = CombineHash(hash, style);
+    return hash;
+}
+
+bool PenMatches(const wxObject* obj, const void* data)
+{
+    const wxPen* const pen = static_cast<const wxPen*>(obj);
+    const PenAttributes& attrs = *static_cast<const PenAttributes*>(data);
+
+    return pen->GetWidth() == attrs.width &&
+            pen->GetStyle() == attrs.style &&
+                pen->GetColour() == attrs.colour;
+}
+
+} // anonymous namespace
+
+wxPen *wxPenList::FindOrCreatePen (const wxColour& colour, int width, wxPenStyle style)
+{
+    const PenAttributes attrs = { colour, width, style };
+    wxPen* pen = static_cast<wxPen*>(Find(GetPenHash(colour, width, style),
+                                          PenMatches, &attrs));
+    if ( pen )
+        return pen;
+
     wxPen penTmp(colour, width, style);
     if (penTmp.IsOk())
     {
         pen = new wxPen(penTmp);
-        list.Append(pen);
+
+        // Use the attributes of the pen itself rather than the requested ones
+        // for consistency with PenMatches().
+        Add(pen, GetPenHash(pen->GetColour(), pen->GetWidth(), pen->GetStyle()));
     }
 
     return pen;
 }
 
+namespace
+{
+
+struct BrushAttributes
+{
+    const wxColour& colour;
+    wxBrushStyle style;
+};
+
+size_t GetBrushHash(const wxColour& colour, wxBrushStyle style)
+{
+    return CombineHash(GetColourHash(colour), style);
+}
+
+bool BrushMatches(const wxObject* obj, const void* data)
+{
+    const wxBrush* const brush = static_cast<const wxBrush*>(obj);
+    const BrushAttributes& attrs = *static_cast<const BrushAttributes*>(data);
+
+    return brush->GetStyle() == attrs.style && brush->GetColour() == attrs.colour;
+}
+
+} // anonymous namespace
+
 wxBrush *wxBrushList::FindOrCreateBrush (const wxColour& colour, wxBrushStyle style)
 {
-    for ( wxList::compatibility_iterator node = list.GetFirst();
-          node;
-          node = node->GetNext() )
-    {
-        wxBrush * const brush = (wxBrush *) node->GetData ();
-        if ( brush->GetStyle() == style && brush->GetColour() == colour )
-            return brush;
-    }
+    const BrushAttributes attrs = { colour, style };
+    wxBrush* brush = static_cast<wxBrush*>(Find(GetBrushHash(colour, style),
+                                                BrushMatches, &attrs));
+    if ( brush )
+        return brush;
 
-    wxBrush* brush = nullptr;
     wxBrush brushTmp(colour, style);
     if (brushTmp.IsOk())
     {
         brush = new wxBrush(brushTmp);
-        list.Append(brush);
+        Add(brush, GetBrushHash(brush->GetColour(), brush->GetStyle()));
     }
 
     return brush;
 }
 
+namespace
+{
+
+struct FontAttributes
+{
+    // The attributes adjusted for the platform oddities.
+    const wxFontInfo& info;
+
+    // The attributes originally passed to FindOrCreateFont().
+    const wxFontInfo& fontInfo;
+};
+
+// Only the attributes which must match exactly can be used for the hash, as
+// the face name, family and encoding are not compared for all fonts, and the
+// size is only used if it is specified in points, see FindOrCreateFont().
+size_t
+GetFontHash(double pointSize, wxFontStyle style, int weight, bool underlined)
+{
+    size_t hash = std::hash<double>()(pointSize);
+    hash = CombineHash(hash, style);
+    hash = CombineHash(hash, weight);
+    hash = CombineHash(hash, underlined);
+    return hash;
+}
+
+bool FontMatches(const wxObject* obj, const void* data)
+{
+    const wxFont* const font = static_cast<const wxFont*>(obj);
+    const FontAttributes& attrs = *static_cast<const FontAttributes*>(data);
+    const wxFontInfo& info = attrs.info;
+
+    bool same;
+    if ( info.IsUsingSizeInPixels() )
+    {
+        // When the width is 0, it means that we don't care about it.
+        if ( info.GetPixelSize().x == 0 )
+            same = font->GetPixelSize().y == info.GetPixelSize().y;
+        else
+            same = font->GetPixelSize() == info.GetPixelSize();
+    }
+    else
+    {
+        same = font->GetFractionalPointSize() == info.GetFractionalPointSize();
+    }
+
+    if ( !same ||
+         font->GetStyle () != info.GetStyle() ||
+         font->GetWeight () != info.GetWeight() ||
+         font->GetUnderlined () != info.IsUnderlined() )
+    {
+        return false;
+    }
+
+    // empty facename matches anything at all: this is bad because
+    // depending on which fonts are already created, we might get back
+    // a different font if we create it with empty facename, but it is
+    // still better than never matching anything in the cache at all
+    // in this case
+    const wxString fontFaceName(font->GetFaceName());
+
+    if (info.GetFaceName().empty() || fontFaceName.empty())
+    {
+        same = font->GetFamily() == info.GetFamily();
+
+        // In wxOSX fonts created using wxFONTFAMILY_DEFAULT can return
+        // either it or wxFONTFAMILY_SWISS from GetFamily(), which is a
+        // bug and needs to be fixed (see #23144), but for now work
+        // around it here.
+#ifdef __WXOSX__
+        if ( !same &&
+             attrs.fontInfo.GetFamily() == wxFONTFAMILY_DEFAULT &&
+             font->GetFamily() == wxFONTFAMILY_DEFAULT )
+        {
+            same = true;
+        }
+#endif // __WXOSX__
+    }
+    else
+    {
+        same = fontFaceName == info.GetFaceName();
+    }
+
+    if ( same && (info.GetEncoding() != wxFONTENCODING_DEFAULT) )
+    {
+        // have to match the encoding too
+        same = font->GetEncoding() == info.GetEncoding();
+    }
+
+    return same;
+}
+
+} // anonymous namespace
+
 wxFont *wxFontList::FindOrCreateFont(const wxFontInfo& fontInfo)
 {
     // info is fontInfo adjusted for platform oddities
@@ -819,79 +1106,24 @@ wxFont *wxFontList::FindOrCreateFont(const wxFontInfo& fontInfo)
         info.Style(wxFONTSTYLE_ITALIC);
  #endif // __WXMSW__
 
-    wxFont *font;
-    wxList::compatibility_iterator node;
-    for (node = list.GetFirst(); node; node = node->GetNext())
-    {
-        bool same;
-
-        font = (wxFont *)node->GetData();
+    const FontAttributes attrs = { info, fontInfo };
 
-        if ( info.IsUsingSizeInPixels() )
-        {
-            // When the width is 0, it means that we don't care about it.
-            if ( info.GetPixelSize().x == 0 )
-                same = font->GetPixelSize().y == info.GetPixelSize().y;
-            else
-                same = font->GetPixelSize() == info.GetPixelSize();
-        }
-        else
-        {
-            same = font->GetFractionalPointSize() == info.GetFractionalPointSize();
-        }
-
-        if ( same &&
-             font->GetStyle () == info.GetStyle() &&
-             font->GetWeight () == info.GetWeight() &&
-             font->GetUnderlined () == info.IsUnderlined() )
-        {
-            // empty facename matches anything at all: this is bad because
-            // depending on which fonts are already created, we might get back
-            // a different font if we create it with empty facename, but it is
-            // still better than never matching anything in the cache at all
-            // in this case
-            const wxString fontFaceName(font->GetFaceName());
-
-            if (info.GetFaceName().empty() || fontFaceName.empty())
-            {
-                same = font->GetFamily() == info.GetFamily();
-
-                // In wxOSX fonts created using wxFONTFAMILY_DEFAULT can return
-                // either it or wxFONTFAMILY_SWISS from GetFamily(), which is a
-                // bug and needs to be fixed (see #23144), but for now work
-                // around it here.
-#ifdef __WXOSX__
-                if ( !same &&
-                     fontInfo.GetFamily() == wxFONTFAMILY_DEFAULT &&
-                     font->GetFamily() == wxFONTFAMILY_DEFAULT )
-                {
-                    same = true;
-                }
-#endif // __WXOSX__
-            }
-            else
-            {
-                same = fontFaceName == info.GetFaceName();
-            }
-
-            if ( same && (info.GetEncoding() != wxFONTENCODING_DEFAULT) )
-            {
-                // have to match the encoding too
-                same = font->GetEncoding() == info.GetEncoding();
-            }
-
-            if ( same )
-            {
-                return font;
-            }
-        }
-    }
+    // Fonts requested using their pixel size can match fonts created using
+    // the point size, so we can't use the hash to find them.
+    wxObject* const obj = info.IsUsingSizeInPixels()
+        ? FindAny(FontMatches, &attrs)
+        : Find(GetFontHash(info.GetFractionalPointSize(), info.GetStyle(),
+                           info.GetWeight(), info.IsUnderlined()),
+               FontMatches, &attrs);
+    if ( obj )
+        return static_cast<wxFont*>(obj);
 
     // font not found, create the new one
-    font = new wxFont(info);
+    wxFont* font = new wxFont(info);
     if (font->IsOk())
     {
-        list.Append(font);
+        Add(font, GetFontHash(font->GetFractionalPointSize(), font->GetStyle(),
+                              font->GetWeight(), font->GetUnderlined()));
     }
     else
     {
@@ -197,6 +197,32 @@ void wxGraphicsMatrix::TransformDistance( wxDouble *dx, wxDouble *dy ) const
     GetMatrixData()->TransformDistance(dx,dy);
 }
 
+// Transforming many points is done by wxAffineMatrix2D, as this avoids the
+// overhead of calling the native function for each of them.
+static wxAffineMatrix2D wxGetAffineMatrix(const wxGraphicsMatrix& m)
+{
+    wxDouble a, b, c, d, tx, ty;
+    m.Get(&a, &b, &c, &d, &tx, &ty);
+
+    wxAffineMatrix2D affine;
+    affine.Set(wxMatrix2D(a, b, c, d), wxPoint2DDouble(tx, ty));
+    return affine;
+}
+
+void wxGraphicsMatrix::TransformPoints(const wxPoint2DDouble* in,
+                                       wxPoint2DDouble* out,
+                                       size_t n) const
+{
+    wxGetAffineMatrix(*this).TransformPoints(in, out, n);
+}
+
+void wxGraphicsMatrix::TransformRects(const wxRect2DDouble* in,
+                                      wxRect2DDouble* out,
+                                      size_t n) const
+{
+    wxGetAffineMatrix(*this).TransformRects(in, out, n);
+}
+
 // returns the native representation
 void * wxGraphicsMatrix::GetNativeMatrix() const
 {
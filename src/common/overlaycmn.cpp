@@ -80,6 +80,11 @@ void wxOverlay::SetOpacity(int alpha)
     m_impl->SetOpacity(alpha);
 }
 
+void wxOverlay::SetNextFrameArea(const wxRect& rect)
+{
+    m_impl->SetNextFrameArea(rect);
+}
+
 // ----------------------------------------------------------------------------
 
 wxOverlay::Impl::~Impl()
@@ -163,8 +168,34 @@ public:
     virtual void EndDrawing(wxDC* dc) override;
     virtual void Clear(wxDC* dc) override;
     virtual void Reset() override;
+    virtual void SetNextFrameArea(const wxRect& rect) override;
+
+private:
+    // Copy the parts of the given area not saved yet from the window.
+    void SaveArea(wxDC* dc, const wxRect& rect);
 
+    wxRect GetOverlayRect() const { return wxRect(m_x, m_y, m_width, m_height); }
+
+    // Get the bounding box of the drawing done on the DC, return false if
+    // nothing was drawn.
+    static bool GetBoundingBox(wxDC* dc, wxRect& rect);
+
+    // The window contents under the overlay, only the parts of it in
+    // m_regionSaved are valid: the contents is saved only before drawing over
+    // it for the first time, instead of copying the entire area in advance.
     wxBitmap m_bmpSaved;
+    wxRegion m_regionSaved;
+
+    // The parts of the window drawn over since the last Clear(), which need
+    // to be restored by the next call to it.
+    wxRegion m_regionDrawn;
+
+    // The area of the current frame, as set by SetNextFrameArea() or the
+    // entire overlay if it wasn't called.
+    wxRect m_rectFrame;
+    wxRect m_rectNextFrame;
+    bool m_hasNextFrameArea;
+
     int m_x;
     int m_y;
     int m_width;
@@ -177,6 +208,7 @@ wxOverlayImpl::wxOverlayImpl()
 {
      m_window = nullptr ;
      m_x = m_y = m_width = m_height = 0 ;
+     m_hasNextFrameArea = false;
 }
 
 wxOverlayImpl::~wxOverlayImpl()
@@ -207,52 +239,94 @@ void wxOverlayImpl::Init( wxDC* dc, int x , int y , int width , int height )
     {
         if (x != m_x || y != m_y || width != m_width || height != m_height)
         {
-            if (m_window)
-                m_window->Update();
-
-            // Area that needs to be copied from window
-            wxRect rect(x, y, width, height);
-            wxRegion region(rect);
-            rect.Intersect(wxRect(m_x, m_y, m_width, m_height));
-            region.Subtract(rect);
-            rect = region.GetBox();
-
+            // Keep the already saved contents which is still inside the
+            // overlay, the rest will be saved when it's drawn over.
             const wxBitmap bmpOld(m_bmpSaved);
             m_bmpSaved.Create(width, height, *dc);
-            wxMemoryDC dcMem(m_bmpSaved);
-
-            // Get new area from window
-            dcMem.Blit(rect.x - x, rect.y - y, rect.width, rect.height, dc, rect.x, rect.y);
-
-            // Copy old area to new position
-            dcMem.DrawBitmap(bmpOld, m_x - x, m_y - y);
+            {
+                wxMemoryDC dcMem(m_bmpSaved);
+                dcMem.DrawBitmap(bmpOld, m_x - x, m_y - y);
+            }
 
             m_x = x;
             m_y = y;
             m_width = width;
             m_height = height;
+
+            m_regionSaved.Intersect(GetOverlayRect());
         }
         return;
     }
     m_window = dc->GetWindow();
     m_bmpSaved.Create(width, height, *dc);
-    wxMemoryDC dcMem(m_bmpSaved);
+    m_regionSaved.Clear();
+    m_regionDrawn.Clear();
     m_x = x ;
     m_y = y ;
     m_width = width ;
     m_height = height ;
-    dcMem.Blit(0, 0, m_width, m_height,
-        dc, x, y);
+}
+
+void wxOverlayImpl::SaveArea(wxDC* dc, const wxRect& rect)
+{
+    // Anything not saved yet was never drawn over, so the window still shows
+    // its real contents there.
+    wxRegion regionToSave(rect);
+    regionToSave.Subtract(m_regionSaved);
+    if ( regionToSave.IsEmpty() )
+        return;
+
+    wxMemoryDC dcMem(m_bmpSaved);
+    for ( wxRegionIterator it(regionToSave); it; ++it )
+    {
+        const wxRect r = it.GetRect();
+        dcMem.Blit(r.x - m_x, r.y - m_y, r.width, r.height, dc, r.x, r.y);
+    }
+
+    m_regionSaved.Union(regionToSave);
+}
+
+void wxOverlayImpl::SetNextFrameArea(const wxRect& rect)
+{
+    m_rectNextFrame = rect;
+    m_hasNextFrameArea = true;
 }
 
 void wxOverlayImpl::Clear(wxDC* dc)
 {
-    dc->DrawBitmap(m_bmpSaved, m_x, m_y);
+    // Only restore the parts which were really drawn over.
+    m_regionDrawn.Intersect(m_regionSaved);
+    if ( m_regionDrawn.IsEmpty() )
+        return;
+
+    // Restoring the window contents is not drawing on the overlay, so
+    // preserve the bounding box used to determine the drawn area.
+    wxRect rectBBox;
+    const bool hasBBox = GetBoundingBox(dc, rectBBox);
+
+    wxMemoryDC dcMem(m_bmpSaved);
+    for ( wxRegionIterator it(m_regionDrawn); it; ++it )
+    {
+        const wxRect r = it.GetRect();
+        dc->Blit(r.x, r.y, r.width, r.height, &dcMem, r.x - m_x, r.y - m_y);
+    }
+
+    m_regionDrawn.Clear();
+
+    dc->ResetBoundingBox();
+    if ( hasBBox )
+    {
+        dc->CalcBoundingBox(rectBBox.GetLeft(), rectBBox.GetTop());
+        dc->CalcBoundingBox(rectBBox.GetRight(), rectBBox.GetBottom());
+    }
 }
 
 void wxOverlayImpl::Reset()
 {
     m_bmpSaved.UnRef();
+    m_regionSaved.Clear();
+    m_regionDrawn.Clear();
+    m_hasNextFrameArea = false;
 
     if ( m_window )
         m_window->Refresh();
@@ -260,12 +334,62 @@ void wxOverlayImpl::Reset()
 
 void wxOverlayImpl::BeginDrawing(wxDC* dc)
 {
-    // Make sure no drawing is done outside of overlay area
-    dc->SetClippingRegion(m_x, m_y, m_width, m_height);
+    m_rectFrame = GetOverlayRect();
+    if ( m_hasNextFrameArea )
+    {
+        m_rectFrame.Intersect(m_rectNextFrame);
+        m_hasNextFrameArea = false;
+    }
+
+    SaveArea(dc, m_rectFrame);
+
+    // Make sure no drawing is done outside of the frame area, but still
+    // allow Clear() to restore the area drawn by the previous frames.
+    wxRect rectClip = m_rectFrame;
+    if ( !m_regionDrawn.IsEmpty() )
+        rectClip.Union(m_regionDrawn.GetBox());
+    rectClip.Intersect(GetOverlayRect());
+
+    dc->SetClippingRegion(rectClip);
+
+    dc->ResetBoundingBox();
 }
 
-void wxOverlayImpl::EndDrawing(wxDC* WXUNUSED(dc))
+void wxOverlayImpl::EndDrawing(wxDC* dc)
 {
+    if ( !dc )
+        return;
+
+    // Use the bounding box of what was drawn, slightly enlarged to account
+    // for the pen width and anti-aliasing, if we have it, or the entire frame
+    // area otherwise.
+    wxRect rectDrawn;
+    if ( GetBoundingBox(dc, rectDrawn) )
+    {
+        rectDrawn.Inflate(wxMax(2, dc->GetPen().GetWidth()));
+        rectDrawn.Intersect(m_rectFrame);
+    }
+    else
+    {
+        rectDrawn = m_rectFrame;
+    }
+
+    if ( !rectDrawn.IsEmpty() )
+        m_regionDrawn.Union(rectDrawn);
+}
+
+/* static */
+bool wxOverlayImpl::GetBoundingBox(wxDC* dc, wxRect& rect)
+{
+    // There is no way to check if the bounding box is valid, but it is
+    // unlikely that something was drawn only at the origin, so consider that
+    // nothing was drawn, or that it didn't update the bounding box, then.
+    if ( !dc->MinX() && !dc->MaxX() && !dc->MinY() && !dc->MaxY() )
+        return false;
+
+    rect = wxRect(wxPoint(dc->MinX(), dc->MinY()),
+                  wxPoint(dc->MaxX(), dc->MaxY()));
+    return true;
 }
 
 #ifndef wxHAS_NATIVE_OVERLAY
@@ -31,6 +31,31 @@ wxDEFINE_EVENT( wxEVT_END_PROCESS, wxProcessEvent );
 wxIMPLEMENT_DYNAMIC_CLASS(wxProcess, wxEvtHandler);
 wxIMPLEMENT_DYNAMIC_CLASS(wxProcessEvent, wxEvent);
 
+namespace
+{
+
+// Process used by wxExecuteAsync() to make the future ready on termination.
+class wxFutureProcess : public wxProcess
+{
+public:
+    explicit wxFutureProcess(const wxPromise<int>& promise)
+        : m_promise(promise)
+    {
+    }
+
+    virtual void OnTerminate(int WXUNUSED(pid), int status) override
+    {
+        m_promise.SetValue(status);
+
+        delete this;
+    }
+
+private:
+    wxPromise<int> m_promise;
+};
+
+} // anonymous namespace
+
 // ============================================================================
 // wxProcess implementation
 // ============================================================================
@@ -74,6 +99,30 @@ wxProcess *wxProcess::Open(const wxString& cmd, int flags)
     return process;
 }
 
+wxFuture<int>
+wxExecuteAsync(const wxString& command, int flags, const wxExecuteEnv *env)
+{
+    wxASSERT_MSG( !(flags & wxEXEC_SYNC), wxT("wxEXEC_SYNC should not be used." ));
+
+    wxPromise<int> promise;
+    const wxFuture<int> future = promise.GetFuture();
+
+    wxFutureProcess* const process = new wxFutureProcess(promise);
+    const long pid = wxExecute(command, flags & ~wxEXEC_SYNC, process, env);
+    if ( !pid )
+    {
+        // couldn't launch the process
+        delete process;
+        promise.SetValue(-1);
+    }
+    else
+    {
+        process->SetPid(pid);
+    }
+
+    return future;
+}
+
 // ----------------------------------------------------------------------------
 // wxProcess termination
 // ----------------------------------------------------------------------------
@@ -120,11 +120,19 @@ void wxTextMeasureBase::GetMultiLineTextExtent(const wxString& text,
     if ( !height )
         height = &unusedHeight;
 
+    MeasuringGuard guard(*this);
+
+    DoGetMultiLineTextExtent(text, width, height, heightOneLine);
+}
+
+void wxTextMeasureBase::DoGetMultiLineTextExtent(const wxString& text,
+                                                 wxCoord *width,
+                                                 wxCoord *height,
+                                                 wxCoord *heightOneLine)
+{
     *width = 0;
     *height = 0;
 
-    MeasuringGuard guard(*this);
-
     // It's noticeably faster to handle the case of a string which isn't
     // actually multiline specially here, to skip iteration above in this case.
     if ( text.find('\n') == wxString::npos )
@@ -189,6 +197,37 @@ void wxTextMeasureBase::GetMultiLineTextExtent(const wxString& text,
         *heightOneLine = heightLine;
 }
 
+void wxTextMeasureBase::GetTextExtents(const wxArrayString& strings,
+                                       wxSize* sizes)
+{
+    if ( strings.empty() )
+        return;
+
+    MeasuringGuard guard(*this);
+
+    for ( size_t i = 0; i < strings.size(); ++i )
+        DoGetMultiLineTextExtent(strings[i], &sizes[i].x, &sizes[i].y, nullptr);
+}
+
+int wxTextMeasureBase::GetMaxTextWidth(const wxArrayString& strings)
+{
+    if ( strings.empty() )
+        return 0;
+
+    MeasuringGuard guard(*this);
+
+    wxCoord w, h, widthMax = 0;
+    for ( size_t i = 0; i < strings.size(); ++i )
+    {
+        DoGetMultiLineTextExtent(strings[i], &w, &h, nullptr);
+
+        if ( w > widthMax )
+            widthMax = w;
+    }
+
+    return widthMax;
+}
+
 wxSize wxTextMeasureBase::GetLargestStringExtent(size_t n,
                                                  const wxString* strings)
 {
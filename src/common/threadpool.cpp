@@ -0,0 +1,749 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/threadpool.cpp
+// Purpose:     wxThreadPool and wxTaskGroup implementation
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_THREADS
+
+#include "wx/threadpool.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/event.h"
+    #include "wx/intl.h"
+    #include "wx/log.h"
+    #include "wx/module.h"
+    #include "wx/utils.h"
+#endif
+
+#include "wx/weakref.h"
+
+#include <deque>
+#include <exception>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// private classes
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// The queue of the tasks of a single worker.
+struct wxTaskQueue
+{
+    wxCriticalSection lock;
+    std::deque<wxThreadPool::Task> tasks;
+};
+
+// The pool whose worker thread is running the current code, if any, and the
+// index of this worker in it.
+thread_local wxThreadPoolImpl* gs_currentPool = nullptr;
+thread_local size_t gs_currentWorker = 0;
+
+// The pool returned by wxThreadPool::GetDefault(), created on demand.
+wxThreadPool* gs_defaultPool = nullptr;
+wxCriticalSection gs_defaultPoolLock;
+
+// Set when the default pool is destroyed during the library shutdown.
+bool gs_defaultPoolDestroyed = false;
+
+} // anonymous namespace
+
+class wxThreadPoolImpl
+{
+public:
+    explicit wxThreadPoolImpl(int numWorkers);
+    ~wxThreadPoolImpl();
+
+    int GetWorkerCount() const { return static_cast<int>(m_threads.size()); }
+    bool IsCurrentWorker() const { return gs_currentPool == this; }
+
+    void Push(wxThreadPool::Task&& task);
+    bool TryPop(wxThreadPool::Task& task);
+    void RunTask(wxThreadPool::Task& task);
+
+private:
+    class WorkerThread : public wxThread
+    {
+    public:
+        WorkerThread(wxThreadPoolImpl& impl, size_t index)
+            : wxThread(wxTHREAD_JOINABLE),
+              m_impl(impl),
+              m_index(index)
+        {
+        }
+
+        virtual void* Entry() override
+        {
+            m_impl.WorkerMain(m_index);
+
+            return nullptr;
+        }
+
+    private:
+        wxThreadPoolImpl& m_impl;
+        const size_t m_index;
+    };
+
+    void WorkerMain(size_t index);
+
+    bool PopFrom(size_t index, bool newest, wxThreadPool::Task& task);
+
+    // One queue per worker and the last one for the tasks posted from the
+    // threads not belonging to the pool.
+    std::vector<wxTaskQueue*> m_queues;
+    std::vector<WorkerThread*> m_threads;
+
+    // The total number of the tasks in all the queues. Note that it is
+    // incremented before adding the task to the queue and decremented after
+    // removing it, so it can only overestimate the number of tasks.
+    std::atomic<size_t> m_numQueued;
+
+    // The number of the workers waiting for the condition below.
+    std::atomic<int> m_numSleeping;
+
+    // Set when the pool is being destroyed.
+    std::atomic<bool> m_stopping;
+
+    wxMutex m_sleepMutex;
+    wxCondition m_sleepCond;
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadPoolImpl);
+};
+
+class wxTaskGroupState : public std::enable_shared_from_this<wxTaskGroupState>
+{
+public:
+    wxTaskGroupState() = default;
+
+    void AddTask(wxThreadPool::Task&& task);
+
+    // Execute the oldest of the tasks of this group which haven't started
+    // yet, if any, and return true, or just return false if there are none.
+    bool RunNextTask();
+
+    void OnTaskDone();
+
+#if wxUSE_EXCEPTIONS
+    void OnException(std::exception_ptr exception);
+#endif // wxUSE_EXCEPTIONS
+
+    // Arrange for RunContinuation() to be called in the main thread.
+    void ScheduleContinuation();
+
+    // Call the continuation, if any, unless its handler was destroyed. This
+    // must be called in the main thread.
+    void RunContinuation();
+
+    wxCancellationToken m_token;
+
+    // The number of the tasks not completed yet.
+    std::atomic<size_t> m_numPending{0};
+
+    // Protects all the fields below and is used with the condition signalled
+    // when there are no more pending tasks or a new task is added.
+    wxMutex m_mutex;
+    wxCondition m_changed{m_mutex};
+
+    // The tasks which haven't started yet: each of them is executed either
+    // by the pool or by the thread waiting for the group.
+    std::deque<wxThreadPool::Task> m_tasks;
+
+#if wxUSE_EXCEPTIONS
+    std::exception_ptr m_exception;
+#endif // wxUSE_EXCEPTIONS
+
+    std::function<void ()> m_continuation;
+
+    // The optional handler of the continuation, which is only used in the
+    // main thread, and whether it was specified at all.
+    wxWeakRef<wxEvtHandler> m_continuationHandler;
+    bool m_hasContinuationHandler = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxTaskGroupState);
+};
+
+// ============================================================================
+// wxThreadPoolImpl implementation
+// ============================================================================
+
+wxThreadPoolImpl::wxThreadPoolImpl(int numWorkers)
+    : m_numQueued(0),
+      m_numSleeping(0),
+      m_stopping(false),
+      m_sleepCond(m_sleepMutex)
+{
+    if ( numWorkers <= 0 )
+        numWorkers = wxMax(wxThread::GetCPUCount(), 1);
+
+    for ( int n = 0; n <= numWorkers; n++ )
+        m_queues.push_back(new wxTaskQueue);
+
+    for ( int n = 0; n < numWorkers; n++ )
+    {
+        WorkerThread* const thread = new WorkerThread(*this, m_threads.size());
+        if ( thread->Run() != wxTHREAD_NO_ERROR )
+        {
+            wxLogError(_("Failed to create a thread pool worker thread."));
+
+            delete thread;
+            break;
+        }
+
+        m_threads.push_back(thread);
+    }
+}
+
+wxThreadPoolImpl::~wxThreadPoolImpl()
+{
+    {
+        wxMutexLocker lock(m_sleepMutex);
+        m_stopping = true;
+        m_sleepCond.Broadcast();
+    }
+
+    // The workers exit once there are no more tasks, so this waits for all
+    // of them to be executed.
+    for ( WorkerThread* const thread : m_threads )
+    {
+        thread->Wait();
+        delete thread;
+    }
+
+    // Normally all the tasks are executed by the workers, but if we failed
+    // to create any, they're still here.
+    wxThreadPool::Task task;
+    while ( TryPop(task) )
+        RunTask(task);
+
+    for ( wxTaskQueue* const queue : m_queues )
+        delete queue;
+}
+
+void wxThreadPoolImpl::Push(wxThreadPool::Task&& task)
+{
+    // The tasks created by the workers go to their own queue, to be executed
+    // by them, unless they're stolen by the other ones.
+    wxTaskQueue& queue = IsCurrentWorker() ? *m_queues[gs_currentWorker]
+                                           : *m_queues.back();
+
+    m_numQueued++;
+
+    {
+        wxCriticalSectionLocker lock(queue.lock);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    // Notice that the worker going to sleep increments m_numSleeping before
+    // checking m_numQueued, so either we see it sleeping here or it sees the
+    // new task, and it can't miss the signal as it holds the mutex until it
+    // starts waiting.
+    if ( m_numSleeping )
+    {
+        wxMutexLocker lock(m_sleepMutex);
+        m_sleepCond.Signal();
+    }
+}
+
+bool
+wxThreadPoolImpl::PopFrom(size_t index, bool newest, wxThreadPool::Task& task)
+{
+    wxTaskQueue& queue = *m_queues[index];
+
+    wxCriticalSectionLocker lock(queue.lock);
+    if ( queue.tasks.empty() )
+        return false;
+
+    if ( newest )
+    {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+    }
+    else
+    {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+    }
+
+    m_numQueued--;
+
+    return true;
+}
+
+bool wxThreadPoolImpl::TryPop(wxThreadPool::Task& task)
+{
+    if ( !m_numQueued )
+        return false;
+
+    const size_t numWorkers = m_queues.size() - 1;
+
+    // Workers take the most recently added task from their own queue first,
+    // as it's the most likely to use the data still in the CPU cache.
+    size_t self = numWorkers;
+    if ( IsCurrentWorker() )
+    {
+        self = gs_currentWorker;
+        if ( PopFrom(self, true, task) )
+            return true;
+    }
+
+    // Then check the tasks posted from outside the pool.
+    if ( PopFrom(numWorkers, false, task) )
+        return true;
+
+    // And finally steal the oldest task from one of the other workers,
+    // starting with the next one to avoid all threads trying to steal from
+    // the same one.
+    for ( size_t n = 1; n <= numWorkers; n++ )
+    {
+        const size_t victim = (self + n) % (numWorkers + 1);
+        if ( victim != self && victim != numWorkers &&
+                PopFrom(victim, false, task) )
+            return true;
+    }
+
+    return false;
+}
+
+void wxThreadPoolImpl::RunTask(wxThreadPool::Task& task)
+{
+#if wxUSE_EXCEPTIONS
+    try
+    {
+#endif // wxUSE_EXCEPTIONS
+        task();
+#if wxUSE_EXCEPTIONS
+    }
+    catch ( ... )
+    {
+        // As in wxThread itself, let the application deal with it.
+        if ( wxTheApp )
+            wxTheApp->OnUnhandledException();
+    }
+#endif // wxUSE_EXCEPTIONS
+
+    // Destroy the task, and anything captured by it, right now and not when
+    // the next one is executed.
+    task = nullptr;
+}
+
+void wxThreadPoolImpl::WorkerMain(size_t index)
+{
+    gs_currentPool = this;
+    gs_currentWorker = index;
+
+    wxThreadPool::Task task;
+    for ( ;; )
+    {
+        if ( TryPop(task) )
+        {
+            RunTask(task);
+            continue;
+        }
+
+        wxMutexLocker lock(m_sleepMutex);
+
+        m_numSleeping++;
+        while ( !m_numQueued && !m_stopping )
+            m_sleepCond.Wait();
+        m_numSleeping--;
+
+        if ( m_stopping && !m_numQueued )
+            break;
+    }
+
+    gs_currentPool = nullptr;
+}
+
+// ============================================================================
+// wxThreadPool implementation
+// ============================================================================
+
+wxThreadPool::wxThreadPool(int numWorkers)
+    : m_impl(new wxThreadPoolImpl(numWorkers))
+{
+}
+
+wxThreadPool::~wxThreadPool()
+{
+    wxASSERT_MSG( !IsWorkerThread(),
+                  "thread pool can't be destroyed from its own task" );
+
+    delete m_impl;
+}
+
+/* static */
+wxThreadPool& wxThreadPool::GetDefault()
+{
+    wxCriticalSectionLocker lock(gs_defaultPoolLock);
+
+    // Creating the pool again would leak it, as well as its threads, as
+    // nothing would destroy it any more.
+    wxASSERT_MSG( !gs_defaultPoolDestroyed,
+                  "default thread pool used after the library shutdown" );
+
+    if ( !gs_defaultPool )
+        gs_defaultPool = new wxThreadPool;
+
+    return *gs_defaultPool;
+}
+
+int wxThreadPool::GetWorkerCount() const
+{
+    return m_impl->GetWorkerCount();
+}
+
+bool wxThreadPool::IsWorkerThread() const
+{
+    return m_impl->IsCurrentWorker();
+}
+
+void wxThreadPool::Post(Task task)
+{
+    wxCHECK_RET( task, "null task" );
+
+    m_impl->Push(std::move(task));
+}
+
+bool wxThreadPool::RunPendingTask()
+{
+    Task task;
+    if ( !m_impl->TryPop(task) )
+        return false;
+
+    m_impl->RunTask(task);
+
+    return true;
+}
+
+void wxThreadPool::DoParallelFor(size_t begin, size_t end, size_t grain,
+                                 const std::function<void (size_t, size_t)>& func,
+                                 const wxCancellationToken& token)
+{
+    if ( begin >= end )
+        return;
+
+    const size_t count = end - begin;
+    const size_t numWorkers = static_cast<size_t>(GetWorkerCount());
+
+    // Use several chunks per thread by default to balance the load if some
+    // of them take longer than the others.
+    if ( !grain )
+        grain = wxMax(count / (8*(numWorkers + 1)), static_cast<size_t>(1));
+
+    const size_t numChunks = (count - 1) / grain + 1;
+
+    // All the threads, including this one, take the next chunk to process
+    // until there are none left.
+    wxTaskGroup group(*this);
+    std::atomic<size_t> next(0);
+    const auto runChunks = [&]()
+    {
+        while ( !token.IsCancelled() && !group.IsCancelled() )
+        {
+            const size_t chunk = next++;
+            if ( chunk >= numChunks )
+                break;
+
+            const size_t first = begin + chunk*grain;
+            func(first, first + wxMin(grain, end - first));
+        }
+    };
+
+    for ( size_t n = wxMin(numChunks - 1, numWorkers); n; n-- )
+        group.Run(runChunks);
+
+#if wxUSE_EXCEPTIONS
+    try
+    {
+#endif // wxUSE_EXCEPTIONS
+        runChunks();
+#if wxUSE_EXCEPTIONS
+    }
+    catch ( ... )
+    {
+        // We must wait for the other threads using our local variables
+        // before returning, but stop them as soon as possible.
+        group.Cancel();
+        try
+        {
+            group.Wait();
+        }
+        catch ( ... )
+        {
+            // Ignore the other exceptions, we rethrow the first one below.
+        }
+
+        throw;
+    }
+#endif // wxUSE_EXCEPTIONS
+
+    group.Wait();
+}
+
+// ============================================================================
+// wxTaskGroup implementation
+// ============================================================================
+
+void wxTaskGroupState::AddTask(wxThreadPool::Task&& task)
+{
+    wxMutexLocker lock(m_mutex);
+
+    m_numPending++;
+    m_tasks.push_back(std::move(task));
+
+    // Wake up the threads waiting for the group to help with this task.
+    m_changed.Broadcast();
+}
+
+bool wxTaskGroupState::RunNextTask()
+{
+    wxThreadPool::Task task;
+    {
+        wxMutexLocker lock(m_mutex);
+        if ( m_tasks.empty() )
+            return false;
+
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+    }
+
+    if ( !m_token.IsCancelled() )
+    {
+#if wxUSE_EXCEPTIONS
+        try
+        {
+#endif // wxUSE_EXCEPTIONS
+            task();
+#if wxUSE_EXCEPTIONS
+        }
+        catch ( ... )
+        {
+            OnException(std::current_exception());
+        }
+#endif // wxUSE_EXCEPTIONS
+    }
+
+    // Destroy the task before signalling that it's done, as the objects
+    // captured by it may be used by the thread waiting for the group.
+    task = nullptr;
+
+    OnTaskDone();
+
+    return true;
+}
+
+void wxTaskGroupState::ScheduleContinuation()
+{
+    wxCHECK_RET( wxTheApp, "no application to call the continuation" );
+
+    // Don't use the continuation handler here, as this may be called from a
+    // worker thread while the handler is being destroyed in the main one.
+    const std::shared_ptr<wxTaskGroupState> self = shared_from_this();
+    wxTheApp->CallAfter([self]() { self->RunContinuation(); });
+}
+
+void wxTaskGroupState::RunContinuation()
+{
+    std::function<void ()> continuation;
+    {
+        wxMutexLocker lock(m_mutex);
+
+        continuation.swap(m_continuation);
+    }
+
+    // This could happen if we were scheduled more than once because more
+    // tasks were added after the continuation was scheduled.
+    if ( !continuation )
+        return;
+
+    if ( m_hasContinuationHandler )
+    {
+        const bool handlerAlive = m_continuationHandler.get() != nullptr;
+
+        m_continuationHandler.Release();
+        m_hasContinuationHandler = false;
+
+        if ( !handlerAlive )
+            return;
+    }
+
+    continuation();
+}
+
+void wxTaskGroupState::OnTaskDone()
+{
+    if ( --m_numPending )
+        return;
+
+    bool hasContinuation;
+    {
+        wxMutexLocker lock(m_mutex);
+
+        m_changed.Broadcast();
+
+        hasContinuation = static_cast<bool>(m_continuation);
+    }
+
+    if ( hasContinuation )
+        ScheduleContinuation();
+}
+
+#if wxUSE_EXCEPTIONS
+
+void wxTaskGroupState::OnException(std::exception_ptr exception)
+{
+    // Don't start the remaining tasks, their results won't be used anyhow.
+    m_token.Cancel();
+
+    wxMutexLocker lock(m_mutex);
+    if ( !m_exception )
+        m_exception = exception;
+}
+
+#endif // wxUSE_EXCEPTIONS
+
+wxTaskGroup::wxTaskGroup(wxThreadPool& pool)
+    : m_pool(pool),
+      m_state(std::make_shared<wxTaskGroupState>())
+{
+}
+
+wxTaskGroup::~wxTaskGroup()
+{
+}
+
+void wxTaskGroup::Run(wxThreadPool::Task task)
+{
+    wxCHECK_RET( task, "null task" );
+
+    const std::shared_ptr<wxTaskGroupState> state = m_state;
+
+    state->AddTask(std::move(task));
+
+    // Each task posted to the pool executes one of the tasks of the group,
+    // which may be different from the one added above if another thread
+    // took it in the meanwhile, or nothing at all if there are none left.
+    m_pool.Post([state]() { state->RunNextTask(); });
+}
+
+void wxTaskGroup::Wait()
+{
+    for ( ;; )
+    {
+        // Help with executing the tasks of this group instead of just waiting
+        // for them, this is required to avoid deadlocks when waiting from a
+        // worker. Notice that we don't execute any other tasks of the pool,
+        // as they could take arbitrarily long and, in the main thread, use
+        // the objects which can't be used from it.
+        if ( m_state->RunNextTask() )
+            continue;
+
+        wxMutexLocker lock(m_state->m_mutex);
+        if ( !m_state->m_numPending )
+            break;
+
+        // Wait until either all the tasks complete or a new one is added by
+        // one of them.
+        if ( m_state->m_tasks.empty() )
+            m_state->m_changed.Wait();
+    }
+
+#if wxUSE_EXCEPTIONS
+    std::exception_ptr exception;
+    {
+        wxMutexLocker lock(m_state->m_mutex);
+        exception.swap(m_state->m_exception);
+    }
+
+    if ( exception )
+        std::rethrow_exception(exception);
+#endif // wxUSE_EXCEPTIONS
+}
+
+bool wxTaskGroup::IsDone() const
+{
+    return !m_state->m_numPending;
+}
+
+void wxTaskGroup::Cancel()
+{
+    m_state->m_token.Cancel();
+}
+
+bool wxTaskGroup::IsCancelled() const
+{
+    return m_state->m_token.IsCancelled();
+}
+
+wxCancellationToken wxTaskGroup::GetCancellationToken() const
+{
+    return m_state->m_token;
+}
+
+void wxTaskGroup::ContinueWith(const std::function<void ()>& func,
+                               wxEvtHandler* handler)
+{
+    wxCHECK_RET( func, "null continuation" );
+    wxCHECK_RET( wxIsMainThread(),
+                 "continuation must be set from the main thread" );
+
+    bool done;
+    {
+        wxMutexLocker lock(m_state->m_mutex);
+
+        wxASSERT_MSG( !m_state->m_continuation,
+                      "task group continuation already set" );
+
+        m_state->m_continuation = func;
+
+        // This is safe to do as the handler is only used in the main thread.
+        m_state->m_continuationHandler = handler;
+        m_state->m_hasContinuationHandler = handler != nullptr;
+
+        done = !m_state->m_numPending;
+    }
+
+    if ( done )
+        m_state->ScheduleContinuation();
+}
+
+// ============================================================================
+// wxThreadPoolModule: destroys the default pool on shutdown
+// ============================================================================
+
+class wxThreadPoolModule : public wxModule
+{
+public:
+    wxThreadPoolModule()
+    {
+        // The default pool uses wxThread, so it must be destroyed before the
+        // threads module is cleaned up.
+        AddDependency(wxClassInfo::FindClass("wxThreadModule"));
+    }
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override
+    {
+        wxCriticalSectionLocker lock(gs_defaultPoolLock);
+
+        wxDELETE(gs_defaultPool);
+        gs_defaultPoolDestroyed = true;
+    }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxThreadPoolModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxThreadPoolModule, wxModule);
+
+#endif // wxUSE_THREADS
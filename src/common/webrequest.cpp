@@ -92,6 +92,14 @@ void wxWebRequestImpl::Cancel()
     DoCancel();
 }
 
+wxFuture<wxWebRequestEvent> wxWebRequestImpl::GetFuture()
+{
+    if ( !m_promise )
+        m_promise.reset(new wxPromise<wxWebRequestEvent>());
+
+    return m_promise->GetFuture();
+}
+
 void wxWebRequestImpl::SetFinalStateFromStatus()
 {
     const wxWebResponseImplPtr& resp = GetResponse();
@@ -369,6 +377,20 @@ void wxWebRequestImpl::ProcessStateEvent(wxWebRequest::State state, const wxStri
 
     m_handler->ProcessEvent(evt);
 
+    // Make the future ready before removing the file below, so that the
+    // continuations executed immediately can still use it. Note that the
+    // promise must not be kept as its value references this object.
+    //
+    // The promise is intentionally not fulfilled in State_Unauthorized, as
+    // the request continues if the credentials are provided and the future
+    // must then become ready with its final state. If they never are, the
+    // promise is broken when this object is destroyed, see StartAsync() docs.
+    if ( m_promise && release && state != wxWebRequest::State_Unauthorized )
+    {
+        std::unique_ptr< wxPromise<wxWebRequestEvent> > promise(std::move(m_promise));
+        promise->SetValue(evt);
+    }
+
     // Remove temporary file if we're using one and if it still exists: it
     // could have been deleted or moved away by the event handler.
     if ( !dataFile.empty() && wxFileExists(dataFile) )
@@ -465,6 +487,21 @@ void wxWebRequest::Start()
     m_impl->Start();
 }
 
+wxFuture<wxWebRequestEvent> wxWebRequest::StartAsync()
+{
+    wxCHECK_IMPL( wxFuture<wxWebRequestEvent>() );
+
+    wxCHECK_MSG( m_impl->GetState() == wxWebRequest::State_Idle,
+                 wxFuture<wxWebRequestEvent>(),
+                 "Completed requests can not be restarted" );
+
+    const wxFuture<wxWebRequestEvent> future = m_impl->GetFuture();
+
+    m_impl->Start();
+
+    return future;
+}
+
 void wxWebRequest::Cancel()
 {
     wxCHECK_IMPL_VOID();
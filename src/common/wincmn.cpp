@@ -83,6 +83,9 @@
 
 #include <math.h>
 
+#include <unordered_map>
+#include <vector>
+
 // Windows List
 WXDLLIMPEXP_DATA_CORE(wxWindowList) wxTopLevelWindows;
 
@@ -355,6 +358,9 @@ wxWindowBase::wxWindowBase()
     // as possible to allow its handlers to still see the undestroyed window
     m_isBeingDeleted = false;
 
+    m_registeredForUpdateUI = false;
+    m_idleHandlersChecked = false;
+
     m_freezeCount = 0;
 }
 
@@ -480,6 +486,9 @@ wxWindowBase::~wxWindowBase()
 
     wxASSERT_MSG( GetChildren().GetCount() == 0, wxT("children not destroyed") );
 
+    if ( m_registeredForUpdateUI )
+        RegisterForUpdateUI(false);
+
     // notify the parent about this window destruction
     if ( m_parent )
         m_parent->RemoveChild(this);
@@ -1447,6 +1456,9 @@ void wxWindowBase::PushEventHandler(wxEvtHandler *handlerToPush)
 
     SetEventHandler(handlerToPush);
 
+    // check if the new handler needs idle events during the next idle time
+    m_idleHandlersChecked = false;
+
 #if wxDEBUG_LEVEL
     // final checks of the operations done above:
     wxASSERT_MSG( handlerToPush->GetPreviousHandler() == nullptr,
@@ -1489,6 +1501,9 @@ wxEvtHandler *wxWindowBase::PopEventHandler(bool deleteHandler)
     // now firstHandler is completely unlinked; set secondHandler as the new window event handler
     SetEventHandler(secondHandler);
 
+    // check if this window still needs idle events during the next idle time
+    m_idleHandlersChecked = false;
+
     if ( deleteHandler )
     {
         wxDELETE(firstHandler);
@@ -1519,6 +1534,9 @@ bool wxWindowBase::RemoveEventHandler(wxEvtHandler *handlerToRemove)
         {
             handlerCur->Unlink();
 
+            // check if this window still needs idle events
+            m_idleHandlersChecked = false;
+
             wxASSERT_MSG( handlerCur != GetEventHandler(),
                         "the case Remove == Pop should was already handled" );
             return true;
@@ -2780,6 +2798,119 @@ void wxWindowBase::DoUpdateWindowUI(wxUpdateUIEvent& event)
         Show(event.GetShown());
 }
 
+namespace
+{
+
+// All the windows for which RegisterForUpdateUI() was called and the map from
+// the window to its index in this vector, used to remove the windows quickly.
+std::vector<wxWindowBase*> gs_updateUIWindows;
+std::unordered_map<wxWindowBase*, size_t> gs_updateUIIndices;
+
+// Index of the next window to update in gs_updateUIWindows, only used while
+// UpdateRegisteredWindowsUI() is running, which is indicated by the flag.
+size_t gs_updateUINext = 0;
+bool gs_updateUIInProgress = false;
+
+// Set if UpdateRegisteredWindowsUI() was called while it was already running.
+bool gs_updateUIPending = false;
+
+void MoveUpdateUIWindow(size_t from, size_t to)
+{
+    if ( from == to )
+        return;
+
+    wxWindowBase* const win = gs_updateUIWindows[from];
+    gs_updateUIWindows[to] = win;
+    gs_updateUIIndices[win] = to;
+}
+
+// Remove the window at the given position by moving another window into its
+// place, taking care to not skip any windows which hadn't been updated yet if
+// we're called from UpdateRegisteredWindowsUI().
+void RemoveUpdateUIWindow(size_t n)
+{
+    if ( gs_updateUIInProgress && n < gs_updateUINext )
+    {
+        // Replace the removed window with the last updated one and make its
+        // position the next one to update: it will be filled with the last
+        // window, which hadn't been updated yet, below.
+        MoveUpdateUIWindow(--gs_updateUINext, n);
+        n = gs_updateUINext;
+    }
+
+    MoveUpdateUIWindow(gs_updateUIWindows.size() - 1, n);
+    gs_updateUIWindows.pop_back();
+}
+
+} // anonymous namespace
+
+void wxWindowBase::RegisterForUpdateUI(bool registerWindow)
+{
+    if ( registerWindow == m_registeredForUpdateUI )
+        return;
+
+    m_registeredForUpdateUI = registerWindow;
+
+    if ( registerWindow )
+    {
+        gs_updateUIIndices[this] = gs_updateUIWindows.size();
+        gs_updateUIWindows.push_back(this);
+
+        // Give the newly registered window a chance to update its state.
+        wxUpdateUIEvent::RequestUpdate();
+    }
+    else
+    {
+        const auto it = gs_updateUIIndices.find(this);
+        wxCHECK_RET( it != gs_updateUIIndices.end(),
+                     "registered window not found" );
+
+        const size_t n = it->second;
+        gs_updateUIIndices.erase(it);
+
+        RemoveUpdateUIWindow(n);
+    }
+}
+
+/* static */
+void wxWindowBase::UpdateRegisteredWindowsUI()
+{
+    // This could be called recursively if an update handler dispatches the
+    // events, just remember to update the windows again later then.
+    if ( gs_updateUIInProgress )
+    {
+        gs_updateUIPending = true;
+        return;
+    }
+
+    // Reset the request before sending the events to allow the handlers to
+    // request another update if they change the state.
+    wxUpdateUIEvent::ResetUpdateRequest();
+
+    gs_updateUIInProgress = true;
+
+    // Note that the windows can be registered or unregistered, and even
+    // destroyed, by the event handlers, so iterate carefully.
+    for ( gs_updateUINext = 0; gs_updateUINext < gs_updateUIWindows.size(); )
+    {
+        wxWindowBase* const win = gs_updateUIWindows[gs_updateUINext++];
+
+        if ( win->IsBeingDeleted() || wxPendingDelete.Member(win) )
+            continue;
+
+        if ( wxUpdateUIEvent::CanUpdate(win) )
+            win->UpdateWindowUI(wxUPDATE_UI_FROMIDLE);
+    }
+
+    gs_updateUIInProgress = false;
+
+    if ( gs_updateUIPending )
+    {
+        gs_updateUIPending = false;
+        wxUpdateUIEvent::RequestUpdate();
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Idle processing
 // ----------------------------------------------------------------------------
@@ -2792,14 +2923,61 @@ bool wxWindowBase::SendIdleEvents(wxIdleEvent& event)
     OnInternalIdle();
 
     // should we send idle event to this window?
-    if (wxIdleEvent::GetMode() == wxIDLE_PROCESS_ALL ||
-        HasExtraStyle(wxWS_EX_PROCESS_IDLE))
+    switch ( wxIdleEvent::GetMode() )
     {
-        event.SetEventObject(this);
-        HandleWindowEvent(event);
+        case wxIDLE_PROCESS_SPECIFIED:
+            // Check the handlers again if we switch to the subscribed mode
+            // later, as they could have changed in the meanwhile.
+            m_idleHandlersChecked = false;
 
-        if (event.MoreRequested())
-            needMore = true;
+            if ( !HasExtraStyle(wxWS_EX_PROCESS_IDLE) )
+                break;
+            wxFALLTHROUGH;
+
+        case wxIDLE_PROCESS_ALL:
+            m_idleHandlersChecked = false;
+
+            event.SetEventObject(this);
+            HandleWindowEvent(event);
+
+            if (event.MoreRequested())
+                needMore = true;
+            break;
+
+        case wxIDLE_PROCESS_SUBSCRIBED:
+            // The subscribed windows get the idle events from
+            // wxEvtHandler::SendIdleEventToSubscribers(), but we still need
+            // to subscribe the windows using event tables or the handlers
+            // pushed on them the first time we see them, as this can't be
+            // done when they're created, and after their handlers change.
+            if ( !m_idleHandlersChecked )
+            {
+                m_idleHandlersChecked = true;
+
+                bool needsIdle = false;
+                for ( wxEvtHandler* handler = GetEventHandler();
+                      handler;
+                      handler = handler == this ? nullptr
+                                                : handler->GetNextHandler() )
+                {
+                    if ( handler->HasIdleEventHandlers() )
+                    {
+                        needsIdle = true;
+                        break;
+                    }
+                }
+
+                if ( needsIdle != IsSubscribedToIdleEvents() )
+                {
+                    SubscribeToIdleEvents(needsIdle);
+
+                    // If we just subscribed, we didn't get this event, so
+                    // ensure we get the next one soon.
+                    if ( needsIdle )
+                        needMore = true;
+                }
+            }
+            break;
     }
     wxWindowList::compatibility_iterator node = GetChildren().GetFirst();
     for (; node; node = node->GetNext())
@@ -2814,7 +2992,10 @@ bool wxWindowBase::SendIdleEvents(wxIdleEvent& event)
 
 void wxWindowBase::OnInternalIdle()
 {
-    if ( wxUpdateUIEvent::CanUpdate(this) )
+    // In wxUPDATE_UI_PROCESS_REGISTERED mode the windows are updated by
+    // UpdateRegisteredWindowsUI() only, and only when necessary.
+    if ( wxUpdateUIEvent::GetMode() != wxUPDATE_UI_PROCESS_REGISTERED &&
+            wxUpdateUIEvent::CanUpdate(this) )
         UpdateWindowUI(wxUPDATE_UI_FROMIDLE);
 }
 
@@ -50,10 +50,15 @@
 #include "wx/generic/private/markuptext.h"
 #include "wx/generic/private/rowheightcache.h"
 #include "wx/generic/private/widthcalc.h"
+#include "wx/private/textmeasure.h"
 #if wxUSE_ACCESSIBILITY
 #include "wx/private/markupparser.h"
 #endif // wxUSE_ACCESSIBILITY
 
+#ifndef wxNO_RTTI
+    #include <typeinfo>
+#endif
+
 //-----------------------------------------------------------------------------
 // classes
 //-----------------------------------------------------------------------------
@@ -6081,6 +6086,16 @@ public:
             !clientArea->IsList() &&
             (column == nullptr ||
              GetExpanderColumnOrFirstOne(const_cast<wxDataViewCtrl*>(dvc)) == column );
+
+        // The texts shown by the standard text renderer can be measured all
+        // at once, but we can't do it for the classes deriving from it as
+        // they could override GetSize().
+#ifndef wxNO_RTTI
+        if ( typeid(*renderer) == typeid(wxDataViewTextRenderer) )
+            m_textRenderer = static_cast<wxDataViewTextRenderer*>(renderer);
+        else
+#endif // !wxNO_RTTI
+            m_textRenderer = nullptr;
     }
 
     virtual void UpdateWithRow(int row) override
@@ -6102,19 +6117,79 @@ public:
         if ( m_model->HasValue(item, GetColumn()) )
         {
             if ( m_renderer->PrepareForItem(m_model, item, GetColumn()) )
+            {
+                if ( CanMeasureLater() )
+                {
+                    m_texts.push_back(m_textRenderer->m_text);
+                    m_widths.push_back(width);
+
+                    if ( m_texts.size() == MAX_PENDING_ROWS )
+                        FlushPendingRows();
+                    return;
+                }
+
                 width += m_renderer->GetSize().x;
+            }
         }
 
         UpdateWithWidth(width);
     }
 
+protected:
+    virtual void FlushPendingRows() override
+    {
+        if ( m_texts.empty() )
+            return;
+
+        // This does the same thing as wxDataViewTextRenderer::GetSize() does
+        // for a single item.
+        wxVector<wxSize> sizes(m_texts.size());
+        wxTextMeasure(m_dvc).GetTextExtents(m_texts, &sizes[0]);
+
+        for ( size_t n = 0; n < sizes.size(); n++ )
+            UpdateWithWidth(m_widths[n] + sizes[n].x);
+
+        m_texts.clear();
+        m_widths.clear();
+    }
+
 private:
+    // Return true if the text renderer is used and its size only depends on
+    // the text measured using the default font, so it can be done later.
+    bool CanMeasureLater() const
+    {
+        if ( !m_textRenderer )
+            return false;
+
+        if ( m_textRenderer->m_text.empty() ||
+                m_textRenderer->GetAttr().HasFont() )
+            return false;
+
+#if wxUSE_MARKUP
+        if ( m_textRenderer->m_markupText )
+            return false;
+#endif // wxUSE_MARKUP
+
+        return true;
+    }
+
+    // The maximal number of rows measured at once.
+    static const size_t MAX_PENDING_ROWS = 256;
+
     const wxDataViewCtrl *m_dvc;
     wxDataViewMainWindow *m_clientArea;
     wxDataViewRenderer *m_renderer;
     const wxDataViewModel *m_model;
     bool m_isExpanderCol;
     int m_expanderSize;
+
+    // Non-null if m_renderer is a wxDataViewTextRenderer.
+    wxDataViewTextRenderer *m_textRenderer;
+
+    // The texts of the rows not measured yet and the widths of the rest of
+    // these rows.
+    wxArrayString m_texts;
+    wxVector<int> m_widths;
 };
 
 
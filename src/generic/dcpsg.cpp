@@ -30,6 +30,12 @@
 #include "wx/filename.h"
 #include "wx/stdpaths.h"
 
+#if wxUSE_ZLIB && wxUSE_STREAMS
+    #include "wx/zstream.h"
+#endif
+
+#include <string>
+
 #ifdef __WXMSW__
 
 #ifdef DrawText
@@ -210,6 +216,248 @@ static const char *wxPostScriptHeaderStrSplit =
 "    }loop\n"        // [ str-items
 "  ]\n"              // [ str-items ]
 "} def\n";
+
+// Draw the image with the data following in the current file, encoded in
+// ASCII85 and compressed using the given (Level 2 or later) decode filter.
+static const char *wxPostScriptHeaderDecodeImage =
+"/wxdecodeimage {\n"                       // w h bpc matrix filter
+"  currentfile /ASCII85Decode filter\n"    // w h bpc matrix filter a85
+"  dup 3 1 roll exch filter\n"             // w h bpc matrix a85 data
+"  exch 6 1 roll\n"                        // a85 w h bpc matrix data
+"  false 3 colorimage\n"                   // a85
+"  flushfile\n"                            // skip the rest up to "~>"
+"} bind def\n";
+
+//-----------------------------------------------------------------------------
+// helpers
+//-----------------------------------------------------------------------------
+
+namespace
+{
+
+// Append the number followed by a space to the given string.
+//
+// This is much faster than wxString::Printf("%f") and always uses '.' as
+// decimal separator, independently of the current locale. The precision of
+// 4 decimal digits is more than enough for both coordinates, which are
+// expressed in points, and colour components.
+void wxPSAppendNumber(std::string& s, double value)
+{
+    if ( !(fabs(value) < 1e9) )
+    {
+        // This is not supposed to happen, so don't bother optimizing it.
+        s += wxString::FromCDouble(value, 4).utf8_string();
+        s += ' ';
+        return;
+    }
+
+    char buf[32];
+    char* const end = buf + WXSIZEOF(buf);
+    char* p = end;
+
+    *--p = ' ';
+
+    const bool negative = value < 0;
+    unsigned long long n = static_cast<unsigned long long>(fabs(value)*10000 + 0.5);
+
+    unsigned frac = static_cast<unsigned>(n % 10000);
+    n /= 10000;
+    if ( frac )
+    {
+        int digits = 4;
+        while ( frac % 10 == 0 )
+        {
+            frac /= 10;
+            digits--;
+        }
+
+        while ( digits-- )
+        {
+            *--p = static_cast<char>('0' + frac % 10);
+            frac /= 10;
+        }
+        *--p = '.';
+    }
+
+    do
+    {
+        *--p = static_cast<char>('0' + n % 10);
+        n /= 10;
+    } while ( n );
+
+    // Don't output "-0" if the number was rounded to zero.
+    if ( negative && (p[0] != '0' || p[1] != ' ') )
+        *--p = '-';
+
+    s.append(p, end - p);
+}
+
+inline void wxPSAppendPoint(std::string& s, double x, double y)
+{
+    wxPSAppendNumber(s, x);
+    wxPSAppendNumber(s, y);
+}
+
+// Encodes the data in ASCII85 as understood by ASCII85Decode PostScript
+// filter, which is only 25% bigger than the binary data, unlike ASCII hex.
+class wxPSASCII85Encoder
+{
+public:
+    explicit wxPSASCII85Encoder(wxPostScriptDCImpl& dc)
+        : m_dc(dc)
+    {
+        m_tuple = 0;
+        m_count = 0;
+        m_lineLen = 0;
+    }
+
+    void Write(const unsigned char* data, size_t len)
+    {
+        for ( ; len; --len )
+        {
+            m_tuple = (m_tuple << 8) | *data++;
+            if ( ++m_count == 4 )
+            {
+                EncodeTuple(4);
+                m_tuple = 0;
+                m_count = 0;
+            }
+        }
+    }
+
+    // Must be called after the last Write() to output the trailing data.
+    void Finish()
+    {
+        if ( m_count )
+        {
+            // Pad the partial tuple with zeroes and output just the count+1
+            // first characters of it.
+            m_tuple <<= 8*(4 - m_count);
+            EncodeTuple(m_count);
+        }
+
+        m_buffer += "~>\n";
+        m_dc.PsWrite(m_buffer.data(), m_buffer.length());
+        m_buffer.clear();
+    }
+
+private:
+    void EncodeTuple(unsigned count)
+    {
+        if ( count == 4 && !m_tuple )
+        {
+            PutChar('z');
+        }
+        else
+        {
+            char chars[5];
+            wxUint32 tuple = m_tuple;
+            for ( int i = 4; i >= 0; --i )
+            {
+                chars[i] = static_cast<char>('!' + tuple % 85);
+                tuple /= 85;
+            }
+
+            for ( unsigned i = 0; i <= count; ++i )
+                PutChar(chars[i]);
+        }
+
+        if ( m_buffer.length() >= 0x10000 )
+        {
+            m_dc.PsWrite(m_buffer.data(), m_buffer.length());
+            m_buffer.clear();
+        }
+    }
+
+    void PutChar(char ch)
+    {
+        if ( m_lineLen == 0 && ch == '%' )
+        {
+            // Don't let the line start with "%%" as it could be mistaken for
+            // a DSC comment, the decoder ignores white space anyhow.
+            m_buffer += ' ';
+        }
+
+        m_buffer += ch;
+
+        if ( ++m_lineLen == 75 )
+        {
+            m_buffer += '\n';
+            m_lineLen = 0;
+        }
+    }
+
+    wxPostScriptDCImpl& m_dc;
+    std::string m_buffer;
+    wxUint32 m_tuple;
+    unsigned m_count;
+    unsigned m_lineLen;
+};
+
+// Append the data compressed as understood by RunLengthDecode to out.
+void wxPSRunLengthEncode(const unsigned char* data, size_t len, std::string& out)
+{
+    size_t i = 0;
+    while ( i < len )
+    {
+        size_t run = 1;
+        while ( i + run < len && run < 128 && data[i + run] == data[i] )
+            run++;
+
+        if ( run > 1 )
+        {
+            out += static_cast<char>(257 - run);
+            out += static_cast<char>(data[i]);
+            i += run;
+            continue;
+        }
+
+        // Collect the literal bytes until the start of the next run.
+        const size_t start = i++;
+        while ( i < len && i - start < 128 )
+        {
+            if ( i + 2 < len && data[i] == data[i + 1] && data[i] == data[i + 2] )
+                break;
+
+            i++;
+        }
+
+        out += static_cast<char>(i - start - 1);
+        out.append(reinterpret_cast<const char*>(data + start), i - start);
+    }
+}
+
+#if wxUSE_ZLIB && wxUSE_STREAMS
+
+// Stream passing everything written to it to ASCII85 encoder.
+class wxPSASCII85OutputStream : public wxOutputStream
+{
+public:
+    explicit wxPSASCII85OutputStream(wxPSASCII85Encoder& encoder)
+        : m_encoder(encoder)
+    {
+    }
+
+protected:
+    size_t OnSysWrite(const void* buffer, size_t size) override
+    {
+        m_encoder.Write(static_cast<const unsigned char*>(buffer), size);
+        return size;
+    }
+
+private:
+    wxPSASCII85Encoder& m_encoder;
+
+    wxDECLARE_NO_COPY_CLASS(wxPSASCII85OutputStream);
+};
+
+#endif // wxUSE_ZLIB && wxUSE_STREAMS
+
+// Size of the internal buffer used by wxPostScriptDCImpl::PsWrite().
+const size_t wxPS_OUTPUT_BUFFER_SIZE = 0x10000;
+
+} // anonymous namespace
+
 //-------------------------------------------------------------------------------
 // wxPostScriptDC
 //-------------------------------------------------------------------------------
@@ -227,6 +475,16 @@ wxPostScriptDC::wxPostScriptDC(const wxPrintData& printData)
 {
 }
 
+void wxPostScriptDC::SetImageCompression(wxPostScriptImageCompression compression)
+{
+    static_cast<wxPostScriptDCImpl*>(GetImpl())->SetImageCompression(compression);
+}
+
+wxPostScriptImageCompression wxPostScriptDC::GetImageCompression() const
+{
+    return static_cast<const wxPostScriptDCImpl*>(GetImpl())->GetImageCompression();
+}
+
 // we don't want to use only 72 dpi from PS print
 static const int DPI = 600;
 static const double PS2DEV = 600.0 / 72.0;
@@ -303,10 +561,16 @@ void wxPostScriptDCImpl::Init()
     m_underlineThickness = 0.0;
 
     m_isFontChanged = false;
+
+    // Don't use compression by default to keep producing PostScript Level 1
+    // output compatible with all devices.
+    m_imageCompression = wxPS_IMAGE_COMPRESSION_NONE;
 }
 
 wxPostScriptDCImpl::~wxPostScriptDCImpl ()
 {
+    PsFlush();
+
     if (m_pstream)
     {
         fclose( m_pstream );
@@ -409,15 +673,13 @@ void wxPostScriptDCImpl::DoDrawLine (wxCoord x1, wxCoord y1, wxCoord x2, wxCoord
 
     SetPen( m_pen );
 
-    wxString buffer;
-    buffer.Printf( "newpath\n"
-                   "%f %f moveto\n"
-                   "%f %f lineto\n"
-                   "stroke\n",
-            XLOG2DEV(x1), YLOG2DEV(y1),
-            XLOG2DEV(x2), YLOG2DEV(y2) );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
+    std::string buffer( "newpath\n" );
+    wxPSAppendPoint( buffer, XLOG2DEV(x1), YLOG2DEV(y1) );
+    buffer += "moveto\n";
+    wxPSAppendPoint( buffer, XLOG2DEV(x2), YLOG2DEV(y2) );
+    buffer += "lineto\n"
+              "stroke\n";
+    PsWrite( buffer.data(), buffer.length() );
 
     CalcBoundingBox( x1, y1, x2, y2 );
 }
@@ -562,15 +824,13 @@ void wxPostScriptDCImpl::DoDrawPoint (wxCoord x, wxCoord y)
 
     SetPen (m_pen);
 
-    wxString buffer;
-    buffer.Printf( "newpath\n"
-                   "%f %f moveto\n"
-                   "%f %f lineto\n"
-                   "stroke\n",
-            XLOG2DEV(x),   YLOG2DEV(y),
-            XLOG2DEV(x+1), YLOG2DEV(y) );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
+    std::string buffer( "newpath\n" );
+    wxPSAppendPoint( buffer, XLOG2DEV(x), YLOG2DEV(y) );
+    buffer += "moveto\n";
+    wxPSAppendPoint( buffer, XLOG2DEV(x+1), YLOG2DEV(y) );
+    buffer += "lineto\n"
+              "stroke\n";
+    PsWrite( buffer.data(), buffer.length() );
 
     CalcBoundingBox( x, y );
 }
@@ -585,30 +845,25 @@ void wxPostScriptDCImpl::DoDrawPolygon (int n, const wxPoint points[], wxCoord x
     {
         SetBrush( m_brush );
 
-        PsPrint( "newpath\n" );
-
-        double xx = XLOG2DEV(points[0].x + xoffset);
-        double yy = YLOG2DEV(points[0].y + yoffset);
+        std::string buffer( "newpath\n" );
 
-        wxString buffer;
-        buffer.Printf( "%f %f moveto\n", xx, yy );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        wxPSAppendPoint( buffer, XLOG2DEV(points[0].x + xoffset),
+                                 YLOG2DEV(points[0].y + yoffset) );
+        buffer += "moveto\n";
 
         CalcBoundingBox( points[0].x + xoffset, points[0].y + yoffset );
 
         for (int i = 1; i < n; i++)
         {
-            xx = XLOG2DEV(points[i].x + xoffset);
-            yy = YLOG2DEV(points[i].y + yoffset);
-
-            buffer.Printf( "%f %f lineto\n", xx, yy );
-            buffer.Replace( ",", "." );
-            PsPrint( buffer );
+            wxPSAppendPoint( buffer, XLOG2DEV(points[i].x + xoffset),
+                                     YLOG2DEV(points[i].y + yoffset) );
+            buffer += "lineto\n";
 
             CalcBoundingBox( points[i].x + xoffset, points[i].y + yoffset);
         }
 
+        PsWrite( buffer.data(), buffer.length() );
+
         PsPrint( (fillStyle == wxODDEVEN_RULE ? "eofill\n" : "fill\n") );
     }
 
@@ -616,30 +871,25 @@ void wxPostScriptDCImpl::DoDrawPolygon (int n, const wxPoint points[], wxCoord x
     {
         SetPen( m_pen );
 
-        PsPrint( "newpath\n" );
-
-        double xx = XLOG2DEV(points[0].x + xoffset);
-        double yy = YLOG2DEV(points[0].y + yoffset);
+        std::string buffer( "newpath\n" );
 
-        wxString buffer;
-        buffer.Printf( "%f %f moveto\n", xx, yy );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        wxPSAppendPoint( buffer, XLOG2DEV(points[0].x + xoffset),
+                                 YLOG2DEV(points[0].y + yoffset) );
+        buffer += "moveto\n";
 
         CalcBoundingBox( points[0].x + xoffset, points[0].y + yoffset );
 
         for (int i = 1; i < n; i++)
         {
-            xx = XLOG2DEV(points[i].x + xoffset);
-            yy = YLOG2DEV(points[i].y + yoffset);
-
-            buffer.Printf( "%f %f lineto\n", xx, yy );
-            buffer.Replace( ",", "." );
-            PsPrint( buffer );
+            wxPSAppendPoint( buffer, XLOG2DEV(points[i].x + xoffset),
+                                     YLOG2DEV(points[i].y + yoffset) );
+            buffer += "lineto\n";
 
             CalcBoundingBox( points[i].x + xoffset, points[i].y + yoffset);
         }
 
+        PsWrite( buffer.data(), buffer.length() );
+
         PsPrint( "closepath\n" );
         PsPrint( "stroke\n" );
     }
@@ -655,33 +905,28 @@ void wxPostScriptDCImpl::DoDrawPolyPolygon (int n, const int count[], const wxPo
     {
         SetBrush( m_brush );
 
-        PsPrint( "newpath\n" );
+        std::string buffer( "newpath\n" );
 
         int ofs = 0;
         for (int i = 0; i < n; ofs += count[i++])
         {
-            double xx = XLOG2DEV(points[ofs].x + xoffset);
-            double yy = YLOG2DEV(points[ofs].y + yoffset);
-
-            wxString buffer;
-            buffer.Printf( "%f %f moveto\n", xx, yy );
-            buffer.Replace( ",", "." );
-            PsPrint( buffer );
+            wxPSAppendPoint( buffer, XLOG2DEV(points[ofs].x + xoffset),
+                                     YLOG2DEV(points[ofs].y + yoffset) );
+            buffer += "moveto\n";
 
             CalcBoundingBox( points[ofs].x + xoffset, points[ofs].y + yoffset );
 
             for (int j = 1; j < count[i]; j++)
             {
-                xx = XLOG2DEV(points[ofs+j].x + xoffset);
-                yy = YLOG2DEV(points[ofs+j].y + yoffset);
-
-                buffer.Printf( "%f %f lineto\n", xx, yy );
-                buffer.Replace( ",", "." );
-                PsPrint( buffer );
+                wxPSAppendPoint( buffer, XLOG2DEV(points[ofs+j].x + xoffset),
+                                         YLOG2DEV(points[ofs+j].y + yoffset) );
+                buffer += "lineto\n";
 
                 CalcBoundingBox( points[ofs+j].x + xoffset, points[ofs+j].y + yoffset);
             }
         }
+
+        PsWrite( buffer.data(), buffer.length() );
         PsPrint( (fillStyle == wxODDEVEN_RULE ? "eofill\n" : "fill\n") );
     }
 
@@ -689,33 +934,28 @@ void wxPostScriptDCImpl::DoDrawPolyPolygon (int n, const int count[], const wxPo
     {
         SetPen( m_pen );
 
-        PsPrint( "newpath\n" );
+        std::string buffer( "newpath\n" );
 
         int ofs = 0;
         for (int i = 0; i < n; ofs += count[i++])
         {
-            double xx = XLOG2DEV(points[ofs].x + xoffset);
-            double yy = YLOG2DEV(points[ofs].y + yoffset);
-
-            wxString buffer;
-            buffer.Printf( "%f %f moveto\n", xx, yy );
-            buffer.Replace( ",", "." );
-            PsPrint( buffer );
+            wxPSAppendPoint( buffer, XLOG2DEV(points[ofs].x + xoffset),
+                                     YLOG2DEV(points[ofs].y + yoffset) );
+            buffer += "moveto\n";
 
             CalcBoundingBox( points[ofs].x + xoffset, points[ofs].y + yoffset );
 
             for (int j = 1; j < count[i]; j++)
             {
-                xx = XLOG2DEV(points[ofs+j].x + xoffset);
-                yy = YLOG2DEV(points[ofs+j].y + yoffset);
-
-                buffer.Printf( "%f %f lineto\n", xx, yy );
-                buffer.Replace( ",", "." );
-                PsPrint( buffer );
+                wxPSAppendPoint( buffer, XLOG2DEV(points[ofs+j].x + xoffset),
+                                         YLOG2DEV(points[ofs+j].y + yoffset) );
+                buffer += "lineto\n";
 
                 CalcBoundingBox( points[ofs+j].x + xoffset, points[ofs+j].y + yoffset);
             }
         }
+
+        PsWrite( buffer.data(), buffer.length() );
         PsPrint( "closepath\n" );
         PsPrint( "stroke\n" );
     }
@@ -736,24 +976,20 @@ void wxPostScriptDCImpl::DoDrawLines (int n, const wxPoint points[], wxCoord xof
     for ( i =0; i<n ; i++ )
         CalcBoundingBox( points[i].x+xoffset, points[i].y+yoffset );
 
-    wxString buffer;
-    buffer.Printf( "newpath\n"
-                   "%f %f moveto\n",
-              XLOG2DEV(points[0].x+xoffset),
-              YLOG2DEV(points[0].y+yoffset) );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
+    std::string buffer( "newpath\n" );
+    wxPSAppendPoint( buffer, XLOG2DEV(points[0].x+xoffset),
+                             YLOG2DEV(points[0].y+yoffset) );
+    buffer += "moveto\n";
 
     for (i = 1; i < n; i++)
     {
-        buffer.Printf( "%f %f lineto\n",
-                  XLOG2DEV(points[i].x+xoffset),
-                  YLOG2DEV(points[i].y+yoffset) );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        wxPSAppendPoint( buffer, XLOG2DEV(points[i].x+xoffset),
+                                 YLOG2DEV(points[i].y+yoffset) );
+        buffer += "lineto\n";
     }
 
-    PsPrint( "stroke\n" );
+    buffer += "stroke\n";
+    PsWrite( buffer.data(), buffer.length() );
 }
 
 void wxPostScriptDCImpl::DoDrawRectangle (wxCoord x, wxCoord y, wxCoord width, wxCoord height)
@@ -767,20 +1003,18 @@ void wxPostScriptDCImpl::DoDrawRectangle (wxCoord x, wxCoord y, wxCoord width, w
     {
         SetBrush( m_brush );
 
-        wxString buffer;
-        buffer.Printf( "newpath\n"
-                       "%f %f moveto\n"
-                       "%f %f lineto\n"
-                       "%f %f lineto\n"
-                       "%f %f lineto\n"
-                       "closepath\n"
-                       "fill\n",
-                XLOG2DEV(x),         YLOG2DEV(y),
-                XLOG2DEV(x + width), YLOG2DEV(y),
-                XLOG2DEV(x + width), YLOG2DEV(y + height),
-                XLOG2DEV(x),         YLOG2DEV(y + height) );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        std::string buffer( "newpath\n" );
+        wxPSAppendPoint( buffer, XLOG2DEV(x),         YLOG2DEV(y) );
+        buffer += "moveto\n";
+        wxPSAppendPoint( buffer, XLOG2DEV(x + width), YLOG2DEV(y) );
+        buffer += "lineto\n";
+        wxPSAppendPoint( buffer, XLOG2DEV(x + width), YLOG2DEV(y + height) );
+        buffer += "lineto\n";
+        wxPSAppendPoint( buffer, XLOG2DEV(x),         YLOG2DEV(y + height) );
+        buffer += "lineto\n"
+                  "closepath\n"
+                  "fill\n";
+        PsWrite( buffer.data(), buffer.length() );
 
         CalcBoundingBox( wxPoint(x, y), wxSize(width, height) );
     }
@@ -789,20 +1023,18 @@ void wxPostScriptDCImpl::DoDrawRectangle (wxCoord x, wxCoord y, wxCoord width, w
     {
         SetPen (m_pen);
 
-        wxString buffer;
-        buffer.Printf( "newpath\n"
-                       "%f %f moveto\n"
-                       "%f %f lineto\n"
-                       "%f %f lineto\n"
-                       "%f %f lineto\n"
-                       "closepath\n"
-                       "stroke\n",
-                XLOG2DEV(x),         YLOG2DEV(y),
-                XLOG2DEV(x + width), YLOG2DEV(y),
-                XLOG2DEV(x + width), YLOG2DEV(y + height),
-                XLOG2DEV(x),         YLOG2DEV(y + height) );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        std::string buffer( "newpath\n" );
+        wxPSAppendPoint( buffer, XLOG2DEV(x),         YLOG2DEV(y) );
+        buffer += "moveto\n";
+        wxPSAppendPoint( buffer, XLOG2DEV(x + width), YLOG2DEV(y) );
+        buffer += "lineto\n";
+        wxPSAppendPoint( buffer, XLOG2DEV(x + width), YLOG2DEV(y + height) );
+        buffer += "lineto\n";
+        wxPSAppendPoint( buffer, XLOG2DEV(x),         YLOG2DEV(y + height) );
+        buffer += "lineto\n"
+                  "closepath\n"
+                  "stroke\n";
+        PsWrite( buffer.data(), buffer.length() );
 
         CalcBoundingBox( wxPoint(x, y), wxSize(width, height) );
     }
@@ -952,6 +1184,23 @@ void wxPostScriptDCImpl::DoDrawBitmap( const wxBitmap& bitmap, wxCoord x, wxCoor
     double xx = XLOG2DEV(x);
     double yy = YLOG2DEV(y + bitmap.GetHeight());
 
+    if ( m_imageCompression != wxPS_IMAGE_COMPRESSION_NONE )
+    {
+        std::string buffer( "/origstate save def\n"
+                            "20 dict begin\n" );
+        wxPSAppendPoint( buffer, xx, yy );
+        buffer += "translate\n";
+        wxPSAppendPoint( buffer, ww, hh );
+        buffer += "scale\n";
+        PsWrite( buffer.data(), buffer.length() );
+
+        DrawCompressedImage( image );
+
+        PsPrint( "end\n" );
+        PsPrint( "origstate restore\n" );
+        return;
+    }
+
     wxString buffer;
     buffer.Printf( "/origstate save def\n"
                    "20 dict begin\n"
@@ -990,18 +1239,72 @@ void wxPostScriptDCImpl::DoDrawBitmap( const wxBitmap& bitmap, wxCoord x, wxCoor
             data++;
         }
         *(bufferindex++) = '\n';
-        *bufferindex = 0;
 
-        if (m_pstream)
-            fwrite( charbuffer, 1, strlen( charbuffer ), m_pstream );
-        else
-            PsPrint( charbuffer );
+        PsWrite( charbuffer.data(), bufferindex - charbuffer.data() );
     }
 
     PsPrint( "end\n" );
     PsPrint( "origstate restore\n" );
 }
 
+void wxPostScriptDCImpl::DrawCompressedImage(const wxImage& image)
+{
+    const int w = image.GetWidth();
+    const int h = image.GetHeight();
+    const size_t rowSize = 3*static_cast<size_t>(w);
+    const unsigned char* data = image.GetData();
+
+#if wxUSE_ZLIB && wxUSE_STREAMS
+    const bool useFlate = m_imageCompression == wxPS_IMAGE_COMPRESSION_FLATE;
+#else
+    // Fall back to the compression available in Level 2.
+    const bool useFlate = false;
+#endif
+
+    const char* const filter = useFlate ? "/FlateDecode" : "/RunLengthDecode";
+
+    PsPrint( wxString::Format("%d %d 8 [%d 0 0 %d 0 %d] %s wxdecodeimage\n",
+                              w, h, w, -h, h, filter) );
+
+    wxPSASCII85Encoder encoder(*this);
+
+#if wxUSE_ZLIB && wxUSE_STREAMS
+    if ( useFlate )
+    {
+        wxPSASCII85OutputStream a85stream(encoder);
+        wxZlibOutputStream zstream(a85stream, wxZ_DEFAULT_COMPRESSION, wxZLIB_ZLIB);
+
+        // Feed the stream in reasonably big chunks to minimize the overhead.
+        const size_t totalSize = rowSize*h;
+        const size_t chunkSize = 0x40000;
+        for ( size_t ofs = 0; ofs < totalSize; ofs += chunkSize )
+            zstream.Write(data + ofs, wxMin(chunkSize, totalSize - ofs));
+
+        zstream.Close();
+    }
+    else
+#endif // wxUSE_ZLIB && wxUSE_STREAMS
+    {
+        std::string rle;
+        rle.reserve(rowSize + rowSize/128 + 2);
+        for ( int j = 0; j < h; j++ )
+        {
+            wxPSRunLengthEncode(data, rowSize, rle);
+            encoder.Write(reinterpret_cast<const unsigned char*>(rle.data()),
+                          rle.length());
+            rle.clear();
+
+            data += rowSize;
+        }
+
+        // End of data marker.
+        const unsigned char eod = 128;
+        encoder.Write(&eod, 1);
+    }
+
+    encoder.Finish();
+}
+
 // Set PostScript color
 void wxPostScriptDCImpl::SetPSColour(const wxColor& col)
 {
@@ -1027,10 +1330,12 @@ void wxPostScriptDCImpl::SetPSColour(const wxColor& col)
         double bluePS = (double)blue / 255.0;
         double greenPS = (double)green / 255.0;
 
-        wxString buffer;
-        buffer.Printf( "%f %f %f setrgbcolor\n", redPS, greenPS, bluePS );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        std::string buffer;
+        wxPSAppendNumber( buffer, redPS );
+        wxPSAppendNumber( buffer, greenPS );
+        wxPSAppendNumber( buffer, bluePS );
+        buffer += "setrgbcolor\n";
+        PsWrite( buffer.data(), buffer.length() );
 
         m_currentRed = red;
         m_currentBlue = blue;
@@ -1168,10 +1473,12 @@ void wxPostScriptDCImpl::SetPen( const wxPen& pen )
     else
         width = (double) m_pen.GetWidth();
 
+    std::string widthBuffer;
+    wxPSAppendNumber( widthBuffer, width * DEV2PS * m_scaleX );
+    widthBuffer += "setlinewidth\n";
+    PsWrite( widthBuffer.data(), widthBuffer.length() );
+
     wxString buffer;
-    buffer.Printf( "%f setlinewidth\n", width * DEV2PS * m_scaleX );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
 
 /*
      Line style - WRONG: 2nd arg is OFFSET
@@ -1280,31 +1587,34 @@ void wxPostScriptDCImpl::DrawAnyText(const wxWX2MBbuf& textbuf, wxCoord textDesc
         SetPSColour(m_textForegroundColour);
     }
 
-    PsPrint( "(" );
+    std::string str( "(" );
     for ( const char *p = textbuf; *p != '\0'; p++ )
     {
         int c = (unsigned char)*p;
         if (c == ')' || c == '(' || c == '\\')
         {
             /* Cope with special characters */
-            PsPrint( "\\" );
-            PsPrint( (char) c );
+            str += '\\';
+            str += (char) c;
         }
         else if ( c >= 128 )
         {
             /* Cope with character codes > 127 */
-            buffer.Printf( "\\%o", c );
-            PsPrint( buffer );
+            str += '\\';
+            str += (char) ('0' + (c >> 6));
+            str += (char) ('0' + ((c >> 3) & 7));
+            str += (char) ('0' + (c & 7));
         }
         else
         {
-            PsPrint( (char) c );
+            str += (char) c;
         }
     }
-    PsPrint( ")" );
+    str += ")";
 
     // Split multiline text and store individual lines in the array.
-    PsPrint( " (\\n) strsplit\n" );
+    str += " (\\n) strsplit\n";
+    PsWrite( str.data(), str.length() );
 
     // Print each line individually by fetching lines from the array
     PsPrint(           "{\n" );
@@ -1357,10 +1667,10 @@ void wxPostScriptDCImpl::DoDrawText( const wxString& text, wxCoord x, wxCoord y
 //        - note that there is still rounding error in text_descent!
     wxCoord by = y + size - text_descent; // baseline
 
-    wxString buffer;
-    buffer.Printf( "%f %f moveto\n", XLOG2DEV(x), YLOG2DEV(by) );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
+    std::string buffer;
+    wxPSAppendPoint( buffer, XLOG2DEV(x), YLOG2DEV(by) );
+    buffer += "moveto\n";
+    PsWrite( buffer.data(), buffer.length() );
 
     DrawAnyText(textbuf, text_descent, size);
 
@@ -1638,6 +1948,24 @@ bool wxPostScriptDCImpl::StartDoc( const wxString& WXUNUSED(message) )
 
     PsPrint( "%%Creator: wxWidgets PostScript renderer\n" );
 
+    switch ( m_imageCompression )
+    {
+        case wxPS_IMAGE_COMPRESSION_NONE:
+            break;
+
+        case wxPS_IMAGE_COMPRESSION_RLE:
+            PsPrint( "%%LanguageLevel: 2\n" );
+            break;
+
+        case wxPS_IMAGE_COMPRESSION_FLATE:
+#if wxUSE_ZLIB && wxUSE_STREAMS
+            PsPrint( "%%LanguageLevel: 3\n" );
+#else
+            PsPrint( "%%LanguageLevel: 2\n" );
+#endif
+            break;
+    }
+
     buffer.Printf( "%%%%CreationDate: %s\n", wxNow() );
     PsPrint( buffer );
 
@@ -1679,6 +2007,7 @@ bool wxPostScriptDCImpl::StartDoc( const wxString& WXUNUSED(message) )
     PsPrint( wxPostScriptHeaderReencodeISO1 );
     PsPrint( wxPostScriptHeaderReencodeISO2 );
     PsPrint( wxPostScriptHeaderStrSplit );
+    PsPrint( wxPostScriptHeaderDecodeImage );
     PsPrint( "%%EndProlog\n" );
 
     SetBrush( *wxBLACK_BRUSH );
@@ -1706,6 +2035,8 @@ void wxPostScriptDCImpl::EndDoc ()
         PsPrint( "grestore\n" );
     }
 
+    PsFlush();
+
     if ( m_pstream ) {
         fclose( m_pstream );
         m_pstream = nullptr;
@@ -1845,6 +2176,10 @@ void wxPostScriptDCImpl::EndPage ()
     wxCHECK_RET( m_ok , wxT("invalid postscript dc") );
 
     PsPrint( "showpage\n" );
+
+    // Don't keep the completed page in memory, this allows the consumer of
+    // our output to start processing it before the end of the document.
+    PsFlush();
 }
 
 bool wxPostScriptDCImpl::DoBlit( wxCoord xdest, wxCoord ydest,
@@ -1881,8 +2216,50 @@ wxCoord wxPostScriptDCImpl::GetCharHeight() const
 
 void wxPostScriptDCImpl::PsPrint( const wxString& str )
 {
-    const wxCharBuffer psdata(str.utf8_str());
+    const wxScopedCharBuffer psdata(str.utf8_str());
+
+    PsWrite( psdata.data(), psdata.length() );
+}
+
+void wxPostScriptDCImpl::PsWrite( const char* data, size_t len )
+{
+    if ( m_printData.GetPrintMode() != wxPRINT_MODE_STREAM )
+    {
+        // Don't buffer anything if we can't write it later anyhow.
+        wxCHECK_RET( m_pstream, wxT("invalid postscript dc") );
+    }
+
+    if ( m_outputBuffer.GetDataLen() + len > wxPS_OUTPUT_BUFFER_SIZE )
+    {
+        PsFlush();
+
+        if ( len >= wxPS_OUTPUT_BUFFER_SIZE )
+        {
+            // There is no point in copying big chunks into the buffer, just
+            // write them directly.
+            PsDoWrite( data, len );
+            return;
+        }
+    }
+
+    m_outputBuffer.AppendData( data, len );
+}
+
+void wxPostScriptDCImpl::PsFlush()
+{
+    const size_t len = m_outputBuffer.GetDataLen();
+    if ( !len )
+        return;
+
+    // Reset the buffer in any case: even if we fail to write it below, there
+    // is no point in keeping the data we can't output.
+    m_outputBuffer.SetDataLen(0);
 
+    PsDoWrite( static_cast<const char*>(m_outputBuffer.GetData()), len );
+}
+
+void wxPostScriptDCImpl::PsDoWrite( const char* psdata, size_t len )
+{
     switch (m_printData.GetPrintMode())
     {
 #if wxUSE_STREAMS
@@ -1897,7 +2274,7 @@ void wxPostScriptDCImpl::PsPrint( const wxString& str )
                 wxCHECK_RET( data, wxS("Cannot obtain output stream") );
                 wxOutputStream* outputstream = data->GetOutputStream();
                 wxCHECK_RET( outputstream, wxT("invalid outputstream") );
-                outputstream->Write( psdata, strlen( psdata ) );
+                outputstream->Write( psdata, len );
             }
             break;
 #endif // wxUSE_STREAMS
@@ -1905,7 +2282,7 @@ void wxPostScriptDCImpl::PsPrint( const wxString& str )
         // save data into file
         default:
             wxCHECK_RET( m_pstream, wxT("invalid postscript dc") );
-            fwrite( psdata, 1, strlen( psdata ), m_pstream );
+            fwrite( psdata, 1, len, m_pstream );
     }
 }
 
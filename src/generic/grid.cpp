@@ -52,12 +52,17 @@
 #include "wx/generic/gridctrl.h"
 #include "wx/generic/grideditors.h"
 #include "wx/generic/private/grid.h"
+#include "wx/private/textmeasure.h"
 
 const char wxGridNameStr[] = "grid";
 
 // Required for wxIs... functions
 #include <ctype.h>
 
+#ifndef wxNO_RTTI
+    #include <typeinfo>
+#endif
+
 // ----------------------------------------------------------------------------
 // globals
 // ----------------------------------------------------------------------------
@@ -10137,6 +10142,14 @@ wxGrid::AutoSizeColOrRow(int colOrRow, bool setAsMin, wxGridDirection direction)
     wxGridCellAttrPtr attr;
     wxGridCellRendererPtr renderer;
 
+    // When using the standard string renderer for the entire column, we can
+    // measure all its values at once instead of doing it for each cell, which
+    // is much faster for big grids. These arrays contain the values and the
+    // number of columns spanned by the corresponding cells.
+    bool measureAllStrings = false;
+    wxArrayString strings;
+    wxVector<int> spans;
+
     wxCoord extent, extentMax = 0;
     int max = column ? m_numRows : m_numCols;
     for ( int rowOrCol = 0; rowOrCol < max; rowOrCol++ )
@@ -10193,10 +10206,22 @@ wxGrid::AutoSizeColOrRow(int colOrRow, bool setAsMin, wxGridDirection direction)
                     // No need to check all the values.
                     break;
                 }
+
+#ifndef wxNO_RTTI
+                // Note that we can't do this for the classes deriving from
+                // the string renderer as they may override GetBestWidth().
+                measureAllStrings =
+                    typeid(*renderer) == typeid(wxGridCellStringRenderer);
+#endif // !wxNO_RTTI
             }
         }
 
-        if ( renderer )
+        if ( measureAllStrings )
+        {
+            strings.push_back(GetCellValue(row, col));
+            spans.push_back(span != CellSpan_None ? numCols : 1);
+        }
+        else if ( renderer )
         {
             extent = column
                         ? renderer->GetBestWidth(*this, *attr, dc, row, col,
@@ -10221,6 +10246,22 @@ wxGrid::AutoSizeColOrRow(int colOrRow, bool setAsMin, wxGridDirection direction)
         }
     }
 
+    if ( !strings.empty() )
+    {
+        // This corresponds to what wxGridCellStringRenderer::GetBestSize()
+        // does for each cell.
+        const wxFont& font = attr->GetFont();
+        wxVector<wxSize> sizes(strings.size());
+        wxTextMeasure(m_gridWin, &font).GetTextExtents(strings, &sizes[0]);
+
+        for ( size_t n = 0; n < sizes.size(); n++ )
+        {
+            extent = sizes[n].x / spans[n];
+            if ( extent > extentMax )
+                extentMax = extent;
+        }
+    }
+
     // now also compare with the column label extent
     wxCoord extentLabel;
     dc.SetFont( GetLabelFont() );
@@ -39,6 +39,7 @@
 #include "wx/generic/private/drawbitmap.h"
 #include "wx/generic/private/listctrl.h"
 #include "wx/generic/private/widthcalc.h"
+#include "wx/private/textmeasure.h"
 
 #ifdef __WXMAC__
     #include "wx/osx/private.h"
@@ -3398,11 +3399,49 @@ public:
         wxListItem item;
         line->m_items.at(GetColumn()).GetItem(item);
 
-        UpdateWithWidth(m_listmain->GetItemWidthWithImage(&item));
+        // Don't measure the item text immediately but do it for many items at
+        // once in FlushPendingRows(), as this is much faster.
+        const int width = m_listmain->GetItemImageWidth(item);
+
+        if (item.GetText().empty())
+        {
+            UpdateWithWidth(width);
+            return;
+        }
+
+        m_texts.push_back(item.GetText());
+        m_widths.push_back(width);
+
+        if ( m_texts.size() == MAX_PENDING_ROWS )
+            FlushPendingRows();
+    }
+
+protected:
+    virtual void FlushPendingRows() override
+    {
+        if ( m_texts.empty() )
+            return;
+
+        const wxFont font = m_listmain->GetFont();
+        wxVector<wxSize> sizes(m_texts.size());
+        wxTextMeasure(m_listmain, &font).GetTextExtents(m_texts, &sizes[0]);
+
+        for ( size_t n = 0; n < sizes.size(); n++ )
+            UpdateWithWidth(m_widths[n] + sizes[n].x);
+
+        m_texts.clear();
+        m_widths.clear();
     }
 
 private:
+    // The maximal number of rows measured at once.
+    static const size_t MAX_PENDING_ROWS = 256;
+
     wxListMainWindow* const m_listmain;
+
+    // The texts of the rows not measured yet and the widths of their images.
+    wxArrayString m_texts;
+    wxVector<int> m_widths;
 };
 
 
@@ -4648,22 +4687,25 @@ long wxListMainWindow::InsertColumn( long col, const wxListItem &item )
     return idx;
 }
 
-int wxListMainWindow::GetItemWidthWithImage(wxListItem * item)
+int wxListMainWindow::GetItemImageWidth(const wxListItem& item) const
 {
-    int width = 0;
-    wxClientDC dc(this);
+    if (item.GetImage() == -1)
+        return 0;
 
-    dc.SetFont( GetFont() );
+    int ix, iy;
+    GetImageSize( item.GetImage(), ix, iy );
+    return ix + IMAGE_MARGIN_IN_REPORT_MODE;
+}
 
-    if (item->GetImage() != -1)
-    {
-        int ix, iy;
-        GetImageSize( item->GetImage(), ix, iy );
-        width += ix + IMAGE_MARGIN_IN_REPORT_MODE;
-    }
+int wxListMainWindow::GetItemWidthWithImage(wxListItem * item)
+{
+    int width = GetItemImageWidth(*item);
 
     if (!item->GetText().empty())
     {
+        wxClientDC dc(this);
+        dc.SetFont( GetFont() );
+
         wxCoord w;
         dc.GetTextExtent( item->GetText(), &w, nullptr );
         width += w;
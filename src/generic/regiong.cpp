@@ -18,6 +18,8 @@
     #include "wx/utils.h"
 #endif
 
+#include <algorithm>
+
 // ========================================================================
 // Classes to interface with X.org code
 // ========================================================================
@@ -82,6 +84,9 @@ public:
         Region region,
         int rx, int ry,
         unsigned int rwidth, unsigned int rheight);
+    static bool XAppendRect(
+        Region pRegion,
+        const wxRect& rect);
 
 protected:
     static Region XCreateRegion(void);
@@ -330,6 +335,22 @@ bool wxRegionGeneric::DoUnionWithRect(const wxRect& rect)
     }
 
     AllocExclusive();
+
+    // Regions are often built by adding rectangles from top to bottom and
+    // from left to right, e.g. when converting a bitmap mask to a region, so
+    // check for this case first as it doesn't require merging the bands.
+    if ( REGION::XAppendRect(M_REGIONDATA, rect) )
+    {
+        // The region can only be empty after appending a rectangle to it if
+        // we ran out of memory.
+        return !REGION::XEmptyRegion(M_REGIONDATA);
+    }
+
+    // Also avoid rebuilding the region if it already contains the rectangle.
+    if ( REGION::XRectInRegion(M_REGIONDATA, rect.x, rect.y,
+                               rect.width, rect.height) == wxInRegion )
+        return true;
+
     REGION region(rect);
     return REGION::XUnionRegion(&region,M_REGIONDATA,M_REGIONDATA);
 }
@@ -1831,20 +1852,84 @@ bool REGION::XEqualRegion(Region r1, Region r2)
     return true;
 }
 
-bool REGION::XPointInRegion(Region pRegion, int x, int y)
+/*
+ * The rectangles of the region are sorted in y-x order and the bands don't
+ * overlap, so both the bottom edges of all rectangles and the right edges of
+ * the rectangles inside the same band are non-decreasing. This allows to find
+ * the rectangle containing the given point, if any, using binary search
+ * instead of checking all of them, which makes the functions below O(log n)
+ * in the number of rectangles (times the number of bands for rectangles).
+ */
+
+namespace
 {
-    int i;
 
+// Return the first box which ends below the given y coordinate.
+inline BoxPtr FindBand(BoxPtr first, BoxPtr last, wxCoord y)
+{
+    return std::partition_point(first, last,
+                                [y](const Box& box) { return box.y2 <= y; });
+}
+
+// Return the end of the band starting at the given box.
+inline BoxPtr FindBandEnd(BoxPtr band, BoxPtr last)
+{
+    const wxCoord y1 = band->y1;
+    return std::partition_point(band, last,
+                                [y1](const Box& box) { return box.y1 == y1; });
+}
+
+// Return the first box in the band which ends to the right of x.
+inline BoxPtr FindInBand(BoxPtr band, BoxPtr bandEnd, wxCoord x)
+{
+    return std::partition_point(band, bandEnd,
+                                [x](const Box& box) { return box.x2 <= x; });
+}
+
+// Ensure there is space for appending one more box to the region, as
+// MEMCHECK does, but reset the region to be empty, instead of leaving it with
+// the count of boxes not matching its null buffer, if reallocating fails.
+bool ReserveBox(Region pReg)
+{
+    if (pReg->numRects < pReg->size - 1)
+        return true;
+
+    BOX* const rects = (BOX *) realloc(pReg->rects,
+                                       2 * sizeof(BOX) * pReg->size);
+    if (!rects)
+    {
+        // The old buffer is still valid, so keep using it.
+        EMPTY_REGION(pReg);
+        pReg->extents.x1 = pReg->extents.y1 = 0;
+        pReg->extents.x2 = pReg->extents.y2 = 0;
+        return false;
+    }
+
+    pReg->rects = rects;
+    pReg->size *= 2;
+
+    return true;
+}
+
+} // anonymous namespace
+
+bool REGION::XPointInRegion(Region pRegion, int x, int y)
+{
     if (pRegion->numRects == 0)
         return false;
     if (!INBOX(pRegion->extents, x, y))
         return false;
-    for (i=0; i<pRegion->numRects; i++)
-    {
-        if (INBOX (pRegion->rects[i], x, y))
-            return true;
-    }
-    return false;
+
+    const BoxPtr pboxEnd = pRegion->rects + pRegion->numRects;
+
+    const BoxPtr band = FindBand(pRegion->rects, pboxEnd, y);
+    if (band == pboxEnd || band->y1 > y)
+        return false;
+
+    const BoxPtr bandEnd = FindBandEnd(band, pboxEnd);
+    const BoxPtr pbox = FindInBand(band, bandEnd, x);
+
+    return pbox != bandEnd && INBOX(*pbox, x, y);
 }
 
 wxRegionContain REGION::XRectInRegion(Region region,
@@ -1852,11 +1937,8 @@ wxRegionContain REGION::XRectInRegion(Region region,
                                       unsigned int rwidth,
                                       unsigned int rheight)
 {
-    BoxPtr pbox;
-    BoxPtr pboxEnd;
     Box rect;
     BoxPtr prect = &rect;
-    int      partIn, partOut;
 
     prect->x1 = rx;
     prect->y1 = ry;
@@ -1867,63 +1949,129 @@ wxRegionContain REGION::XRectInRegion(Region region,
     if ((region->numRects == 0) || !EXTENTCHECK(&region->extents, prect))
         return(wxOutRegion);
 
-    partOut = false;
-    partIn = false;
+    bool partOut = false;
+    bool partIn = false;
+
+    const BoxPtr pboxEnd = region->rects + region->numRects;
 
     /* can stop when both partOut and partIn are true, or we reach prect->y2 */
-    for (pbox = region->rects, pboxEnd = pbox + region->numRects;
-         pbox < pboxEnd;
-         pbox++)
+    for (BoxPtr band = FindBand(region->rects, pboxEnd, ry);
+         band < pboxEnd;
+        )
     {
+        if (band->y1 >= prect->y2)
+            break;                /* the rest of the region is below */
 
-        if (pbox->y2 <= ry)
-           continue;        /* getting up to speed or skipping remainder of band */
-
-        if (pbox->y1 > ry)
-        {
-           partOut = true;        /* missed part of rectangle above */
-           if (partIn || (pbox->y1 >= prect->y2))
-              break;
-           ry = pbox->y1;        /* x guaranteed to be == prect->x1 */
-        }
+        if (band->y1 > ry)
+            partOut = true;       /* missed part of rectangle above */
 
-        if (pbox->x2 <= rx)
-           continue;                /* not far enough over yet */
+        const BoxPtr bandEnd = FindBandEnd(band, pboxEnd);
 
-        if (pbox->x1 > rx)
+        /*
+         * Because boxes in a band are maximal width, the rectangle is
+         * completely covered in this band only if the first box overlapping
+         * it covers it entirely.
+         */
+        const BoxPtr pbox = FindInBand(band, bandEnd, prect->x1);
+        if (pbox != bandEnd && pbox->x1 < prect->x2)
         {
-           partOut = true;        /* missed part of rectangle to left */
-           if (partIn)
-              break;
+            partIn = true;
+            if (pbox->x1 > prect->x1 || pbox->x2 < prect->x2)
+                partOut = true;
         }
-
-        if (pbox->x1 < prect->x2)
+        else
         {
-            partIn = true;        /* definitely overlap */
-            if (partOut)
-               break;
+            partOut = true;
         }
 
-        if (pbox->x2 >= prect->x2)
-        {
-           ry = pbox->y2;        /* finished with this band */
-           if (ry >= prect->y2)
-              break;
-           rx = prect->x1;        /* reset x out to left again */
-        } else
-        {
-            /*
-             * Because boxes in a band are maximal width, if the first box
-             * to overlap the rectangle doesn't completely cover it in that
-             * band, the rectangle must be partially out, since some of it
-             * will be uncovered in that band. partIn will have been set true
-             * by now...
-             */
+        if (partIn && partOut)
+            return wxPartRegion;
+
+        ry = band->y2;
+        if (ry >= prect->y2)
             break;
-        }
 
+        band = bandEnd;
     }
 
     return(partIn ? ((ry < prect->y2) ? wxPartRegion : wxInRegion) :
                 wxOutRegion);
 }
+
+/*
+ * Add the box to the region if it lies entirely below it or to the right of
+ * the last box of its last band and has the same height, as happens when the
+ * region is built from top to bottom and from left to right. Returns false if
+ * the box can't be simply appended to the region and XUnionRegion() must be
+ * used instead. If memory allocation fails, the region is left empty and true
+ * is returned, as there is nothing more to do then.
+ */
+bool REGION::XAppendRect(Region pReg, const wxRect& rect)
+{
+    Box box;
+    box.x1 = rect.x;
+    box.y1 = rect.y;
+    box.x2 = rect.x + rect.width;
+    box.y2 = rect.y + rect.height;
+
+    if (pReg->numRects == 0)
+        return false;
+
+    BoxPtr last = &pReg->rects[pReg->numRects - 1];
+
+    if (box.y1 == last->y1 && box.y2 == last->y2 && box.x1 >= last->x2)
+    {
+        /*
+         * Adding a box to the last band could make it identical to the band
+         * just above it, which would then have to be coalesced with it, so
+         * only do it if there is no such band.
+         */
+        const wxCoord y1 = last->y1;
+        const BoxPtr band = std::partition_point(pReg->rects, last,
+                                [y1](const Box& b) { return b.y1 < y1; });
+        if (band != pReg->rects && band[-1].y2 == y1)
+            return false;
+
+        if (box.x1 == last->x2)
+        {
+            last->x2 = box.x2;
+        }
+        else
+        {
+            if (!ReserveBox(pReg))
+                return true;
+
+            pReg->rects[pReg->numRects++] = box;
+        }
+
+        pReg->extents.x2 = wxMax(pReg->extents.x2, box.x2);
+
+        return true;
+    }
+
+    if (box.y1 < pReg->extents.y2)
+        return false;
+
+    /*
+     * Extend the last band instead of adding a new one if it consists of
+     * a single box of the same width, as miCoalesce() would do.
+     */
+    if (last->y2 == box.y1 && last->x1 == box.x1 && last->x2 == box.x2 &&
+            (pReg->numRects == 1 || last[-1].y1 != last->y1))
+    {
+        last->y2 = box.y2;
+    }
+    else
+    {
+        if (!ReserveBox(pReg))
+            return true;
+
+        pReg->rects[pReg->numRects++] = box;
+    }
+
+    pReg->extents.x1 = wxMin(pReg->extents.x1, box.x1);
+    pReg->extents.x2 = wxMax(pReg->extents.x2, box.x2);
+    pReg->extents.y2 = box.y2;
+
+    return true;
+}
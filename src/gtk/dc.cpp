@@ -12,6 +12,7 @@
 #ifdef __WXGTK3__
 
 #include "wx/window.h"
+#include "wx/bmpcache.h"
 #include "wx/dcclient.h"
 #include "wx/dcmemory.h"
 #include "wx/dcscreen.h"
@@ -66,7 +67,11 @@ void wxGTKCairoDCImpl::DoDrawBitmap(const wxBitmap& bitmap, int x, int y, bool u
             cairo_scale(cr, -1, 1);
             x = -x - bitmap.GetWidth();
         }
-        bitmap.Draw(cr, x, y, useMask, &m_textForegroundColour, &m_textBackgroundColour);
+        // Avoid rescaling the bitmap every time it's drawn if it doesn't use
+        // the same scale factor as the DC and the cache is enabled.
+        const wxBitmap
+            bmp = wxScaledBitmapCache::GetScaled(bitmap, m_contentScaleFactor);
+        bmp.Draw(cr, x, y, useMask, &m_textForegroundColour, &m_textBackgroundColour);
         cairo_restore(cr);
     }
 }
@@ -487,6 +492,19 @@ wxClientDCImpl::wxClientDCImpl(wxClientDC* owner, wxWindow* window)
         SetGraphicsContext(wxGraphicsContext::Create());
 }
 
+wxClientDCImpl::~wxClientDCImpl()
+{
+    // Anything drawn directly on the window is not in its scroll backing
+    // store, if it uses one, so the drawn area must be repainted there.
+    if (m_window && m_isBBoxValid)
+    {
+        const int penWidth = m_pen.IsOk() ? m_pen.GetWidth() : 0;
+        wxRect rect(wxPoint(m_minX, m_minY), wxPoint(m_maxX, m_maxY));
+        rect.Inflate(penWidth + 1);
+        m_window->GTKInvalidateScrollBacking(&rect);
+    }
+}
+
 /* static */
 bool wxClientDCImpl::CanBeUsedForDrawing(const wxWindow* WXUNUSED(window))
 {
@@ -255,8 +255,70 @@ public:
 #endif // wxUSE_DISPLAY
 
     GdkScreen* const m_screen;
+
+private:
+    // Querying the monitor geometry may be relatively expensive, so we cache
+    // it. This is fine because the display objects are recreated, via
+    // wxDisplay::InvalidateCache(), when the screen configuration changes, see
+    // wxDisplayScreenSignals. Note that the work area is not cached because it
+    // also changes when the panels or docks are moved or resized, without any
+    // screen signal being emitted.
+    mutable wxRect m_geometry;
 };
 
+// Helper ensuring that wxDisplay::InvalidateCache() is called when the screen
+// size or the monitors configuration changes.
+class wxDisplayScreenSignals
+{
+public:
+    wxDisplayScreenSignals() : m_screen(nullptr) { }
+    ~wxDisplayScreenSignals();
+
+    // Connect to the signals of the given screen if not done yet.
+    void Connect(GdkScreen* screen);
+
+private:
+    GdkScreen* m_screen;
+
+    wxDECLARE_NO_COPY_CLASS(wxDisplayScreenSignals);
+};
+
+extern "C" {
+static void wx_display_screen_changed(GdkScreen*, void*)
+{
+    wxDisplay::InvalidateCache();
+}
+}
+
+void wxDisplayScreenSignals::Connect(GdkScreen* screen)
+{
+    if (m_screen)
+        return;
+
+    m_screen = screen;
+    g_object_ref(m_screen);
+
+    g_signal_connect(m_screen, "size-changed",
+        G_CALLBACK(wx_display_screen_changed), nullptr);
+#if GTK_CHECK_VERSION(2,14,0)
+    if (wx_is_at_least_gtk2(14))
+    {
+        g_signal_connect(m_screen, "monitors-changed",
+            G_CALLBACK(wx_display_screen_changed), nullptr);
+    }
+#endif
+}
+
+wxDisplayScreenSignals::~wxDisplayScreenSignals()
+{
+    if (m_screen)
+    {
+        g_signal_handlers_disconnect_by_func(m_screen,
+            (void*)wx_display_screen_changed, nullptr);
+        g_object_unref(m_screen);
+    }
+}
+
 #if wxUSE_DISPLAY
 class wxDisplayFactoryGTK: public wxDisplayFactory
 {
@@ -265,13 +327,18 @@ public:
     virtual unsigned GetCount() override;
     virtual int GetFromPoint(const wxPoint& pt) override;
     virtual int GetFromWindow(const wxWindow* win) override;
+
+private:
+    wxDisplayScreenSignals m_signals;
 };
 
 wxGCC_WARNING_SUPPRESS(deprecated-declarations)
 
 wxDisplayImpl* wxDisplayFactoryGTK::CreateDisplay(unsigned n)
 {
-    return new wxDisplayImplGTK(n);
+    wxDisplayImplGTK* const display = new wxDisplayImplGTK(n);
+    m_signals.Connect(display->m_screen);
+    return display;
 }
 
 unsigned wxDisplayFactoryGTK::GetCount()
@@ -313,9 +380,13 @@ wxDisplayImplGTK::wxDisplayImplGTK(unsigned i)
 
 wxRect wxDisplayImplGTK::GetGeometry() const
 {
-    GdkRectangle rect;
-    gdk_screen_get_monitor_geometry(m_screen, m_index, &rect);
-    return wxRect(rect.x, rect.y, rect.width, rect.height);
+    if (m_geometry.IsEmpty())
+    {
+        GdkRectangle rect;
+        gdk_screen_get_monitor_geometry(m_screen, m_index, &rect);
+        m_geometry = wxRect(rect.x, rect.y, rect.width, rect.height);
+    }
+    return m_geometry;
 }
 
 wxRect wxDisplayImplGTK::GetClientArea() const
@@ -427,8 +498,17 @@ class wxDisplayFactorySingleGTK : public wxDisplayFactorySingle
 protected:
     virtual wxDisplayImpl *CreateSingleDisplay()
     {
-        return new wxDisplayImplGTK(0);
+        wxDisplayImplGTK* const display = new wxDisplayImplGTK(0);
+#ifndef __WXGTK4__
+        m_signals.Connect(display->m_screen);
+#endif
+        return display;
     }
+
+#ifndef __WXGTK4__
+private:
+    wxDisplayScreenSignals m_signals;
+#endif
 };
 
 wxDisplayFactory* wxDisplay::CreateFactory()
@@ -28,10 +28,14 @@
 #endif
 
 #include "wx/fontutil.h"
+#include "wx/module.h"
+#include "wx/thread.h"
 #include "wx/tokenzr.h"
 
 #include "wx/gtk/private.h"
 
+#include <unordered_set>
+
 // ----------------------------------------------------------------------------
 // wxFontRefData
 // ----------------------------------------------------------------------------
@@ -47,6 +51,8 @@ public:
     // copy ctor
     wxFontRefData( const wxFontRefData& data );
 
+    virtual ~wxFontRefData();
+
     // setters: all of them also take care to modify m_nativeFontInfo if we
     // have it so as to not lose the information not carried by our fields
     void SetFractionalPointSize(double pointSize);
@@ -62,6 +68,14 @@ public:
     // and this one also modifies all the other font data fields
     void SetNativeFontInfo(const wxNativeFontInfo& info);
 
+    // return the hash of the font attributes and compare them, used for
+    // interning the font data, see wxFontDataTable
+    size_t GetHash() const;
+    bool IsSameAs(const wxFontRefData& other) const;
+
+    // true if this object is in the fonts table
+    bool m_interned = false;
+
 protected:
     // set all fields from (already initialized and valid) m_nativeFontInfo
     void InitFromNative();
@@ -76,6 +90,146 @@ private:
 
 #define M_FONTDATA ((wxFontRefData*)m_refData)
 
+// ----------------------------------------------------------------------------
+// wxFontDataTable: table of all the fonts data
+// ----------------------------------------------------------------------------
+
+// Programs often create many fonts with the same attributes, e.g. when using
+// temporary fonts returned by wxFont::Bold() or Scaled(), so we make all
+// fonts with identical attributes share the same data, and so the same
+// PangoFontDescription, instead of allocating a new one for each of them.
+//
+// The table doesn't own the font data, which removes itself from the table
+// when it's destroyed, but the data must be removed from the table before
+// being modified too, as its hash would change otherwise.
+
+namespace
+{
+
+struct wxFontRefDataHash
+{
+    size_t operator()(const wxFontRefData* data) const
+    {
+        return data->GetHash();
+    }
+};
+
+struct wxFontRefDataEqual
+{
+    bool operator()(const wxFontRefData* data1,
+                    const wxFontRefData* data2) const
+    {
+        return data1->IsSameAs(*data2);
+    }
+};
+
+typedef std::unordered_set<wxFontRefData*,
+                           wxFontRefDataHash,
+                           wxFontRefDataEqual> wxFontDataTable;
+
+wxFontDataTable* gs_fontDataTable = nullptr;
+
+#if wxUSE_THREADS
+// Protects gs_fontDataTable: while only the fonts created in the main thread
+// are interned, their data can still be released in the other threads.
+wxCriticalSection gs_fontDataTableLock;
+#endif // wxUSE_THREADS
+
+// Set when the table is destroyed during the library shutdown to avoid
+// recreating it if any fonts are created after this.
+bool gs_fontDataTableDestroyed = false;
+
+void RemoveFromFontDataTable(wxFontRefData* data)
+{
+    if ( !data->m_interned )
+        return;
+
+#if wxUSE_THREADS
+    wxCriticalSectionLocker lock(gs_fontDataTableLock);
+#endif // wxUSE_THREADS
+
+    data->m_interned = false;
+    gs_fontDataTable->erase(data);
+}
+
+// Make the font use the data of an existing identical font, if any, or add
+// its data to the table otherwise.
+void InternFontData(wxFont& font)
+{
+    wxFontRefData* const data = static_cast<wxFontRefData*>(font.GetRefData());
+    if ( !data || data->m_interned )
+        return;
+
+    // Don't intern the fonts created in the other threads, e.g. for drawing
+    // on wxImage using wxGraphicsContext, as this would make them share their
+    // data, whose reference count is not atomic, with the fonts used in the
+    // main thread, or in yet another thread.
+    if ( !wxIsMainThread() )
+        return;
+
+#if wxUSE_THREADS
+    wxCriticalSectionLocker lock(gs_fontDataTableLock);
+#endif // wxUSE_THREADS
+
+    if ( !gs_fontDataTable )
+    {
+        if ( gs_fontDataTableDestroyed )
+            return;
+
+        gs_fontDataTable = new wxFontDataTable;
+    }
+
+    const std::pair<wxFontDataTable::iterator, bool>
+        res = gs_fontDataTable->insert(data);
+    if ( res.second )
+    {
+        data->m_interned = true;
+        return;
+    }
+
+    wxFontRefData* const existing = *res.first;
+    existing->IncRef();
+
+    font.UnRef();
+    font.SetRefData(existing);
+}
+
+} // anonymous namespace
+
+class wxFontDataTableModule : public wxModule
+{
+public:
+    wxFontDataTableModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override
+    {
+#if wxUSE_THREADS
+        wxCriticalSectionLocker lock(gs_fontDataTableLock);
+#endif // wxUSE_THREADS
+
+        if ( !gs_fontDataTable )
+            return;
+
+        // Fonts still existing at this time, e.g. global ones, will be
+        // destroyed later and must not try to access the table any more.
+        for ( wxFontDataTable::const_iterator it = gs_fontDataTable->begin();
+              it != gs_fontDataTable->end();
+              ++it )
+        {
+            (*it)->m_interned = false;
+        }
+
+        wxDELETE(gs_fontDataTable);
+        gs_fontDataTableDestroyed = true;
+    }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxFontDataTableModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxFontDataTableModule, wxModule);
+
 // ----------------------------------------------------------------------------
 // wxFontRefData
 // ----------------------------------------------------------------------------
@@ -123,6 +277,30 @@ wxFontRefData::wxFontRefData( const wxFontRefData& data )
 {
 }
 
+wxFontRefData::~wxFontRefData()
+{
+    RemoveFromFontDataTable(this);
+}
+
+size_t wxFontRefData::GetHash() const
+{
+    size_t hash = pango_font_description_hash(m_nativeFontInfo.description);
+    if ( m_nativeFontInfo.GetUnderlined() )
+        hash ^= 1;
+    if ( m_nativeFontInfo.GetStrikethrough() )
+        hash ^= 2;
+    return hash;
+}
+
+bool wxFontRefData::IsSameAs(const wxFontRefData& other) const
+{
+    const wxNativeFontInfo& info = other.m_nativeFontInfo;
+    return m_nativeFontInfo.GetUnderlined() == info.GetUnderlined() &&
+           m_nativeFontInfo.GetStrikethrough() == info.GetStrikethrough() &&
+           pango_font_description_equal(m_nativeFontInfo.description,
+                                        info.description);
+}
+
 wxFontRefData::wxFontRefData(const wxString& nativeFontInfoString)
 {
     m_nativeFontInfo.FromString( nativeFontInfoString );
@@ -136,6 +314,8 @@ wxFontRefData::wxFontRefData(const wxString& nativeFontInfoString)
 
 void wxFontRefData::SetFractionalPointSize(double pointSize)
 {
+    RemoveFromFontDataTable(this);
+
     m_nativeFontInfo.SetFractionalPointSize(pointSize);
 }
 
@@ -170,36 +350,50 @@ bool wxFontRefData::SetPixelSize(const wxSize& pixelSize)
 
 void wxFontRefData::SetFamily(wxFontFamily family)
 {
+    RemoveFromFontDataTable(this);
+
     m_nativeFontInfo.SetFamily(family);
 }
 
 void wxFontRefData::SetStyle(wxFontStyle style)
 {
+    RemoveFromFontDataTable(this);
+
     m_nativeFontInfo.SetStyle(style);
 }
 
 void wxFontRefData::SetWeight(wxFontWeight weight)
 {
+    RemoveFromFontDataTable(this);
+
     m_nativeFontInfo.SetWeight(weight);
 }
 
 void wxFontRefData::SetNumericWeight(int weight)
 {
+    RemoveFromFontDataTable(this);
+
     m_nativeFontInfo.SetNumericWeight(weight);
 }
 
 void wxFontRefData::SetUnderlined(bool underlined)
 {
+    RemoveFromFontDataTable(this);
+
     m_nativeFontInfo.SetUnderlined(underlined);
 }
 
 void wxFontRefData::SetStrikethrough(bool strikethrough)
 {
+    RemoveFromFontDataTable(this);
+
     m_nativeFontInfo.SetStrikethrough(strikethrough);
 }
 
 bool wxFontRefData::SetFaceName(const wxString& facename)
 {
+    RemoveFromFontDataTable(this);
+
     return m_nativeFontInfo.SetFaceName(facename);
 }
 
@@ -210,6 +404,8 @@ void wxFontRefData::SetEncoding(wxFontEncoding WXUNUSED(encoding))
 
 void wxFontRefData::SetNativeFontInfo(const wxNativeFontInfo& info)
 {
+    RemoveFromFontDataTable(this);
+
     m_nativeFontInfo = info;
 
     // set all the other font parameters from the native font info
@@ -241,6 +437,8 @@ wxFont::wxFont(const wxFontInfo& info)
     wxSize pixelSize = info.GetPixelSize();
     if ( pixelSize != wxDefaultSize )
         SetPixelSize(pixelSize);
+
+    InternFontData(*this);
 }
 
 bool wxFont::Create( int pointSize,
@@ -257,6 +455,8 @@ bool wxFont::Create( int pointSize,
                                                        style, weight, underlined,
                                                        face, encoding));
 
+    InternFontData(*this);
+
     return true;
 }
 
@@ -272,6 +472,8 @@ bool wxFont::Create(const wxString& fontname)
 
     m_refData = new wxFontRefData(fontname);
 
+    InternFontData(*this);
+
     return true;
 }
 
@@ -357,6 +559,8 @@ void wxFont::SetFractionalPointSize(double pointSize)
     AllocExclusive();
 
     M_FONTDATA->SetFractionalPointSize(pointSize);
+
+    InternFontData(*this);
 }
 
 void wxFont::SetFamily(wxFontFamily family)
@@ -364,6 +568,8 @@ void wxFont::SetFamily(wxFontFamily family)
     AllocExclusive();
 
     M_FONTDATA->SetFamily(family);
+
+    InternFontData(*this);
 }
 
 void wxFont::SetStyle(wxFontStyle style)
@@ -371,6 +577,8 @@ void wxFont::SetStyle(wxFontStyle style)
     AllocExclusive();
 
     M_FONTDATA->SetStyle(style);
+
+    InternFontData(*this);
 }
 
 void wxFont::SetNumericWeight(int weight)
@@ -378,14 +586,20 @@ void wxFont::SetNumericWeight(int weight)
     AllocExclusive();
     
     M_FONTDATA->SetNumericWeight(weight);
+
+    InternFontData(*this);
 }
 
 bool wxFont::SetFaceName(const wxString& faceName)
 {
     AllocExclusive();
 
-    return M_FONTDATA->SetFaceName(faceName) &&
-           wxFontBase::SetFaceName(faceName);
+    const bool ok = M_FONTDATA->SetFaceName(faceName) &&
+                    wxFontBase::SetFaceName(faceName);
+
+    InternFontData(*this);
+
+    return ok;
 }
 
 void wxFont::SetUnderlined(bool underlined)
@@ -393,6 +607,8 @@ void wxFont::SetUnderlined(bool underlined)
     AllocExclusive();
 
     M_FONTDATA->SetUnderlined(underlined);
+
+    InternFontData(*this);
 }
 
 void wxFont::SetStrikethrough(bool strikethrough)
@@ -400,6 +616,8 @@ void wxFont::SetStrikethrough(bool strikethrough)
     AllocExclusive();
 
     M_FONTDATA->SetStrikethrough(strikethrough);
+
+    InternFontData(*this);
 }
 
 void wxFont::SetEncoding(wxFontEncoding encoding)
@@ -414,6 +632,8 @@ void wxFont::DoSetNativeFontInfo( const wxNativeFontInfo& info )
     AllocExclusive();
 
     M_FONTDATA->SetNativeFontInfo( info );
+
+    InternFontData(*this);
 }
 
 wxGDIRefData* wxFont::CreateGDIRefData() const
@@ -2258,16 +2258,18 @@ void wxGtkPrinterDCImpl::DoGetTextExtent(const wxString& string, wxCoord *width,
     // Set layout's text
     const wxScopedCharBuffer dataUTF8 = string.utf8_str();
 
-    gint oldSize=0;
     if ( theFont )
     {
-        // scale the font and apply it
-        PangoFontDescription *desc = theFont->GetNativeFontInfo()->description;
-        oldSize = pango_font_description_get_size(desc);
-        const float size = oldSize * GetFontPointSizeAdjustment(72.0);
+        // scale the font and apply it: notice that we must not modify the
+        // font description itself as it may be shared with other fonts
+        PangoFontDescription *desc =
+            pango_font_description_copy(theFont->GetNativeFontInfo()->description);
+        const float size = pango_font_description_get_size(desc) *
+                                GetFontPointSizeAdjustment(72.0);
         pango_font_description_set_size(desc, (gint)size);
 
         pango_layout_set_font_description(m_layout, desc);
+        pango_font_description_free(desc);
     }
 
     pango_layout_set_text( m_layout, dataUTF8, strlen(dataUTF8) );
@@ -2287,11 +2289,8 @@ void wxGtkPrinterDCImpl::DoGetTextExtent(const wxString& string, wxCoord *width,
 
     if ( theFont )
     {
-        // restore font and reset font's size back
+        // restore font
         pango_layout_set_font_description(m_layout, m_fontdesc);
-
-        PangoFontDescription *desc = theFont->GetNativeFontInfo()->description;
-        pango_font_description_set_size(desc, oldSize);
     }
 
     cairo_restore( m_cairo );
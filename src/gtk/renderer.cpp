@@ -29,6 +29,7 @@
 #endif
 
 #include "wx/dcgraph.h"
+#include "wx/math.h"
 #ifndef __WXGTK3__
     #include "wx/gtk/dc.h"
     #include "wx/gtk/private/wrapgtk.h"
@@ -42,6 +43,9 @@
 #include "wx/gtk/private/stylecontext.h"
 #include "wx/gtk/private/value.h"
 
+#include <map>
+#include <memory>
+
 #if defined(__WXGTK3__) && !GTK_CHECK_VERSION(3,14,0)
     #define GTK_STATE_FLAG_CHECKED (1 << 11)
 #endif
@@ -201,6 +205,313 @@ static GdkWindow* wxGetGTKDrawable(wxDC& dc)
 }
 #endif
 
+#ifdef __WXGTK3__
+
+// ----------------------------------------------------------------------------
+// cache of the style contexts and of the pre-rendered elements
+// ----------------------------------------------------------------------------
+
+extern "C" {
+static void wxgtk_renderer_theme_changed(GObject*, GParamSpec*, void*);
+}
+
+namespace
+{
+
+// Elements for which the style contexts are cached: each of them corresponds
+// to a different widget path.
+enum StyleContextKind
+{
+    StyleContext_HeaderButton,  // + position, i.e. 0, 1 or 2
+    StyleContext_SplitterBackground = StyleContext_HeaderButton + 3,
+    StyleContext_SplitterSash,
+    StyleContext_DropArrow,
+    StyleContext_CheckBox,
+    StyleContext_TextCtrl,
+    StyleContext_RadioButton
+};
+
+void InitStyleContext(wxGtkStyleContext& sc, int kind)
+{
+    switch (kind)
+    {
+#if GTK_CHECK_VERSION(3,20,0)
+        case StyleContext_HeaderButton:
+        case StyleContext_HeaderButton + 1:
+        case StyleContext_HeaderButton + 2:
+            sc.AddTreeviewHeaderButton(kind - StyleContext_HeaderButton);
+            break;
+#endif // GTK >= 3.20
+
+        case StyleContext_SplitterBackground:
+            sc.AddWindow();
+            break;
+
+        case StyleContext_SplitterSash:
+            sc.Add(GTK_TYPE_PANED, "paned", "pane-separator", nullptr);
+            if (gtk_check_version(3,20,0) == nullptr)
+                sc.Add("separator");
+            break;
+
+        case StyleContext_DropArrow:
+            sc.AddButton();
+            break;
+
+        case StyleContext_CheckBox:
+            sc.AddCheckButton();
+            if (gtk_check_version(3,20,0) == nullptr)
+                sc.Add("check");
+            break;
+
+        case StyleContext_TextCtrl:
+            sc.Add(GTK_TYPE_ENTRY, "entry", "entry", nullptr);
+            break;
+
+        case StyleContext_RadioButton:
+            sc.Add(GTK_TYPE_RADIO_BUTTON, "radiobutton", nullptr);
+            if (gtk_check_version(3,20,0) == nullptr)
+                sc.Add("radio");
+            break;
+
+        default:
+            wxFAIL_MSG("unknown style context kind");
+    }
+}
+
+// Creating the style contexts is relatively expensive, as it requires
+// resolving the CSS for the entire widget path, so we keep them around
+// instead of recreating them every time an element is drawn. Small elements
+// of fixed size, such as check boxes, are also pre-rendered into surfaces as
+// they are typically drawn many times, e.g. once per row of a wxDataViewCtrl.
+class StyleContextCache
+{
+public:
+    StyleContextCache() = default;
+    ~StyleContextCache() { Clear(); }
+
+    // Return the style context for the given element in the given state,
+    // creating it if necessary.
+    GtkStyleContext* Get(int kind, int state, double scale)
+    {
+        const ContextKey key = { kind, state, int(scale) };
+        ContextMap::iterator it = m_contexts.find(key);
+        if (it == m_contexts.end())
+        {
+            ConnectThemeSignals();
+
+            wxGtkStyleContext* const sc = new wxGtkStyleContext(scale);
+            InitStyleContext(*sc, kind);
+            gtk_style_context_set_state(*sc, GtkStateFlags(state));
+
+            it = m_contexts.emplace(key, std::unique_ptr<wxGtkStyleContext>(sc)).first;
+        }
+
+        return *it->second;
+    }
+
+    // Key identifying a pre-rendered element: as the element contents depends
+    // on its size and the metrics used for drawing it, they are all part of it.
+    struct SurfaceKey
+    {
+        int kind;
+        int state;
+        double scale;
+        wxSize size;
+        wxRect content;
+
+        bool operator<(const SurfaceKey& other) const
+        {
+            if (kind != other.kind)
+                return kind < other.kind;
+            if (state != other.state)
+                return state < other.state;
+            if (scale != other.scale)
+                return scale < other.scale;
+            if (size != other.size)
+                return size.x < other.size.x ||
+                        (size.x == other.size.x && size.y < other.size.y);
+            if (content.x != other.content.x)
+                return content.x < other.content.x;
+            if (content.y != other.content.y)
+                return content.y < other.content.y;
+            if (content.width != other.content.width)
+                return content.width < other.content.width;
+            return content.height < other.content.height;
+        }
+    };
+
+    // Return the previously stored surface or nullptr.
+    cairo_surface_t* GetSurface(const SurfaceKey& key) const
+    {
+        const SurfaceMap::const_iterator it = m_surfaces.find(key);
+        return it == m_surfaces.end() ? nullptr : it->second;
+    }
+
+    // Take ownership of the given surface.
+    void AddSurface(const SurfaceKey& key, cairo_surface_t* surface)
+    {
+        // Elements of many different sizes are not expected to be used, so
+        // just start from scratch if we somehow accumulate too many of them.
+        if (m_surfaces.size() >= 64)
+            ClearSurfaces();
+
+        ConnectThemeSignals();
+
+        m_surfaces[key] = surface;
+    }
+
+    void Clear()
+    {
+        m_contexts.clear();
+        ClearSurfaces();
+    }
+
+    // Disconnect from the GTK settings signals and clear the cache, called
+    // on shutdown.
+    void Reset()
+    {
+        if (m_connected)
+        {
+            GtkSettings* const settings = gtk_settings_get_default();
+            if (settings)
+            {
+                g_signal_handlers_disconnect_by_func(settings,
+                    (void*)wxgtk_renderer_theme_changed, nullptr);
+            }
+
+            m_connected = false;
+        }
+
+        Clear();
+    }
+
+private:
+    void ClearSurfaces()
+    {
+        for (SurfaceMap::const_iterator it = m_surfaces.begin();
+             it != m_surfaces.end();
+             ++it)
+        {
+            cairo_surface_destroy(it->second);
+        }
+
+        m_surfaces.clear();
+    }
+
+    // Ensure that we're notified about the theme changes, which invalidate
+    // all the cached data.
+    void ConnectThemeSignals()
+    {
+        if (m_connected)
+            return;
+
+        GtkSettings* const settings = gtk_settings_get_default();
+        if (!settings)
+            return;
+
+        g_signal_connect(settings, "notify::gtk-theme-name",
+            G_CALLBACK(wxgtk_renderer_theme_changed), nullptr);
+        g_signal_connect(settings, "notify::gtk-application-prefer-dark-theme",
+            G_CALLBACK(wxgtk_renderer_theme_changed), nullptr);
+
+        m_connected = true;
+    }
+
+    struct ContextKey
+    {
+        int kind;
+        int state;
+        int scale;
+
+        bool operator<(const ContextKey& other) const
+        {
+            if (kind != other.kind)
+                return kind < other.kind;
+            if (state != other.state)
+                return state < other.state;
+            return scale < other.scale;
+        }
+    };
+
+    typedef std::map< ContextKey, std::unique_ptr<wxGtkStyleContext> > ContextMap;
+    ContextMap m_contexts;
+
+    typedef std::map<SurfaceKey, cairo_surface_t*> SurfaceMap;
+    SurfaceMap m_surfaces;
+
+    bool m_connected = false;
+
+    wxDECLARE_NO_COPY_CLASS(StyleContextCache);
+};
+
+StyleContextCache gs_styleContextCache;
+
+} // anonymous namespace
+
+extern "C" {
+static void wxgtk_renderer_theme_changed(GObject*, GParamSpec*, void*)
+{
+    gs_styleContextCache.Clear();
+}
+}
+
+// Create a surface for pre-rendering an element of the given size at the
+// given scale, return nullptr if this is not supported.
+static cairo_surface_t* wxCreateElementSurface(const wxSize& size, double scale)
+{
+#if CAIRO_VERSION >= CAIRO_VERSION_ENCODE(1,14,0)
+    if (cairo_version() >= CAIRO_VERSION_ENCODE(1,14,0))
+    {
+        cairo_surface_t* const surface = cairo_image_surface_create(
+            CAIRO_FORMAT_ARGB32,
+            int(ceil(size.x * scale)), int(ceil(size.y * scale)));
+        if (cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS)
+        {
+            cairo_surface_destroy(surface);
+            return nullptr;
+        }
+
+        cairo_surface_set_device_scale(surface, scale, scale);
+        return surface;
+    }
+#endif
+
+    wxUnusedVar(size);
+    wxUnusedVar(scale);
+    return nullptr;
+}
+
+// Draw the previously rendered element at the given position.
+static void wxDrawElementSurface(cairo_t* cr, cairo_surface_t* surface,
+                                 int x, int y, int w, int h)
+{
+    cairo_save(cr);
+    cairo_set_source_surface(cr, surface, x, y);
+    cairo_rectangle(cr, x, y, w, h);
+    cairo_fill(cr);
+    cairo_restore(cr);
+}
+
+// ----------------------------------------------------------------------------
+// wxRendererGTKModule: clears the style contexts cache on shutdown
+// ----------------------------------------------------------------------------
+
+class wxRendererGTKModule : public wxModule
+{
+public:
+    wxRendererGTKModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override { gs_styleContextCache.Reset(); }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxRendererGTKModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxRendererGTKModule, wxModule);
+
+#endif // __WXGTK3__
+
 // ----------------------------------------------------------------------------
 // list/tree controls drawing
 // ----------------------------------------------------------------------------
@@ -243,10 +554,10 @@ wxRendererGTK::DrawHeaderButton(wxWindow *win,
         if (flags & wxCONTROL_DIRTY)
             pos = 2;
 
-        wxGtkStyleContext sc(dc.GetContentScaleFactor());
-        sc.AddTreeviewHeaderButton(pos);
+        GtkStyleContext* sc = gs_styleContextCache.Get(
+            StyleContext_HeaderButton + pos, stateTypeToFlags[state],
+            dc.GetContentScaleFactor());
 
-        gtk_style_context_set_state(sc, stateTypeToFlags[state]);
         gtk_render_background(sc, cr, rect.x, rect.y, rect.width, rect.height);
         gtk_render_frame(sc, cr, rect.x, rect.y, rect.width, rect.height);
     }
@@ -444,16 +755,15 @@ wxRendererGTK::DrawSplitterSash(wxWindow* win,
     }
 
 #ifdef __WXGTK3__
-    wxGtkStyleContext sc(dc.GetContentScaleFactor());
-    sc.AddWindow();
-    gtk_render_background(sc, drawable, rect.x, rect.y, rect.width, rect.height);
+    const double scale = dc.GetContentScaleFactor();
 
-    sc.Add(GTK_TYPE_PANED, "paned", "pane-separator", nullptr);
-    if (gtk_check_version(3,20,0) == nullptr)
-        sc.Add("separator");
+    GtkStyleContext* sc = gs_styleContextCache.Get(
+        StyleContext_SplitterBackground, GTK_STATE_FLAG_NORMAL, scale);
+    gtk_render_background(sc, drawable, rect.x, rect.y, rect.width, rect.height);
 
-    gtk_style_context_set_state(sc,
-        flags & wxCONTROL_CURRENT ? GTK_STATE_FLAG_PRELIGHT : GTK_STATE_FLAG_NORMAL);
+    sc = gs_styleContextCache.Get(StyleContext_SplitterSash,
+        flags & wxCONTROL_CURRENT ? GTK_STATE_FLAG_PRELIGHT : GTK_STATE_FLAG_NORMAL,
+        scale);
     gtk_render_handle(sc, drawable, rect.x, rect.y, rect.width, rect.height);
 #else
     int x_diff = 0;
@@ -514,9 +824,8 @@ wxRendererGTK::DrawDropArrow(wxWindow*,
     cairo_t* cr = wxGetGTKDrawable(dc);
     if (cr)
     {
-        wxGtkStyleContext sc(dc.GetContentScaleFactor());
-        sc.AddButton();
-        gtk_style_context_set_state(sc, stateTypeToFlags[state]);
+        GtkStyleContext* sc = gs_styleContextCache.Get(StyleContext_DropArrow,
+            stateTypeToFlags[state], dc.GetContentScaleFactor());
         gtk_render_arrow(sc, cr, G_PI, x, y, size);
     }
 #else
@@ -561,14 +870,12 @@ namespace
 struct CheckBoxInfo
 {
 #ifdef __WXGTK3__
-    CheckBoxInfo(wxGtkStyleContext& sc, int flags)
+    CheckBoxInfo(GtkStyleContext* sc, int flags)
     {
         wxUnusedVar(flags);
 
-        sc.AddCheckButton();
         if (gtk_check_version(3,20,0) == nullptr)
         {
-            sc.Add("check");
             gtk_style_context_get(sc, GTK_STATE_FLAG_NORMAL,
                                   "min-width", &indicator_width,
                                   "min-height", &indicator_height,
@@ -684,7 +991,8 @@ wxRendererGTK::GetCheckBoxSize(wxWindow* win, int flags)
     wxCHECK_MSG(win, size, "Must have a valid window");
 
 #ifdef __WXGTK3__
-    wxGtkStyleContext sc(win->GetContentScaleFactor());
+    GtkStyleContext* sc = gs_styleContextCache.Get(StyleContext_CheckBox,
+        GTK_STATE_FLAG_NORMAL, win->GetContentScaleFactor());
 
     const CheckBoxInfo info(sc, flags);
 #else // !__WXGTK3__
@@ -724,7 +1032,9 @@ wxRendererGTK::DrawCheckBox(wxWindow*,
     if (flags & wxCONTROL_CURRENT)
         state |= GTK_STATE_FLAG_PRELIGHT;
 
-    wxGtkStyleContext sc(dc.GetContentScaleFactor());
+    const double scale = dc.GetContentScaleFactor();
+    GtkStyleContext* sc = gs_styleContextCache.Get(StyleContext_CheckBox,
+        state, scale);
 
     CheckBoxInfo info(sc, flags);
     info.FitInto(rect);
@@ -746,20 +1056,50 @@ wxRendererGTK::DrawCheckBox(wxWindow*,
 
     if (gtk_check_version(3,20,0) == nullptr)
     {
-        gtk_style_context_set_state(sc, GtkStateFlags(state));
-        gtk_render_background(sc, cr, x, y, w, h);
-        gtk_render_frame(sc, cr, x, y, w, h);
+        const auto render = [sc, &info, w, h](cairo_t* crTarget, int x0, int y0)
+        {
+            gtk_render_background(sc, crTarget, x0, y0, w, h);
+            gtk_render_frame(sc, crTarget, x0, y0, w, h);
+
+            // check is rendered in content area
+            gtk_render_check(sc, crTarget,
+                             x0 + info.margin_left, y0 + info.margin_top,
+                             info.indicator_width, info.indicator_height);
+        };
+
+        // Check boxes are typically drawn many times, so render them once
+        // and reuse the result.
+        const StyleContextCache::SurfaceKey key =
+        {
+            StyleContext_CheckBox, state, scale, wxSize(w, h),
+            wxRect(info.margin_left, info.margin_top,
+                   info.indicator_width, info.indicator_height)
+        };
 
-        // check is rendered in content area
-        gtk_render_check(sc, cr,
-                         x + info.margin_left, y + info.margin_top,
-                         info.indicator_width, info.indicator_height);
+        cairo_surface_t* surface = gs_styleContextCache.GetSurface(key);
+        if (!surface)
+        {
+            surface = wxCreateElementSurface(key.size, scale);
+            if (surface)
+            {
+                cairo_t* const crSurface = cairo_create(surface);
+                render(crSurface, 0, 0);
+                cairo_destroy(crSurface);
+
+                gs_styleContextCache.AddSurface(key, surface);
+            }
+        }
+
+        if (surface)
+            wxDrawElementSurface(cr, surface, x, y, w, h);
+        else
+            render(cr, x, y);
     }
     else
     {
-        // need save/restore for GTK+ 3.6 & 3.8
+        // need save/restore for GTK+ 3.6 & 3.8 and to avoid modifying the
+        // cached context
         gtk_style_context_save(sc);
-        gtk_style_context_set_state(sc, GtkStateFlags(state));
         gtk_render_background(sc, cr, x, y, w, h);
         gtk_render_frame(sc, cr, x, y, w, h);
         gtk_style_context_add_class(sc, "check");
@@ -963,10 +1303,9 @@ void wxRendererGTK::DrawTextCtrl(wxWindow*, wxDC& dc, const wxRect& rect, int fl
     if (flags & wxCONTROL_DISABLED)
         state = GTK_STATE_FLAG_INSENSITIVE;
 
-    wxGtkStyleContext sc(dc.GetContentScaleFactor());
-    sc.Add(GTK_TYPE_ENTRY, "entry", "entry", nullptr);
+    GtkStyleContext* sc = gs_styleContextCache.Get(StyleContext_TextCtrl,
+        state, dc.GetContentScaleFactor());
 
-    gtk_style_context_set_state(sc, GtkStateFlags(state));
     gtk_render_background(sc, drawable, rect.x, rect.y, rect.width, rect.height);
     gtk_render_frame(sc, drawable, rect.x, rect.y, rect.width, rect.height);
 #else
@@ -1113,11 +1452,10 @@ void wxRendererGTK::DrawRadioBitmap(wxWindow*, wxDC& dc, const wxRect& rect, int
         state |= GTK_STATE_FLAG_PRELIGHT;
 
     int min_width, min_height;
-    wxGtkStyleContext sc(dc.GetContentScaleFactor());
-    sc.Add(GTK_TYPE_RADIO_BUTTON, "radiobutton", nullptr);
+    GtkStyleContext* sc = gs_styleContextCache.Get(StyleContext_RadioButton,
+        state, dc.GetContentScaleFactor());
     if (gtk_check_version(3,20,0) == nullptr)
     {
-        sc.Add("radio");
         gtk_style_context_get(sc, GTK_STATE_FLAG_NORMAL,
             "min-width", &min_width, "min-height", &min_height, nullptr);
     }
@@ -1129,9 +1467,9 @@ void wxRendererGTK::DrawRadioBitmap(wxWindow*, wxDC& dc, const wxRect& rect, int
         min_height = min_width;
     }
 
-    // need save/restore for GTK+ 3.6 & 3.8
+    // need save/restore for GTK+ 3.6 & 3.8 and to avoid modifying the
+    // cached context
     gtk_style_context_save(sc);
-    gtk_style_context_set_state(sc, GtkStateFlags(state));
     const int x = rect.x + (rect.width - min_width) / 2;
     const int y = rect.y + (rect.height - min_height) / 2;
     gtk_render_background(sc, drawable, x, y, min_width, min_height);
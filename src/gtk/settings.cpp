@@ -1156,12 +1156,8 @@ static int GetScrollbarWidth()
     return width;
 }
 
-int wxSystemSettingsNative::GetMetric( wxSystemMetric index, const wxWindow* win )
+static int DoGetMetric(wxSystemMetric index, const wxWindow* win, GdkWindow* window)
 {
-    GdkWindow *window = nullptr;
-    if (win)
-        window = gtk_widget_get_window(win->GetHandle());
-
     switch (index)
     {
         case wxSYS_BORDER_X:
@@ -1341,6 +1337,113 @@ int wxSystemSettingsNative::GetMetric( wxSystemMetric index, const wxWindow* win
     }
 }
 
+// Cache of the metrics which only depend on GtkSettings and the screen size,
+// as retrieving them is relatively expensive and some of them are queried
+// very often, e.g. wxSYS_DCLICK_X or wxSYS_DRAG_X for every mouse event.
+// The cached values are only used for the default screen and are discarded
+// whenever any setting or the screen configuration changes.
+struct wxCachedMetric
+{
+    int value;
+    bool isValid;
+};
+
+static wxCachedMetric gs_metricCache[wxSYS_CARET_TIMEOUT_MSEC + 1];
+static GtkSettings* gs_metricCacheSettings;
+static GdkScreen* gs_metricCacheScreen;
+
+static bool IsCacheableMetric(wxSystemMetric index)
+{
+    switch (index)
+    {
+        case wxSYS_CURSOR_X:
+        case wxSYS_CURSOR_Y:
+        case wxSYS_DCLICK_X:
+        case wxSYS_DCLICK_Y:
+        case wxSYS_DCLICK_MSEC:
+        case wxSYS_CARET_ON_MSEC:
+        case wxSYS_CARET_OFF_MSEC:
+        case wxSYS_CARET_TIMEOUT_MSEC:
+        case wxSYS_DRAG_X:
+        case wxSYS_DRAG_Y:
+#ifndef __WXGTK4__
+        case wxSYS_SCREEN_X:
+        case wxSYS_SCREEN_Y:
+#endif
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+extern "C" {
+static void wx_metric_cache_invalidate()
+{
+    for (size_t n = 0; n < WXSIZEOF(gs_metricCache); n++)
+        gs_metricCache[n].isValid = false;
+}
+
+static void notify_gtk_settings(GObject*, GParamSpec*, void*)
+{
+    wx_metric_cache_invalidate();
+}
+
+static void screen_changed(GdkScreen*, void*)
+{
+    wx_metric_cache_invalidate();
+}
+}
+
+static void ConnectMetricCacheSignals()
+{
+    gs_metricCacheSettings = gtk_settings_get_default();
+    g_object_ref(gs_metricCacheSettings);
+    g_signal_connect(gs_metricCacheSettings, "notify",
+        G_CALLBACK(notify_gtk_settings), nullptr);
+
+#ifndef __WXGTK4__
+    gs_metricCacheScreen = gdk_screen_get_default();
+    g_object_ref(gs_metricCacheScreen);
+    g_signal_connect(gs_metricCacheScreen, "size-changed",
+        G_CALLBACK(screen_changed), nullptr);
+#if GTK_CHECK_VERSION(2,14,0)
+    if (wx_is_at_least_gtk2(14))
+    {
+        g_signal_connect(gs_metricCacheScreen, "monitors-changed",
+            G_CALLBACK(screen_changed), nullptr);
+    }
+#endif
+#endif // !__WXGTK4__
+}
+
+int wxSystemSettingsNative::GetMetric( wxSystemMetric index, const wxWindow* win )
+{
+    GdkWindow *window = nullptr;
+    if (win)
+        window = gtk_widget_get_window(win->GetHandle());
+
+    if (!IsCacheableMetric(index) ||
+            GetSettingsForWindowScreen(window) != gtk_settings_get_default())
+    {
+        return DoGetMetric(index, win, window);
+    }
+
+    // The signals are disconnected in wxSystemSettingsModule::OnExit(), so
+    // use the settings pointer, reset there, rather than a static flag.
+    if (!gs_metricCacheSettings)
+        ConnectMetricCacheSignals();
+
+    wxCachedMetric& metric = gs_metricCache[index];
+    if (!metric.isValid)
+    {
+        metric.value = DoGetMetric(index, win, window);
+        metric.isValid = true;
+    }
+
+    return metric.value;
+}
+
 bool wxSystemSettingsNative::HasFeature(wxSystemFeature index)
 {
     switch (index)
@@ -1441,4 +1544,20 @@ void wxSystemSettingsModule::OnExit()
         gtk_widget_destroy(gs_tlw_parent);
         gs_tlw_parent = nullptr;
     }
+
+    if (gs_metricCacheSettings)
+    {
+        g_signal_handlers_disconnect_by_func(gs_metricCacheSettings,
+            (void*)notify_gtk_settings, nullptr);
+        g_object_unref(gs_metricCacheSettings);
+        gs_metricCacheSettings = nullptr;
+    }
+    if (gs_metricCacheScreen)
+    {
+        g_signal_handlers_disconnect_by_func(gs_metricCacheScreen,
+            (void*)screen_changed, nullptr);
+        g_object_unref(gs_metricCacheScreen);
+        gs_metricCacheScreen = nullptr;
+    }
+    wx_metric_cache_invalidate();
 }
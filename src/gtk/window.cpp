@@ -2787,6 +2787,9 @@ void wxWindowGTK::Init()
 #ifdef __WXGTK3__
     m_paintContext = nullptr;
     m_styleProvider = nullptr;
+    m_scrollBacking = nullptr;
+    m_useScrollBacking = false;
+    m_scrollBackingScrolled = false;
     m_needSizeEvent = false;
 #endif
 
@@ -3004,6 +3007,8 @@ wxWindowGTK::~wxWindowGTK()
 #ifdef __WXGTK3__
     if (m_styleProvider)
         g_object_unref(m_styleProvider);
+    if (m_scrollBacking)
+        cairo_surface_destroy(m_scrollBacking);
 
     gs_sizeRevalidateList = g_list_remove_all(gs_sizeRevalidateList, this);
 #endif
@@ -5386,6 +5391,10 @@ void wxWindowGTK::Refresh(bool WXUNUSED(eraseBackground),
 {
     if (m_wxwindow)
     {
+#ifdef __WXGTK3__
+        GTKInvalidateScrollBacking(rect);
+#endif
+
         if (gtk_widget_get_mapped(m_wxwindow))
         {
             GdkWindow* window = gtk_widget_get_window(m_wxwindow);
@@ -5449,12 +5458,127 @@ bool wxWindowGTK::DoIsExposed( int x, int y, int w, int h ) const
 }
 
 #ifdef __WXGTK3__
+bool wxWindowGTK::EnableScrollBackingStore(bool enable)
+{
+    m_useScrollBacking = enable;
+
+    if (!enable && m_scrollBacking)
+    {
+        cairo_surface_destroy(m_scrollBacking);
+        m_scrollBacking = nullptr;
+        m_scrollBackingInvalid.Clear();
+    }
+
+    return true;
+}
+
+void wxWindowGTK::GTKInvalidateScrollBacking(const wxRect* rect)
+{
+    if (!m_scrollBacking)
+        return;
+
+    // The invalid part of the backing store is kept in native coordinates.
+    if (rect)
+    {
+        wxRect r(*rect);
+        if (GetLayoutDirection() == wxLayout_RightToLeft)
+            r.x = m_scrollBackingSize.x - r.x - r.width;
+        m_scrollBackingInvalid.Union(r);
+    }
+    else
+    {
+        m_scrollBackingInvalid = wxRegion(wxRect(m_scrollBackingSize));
+    }
+}
+
+cairo_t* wxWindowGTK::GTKBeginScrollBackingPaint(cairo_t* crWindow)
+{
+    GdkWindow* window = gtk_widget_get_window(m_wxwindow);
+    const wxSize size(gdk_window_get_width(window),
+                      gdk_window_get_height(window));
+
+    if (!m_scrollBacking || size != m_scrollBackingSize)
+    {
+        if (m_scrollBacking)
+            cairo_surface_destroy(m_scrollBacking);
+
+        m_scrollBacking = gdk_window_create_similar_surface(window,
+                            CAIRO_CONTENT_COLOR, size.x, size.y);
+        m_scrollBackingSize = size;
+        m_scrollBackingInvalid = wxRegion(wxRect(size));
+    }
+    else if (!m_scrollBackingScrolled)
+    {
+        // Unless the window was just scrolled, in which case GTK may expose
+        // all of it but only the newly exposed strips need to be repainted,
+        // the window is exposed because its contents changed, e.g. because
+        // of a theme change or because it was drawn over using wxClientDC,
+        // so we can't reuse the backing store contents for the exposed area.
+        cairo_rectangle_list_t* const list = cairo_copy_clip_rectangle_list(crWindow);
+        if (list->status == CAIRO_STATUS_SUCCESS)
+        {
+            for (int i = 0; i < list->num_rectangles; i++)
+            {
+                const cairo_rectangle_t& r = list->rectangles[i];
+                const int x = int(floor(r.x));
+                const int y = int(floor(r.y));
+                m_scrollBackingInvalid.Union(x, y,
+                    int(ceil(r.x + r.width)) - x, int(ceil(r.y + r.height)) - y);
+            }
+        }
+        else
+        {
+            m_scrollBackingInvalid = wxRegion(wxRect(size));
+        }
+        cairo_rectangle_list_destroy(list);
+    }
+
+    m_scrollBackingScrolled = false;
+
+    if (m_scrollBackingInvalid.IsEmpty())
+        return nullptr;
+
+    cairo_t* cr = cairo_create(m_scrollBacking);
+    gdk_cairo_region(cr, m_scrollBackingInvalid.GetRegion());
+    cairo_clip(cr);
+
+    // Reset the invalid region before painting, so that any refreshes done
+    // by the paint handlers are not lost.
+    m_scrollBackingInvalid.Clear();
+
+    return cr;
+}
+
+void wxWindowGTK::GTKEndScrollBackingPaint(cairo_t* crWindow, cairo_t* cr)
+{
+    cairo_destroy(cr);
+
+    cairo_set_source_surface(crWindow, m_scrollBacking, 0, 0);
+    cairo_paint(crWindow);
+}
+
 void wxWindowGTK::GTKSendPaintEvents(cairo_t* cr)
 #else
 void wxWindowGTK::GTKSendPaintEvents(const GdkRegion* region)
 #endif
 {
 #ifdef __WXGTK3__
+    // When using the backing store, we paint into it and only copy it to the
+    // window at the end, which allows ScrollWindow() to just move its
+    // contents instead of repainting everything.
+    cairo_t* const crWindow = cr;
+    if (m_useScrollBacking && GetBackgroundStyle() != wxBG_STYLE_TRANSPARENT)
+    {
+        cr = GTKBeginScrollBackingPaint(crWindow);
+        if (!cr)
+        {
+            // Nothing changed since the last time, just show the old contents.
+            cairo_set_source_surface(crWindow, m_scrollBacking, 0, 0);
+            cairo_paint(crWindow);
+            return;
+        }
+    }
+    else
     {
         cairo_region_t* region = gdk_window_get_clip_region(gtk_widget_get_window(m_wxwindow));
         cairo_rectangle_int_t rect;
@@ -5474,7 +5598,11 @@ void wxWindowGTK::GTKSendPaintEvents(const GdkRegion* region)
     cairo_clip_extents(cr, &x1, &y1, &x2, &y2);
 
     if (x1 >= x2 || y1 >= y2)
+    {
+        if (cr != crWindow)
+            GTKEndScrollBackingPaint(crWindow, cr);
         return;
+    }
 
     m_paintContext = cr;
     m_updateRegion = wxRegion(int(x1), int(y1), int(x2 - x1), int(y2 - y1));
@@ -5621,6 +5749,14 @@ void wxWindowGTK::GTKSendPaintEvents(const GdkRegion* region)
     wxPaintEvent paint_event( this );
     HandleWindowEvent( paint_event );
 
+#ifdef __WXGTK3__
+    if (cr != crWindow)
+    {
+        GTKEndScrollBackingPaint(crWindow, cr);
+        cr = crWindow;
+    }
+#endif
+
 #if wxGTK_HAS_COMPOSITING_SUPPORT
     if (IsTransparentBackgroundSupported())
     { // now composite children which need it
@@ -6633,6 +6769,49 @@ wxEventType wxWindowGTK::GTKGetScrollEventType(GtkRange* range)
     return eventType;
 }
 
+#ifdef __WXGTK3__
+void wxWindowGTK::GTKScrollBacking(int dx, int dy)
+{
+    const wxRect rectAll(m_scrollBackingSize);
+
+    if (GetLayoutDirection() == wxLayout_RightToLeft ||
+            abs(dx) >= rectAll.width || abs(dy) >= rectAll.height)
+    {
+        // Don't bother with mirroring the offsets, just repaint everything.
+        m_scrollBackingInvalid = wxRegion(rectAll);
+        return;
+    }
+
+    m_scrollBackingScrolled = true;
+
+    // Move the existing contents using an intermediate group, as the source
+    // and destination surfaces are the same.
+    cairo_t* cr = cairo_create(m_scrollBacking);
+    cairo_push_group(cr);
+    cairo_set_source_surface(cr, m_scrollBacking, dx, dy);
+    cairo_paint(cr);
+    cairo_pop_group_to_source(cr);
+    cairo_set_operator(cr, CAIRO_OPERATOR_SOURCE);
+    cairo_paint(cr);
+    cairo_destroy(cr);
+
+    // The parts which were invalid before are moved too, and the newly
+    // exposed strips need to be painted.
+    m_scrollBackingInvalid.Offset(dx, dy);
+    m_scrollBackingInvalid.Intersect(rectAll);
+
+    if (dx > 0)
+        m_scrollBackingInvalid.Union(0, 0, dx, rectAll.height);
+    else if (dx < 0)
+        m_scrollBackingInvalid.Union(rectAll.width + dx, 0, -dx, rectAll.height);
+
+    if (dy > 0)
+        m_scrollBackingInvalid.Union(0, 0, rectAll.width, dy);
+    else if (dy < 0)
+        m_scrollBackingInvalid.Union(0, rectAll.height + dy, rectAll.width, -dy);
+}
+#endif // __WXGTK3__
+
 void wxWindowGTK::ScrollWindow( int dx, int dy, const wxRect* WXUNUSED(rect) )
 {
     wxCHECK_RET( m_widget != nullptr, wxT("invalid window") );
@@ -6642,6 +6821,11 @@ void wxWindowGTK::ScrollWindow( int dx, int dy, const wxRect* WXUNUSED(rect) )
     // No scrolling requested.
     if ((dx == 0) && (dy == 0)) return;
 
+#ifdef __WXGTK3__
+    if (m_scrollBacking)
+        GTKScrollBacking(dx, dy);
+#endif
+
     m_clipPaintRegion = true;
 
     WX_PIZZA(m_wxwindow)->scroll(dx, dy);
@@ -6763,6 +6947,13 @@ void wxWindowGTK::GTKThawWidget(GtkWidget* widget)
 {
     g_signal_handlers_block_by_func(widget, (void*)draw_freeze, this);
     gtk_widget_queue_draw(widget);
+
+#ifdef __WXGTK3__
+    // The window is repainted entirely, as the changes done while it was
+    // frozen are unknown.
+    if (widget == m_wxwindow)
+        GTKInvalidateScrollBacking();
+#endif
 }
 
 void wxWindowGTK::DoFreeze()
@@ -157,6 +157,8 @@ wxColour wxRibbonAUIArtProvider::GetColour(int id) const
 
 void wxRibbonAUIArtProvider::SetColour(int id, const wxColor& colour)
 {
+    m_gradient_cache->Clear();
+
     switch(id)
     {
     case wxRIBBON_ART_PAGE_BACKGROUND_COLOUR:
@@ -334,7 +336,8 @@ void wxRibbonAUIArtProvider::DrawTabCtrlBackground(
 {
     wxRect gradient_rect(rect);
     gradient_rect.height--;
-    dc.GradientFillLinear(gradient_rect, m_tab_ctrl_background_colour,
+    m_gradient_cache->GradientFillLinear(dc, gradient_rect,
+        m_tab_ctrl_background_colour,
         m_tab_ctrl_background_gradient_colour, wxSOUTH);
     dc.SetPen(m_tab_border_pen);
     dc.DrawLine(rect.x, rect.GetBottom(), rect.GetRight()+1, rect.GetBottom());
@@ -404,11 +407,13 @@ void wxRibbonAUIArtProvider::DrawTab(wxDC& dc,
             grad_rect.y - tab.rect.y - 3);
         if(tab.highlight)
         {
-            dc.GradientFillLinear(grad_rect, m_tab_highlight_top_colour, m_tab_highlight_top_gradient_colour, wxSOUTH);
+            m_gradient_cache->GradientFillLinear(dc, grad_rect,
+                m_tab_highlight_top_colour, m_tab_highlight_top_gradient_colour, wxSOUTH);
         }
         else
         {
-            dc.GradientFillLinear(grad_rect, m_tab_active_background_colour,
+            m_gradient_cache->GradientFillLinear(dc, grad_rect,
+                m_tab_active_background_colour,
                 m_tab_active_background_gradient_colour, wxSOUTH);
         }
     }
@@ -426,7 +431,8 @@ void wxRibbonAUIArtProvider::DrawTab(wxDC& dc,
         grad_rect.width -= 1;
         grad_rect.y += 3;
         grad_rect.height = btm_rect.y - grad_rect.y;
-        dc.GradientFillLinear(grad_rect, m_tab_hover_background_top_colour,
+        m_gradient_cache->GradientFillLinear(dc, grad_rect,
+            m_tab_hover_background_top_colour,
             m_tab_hover_background_top_gradient_colour, wxSOUTH);
     }
 
@@ -780,7 +786,7 @@ void wxRibbonAUIArtProvider::DrawPanelBackground(
     {
         dc.SetTextForeground(m_panel_label_colour);
     }
-    dc.GradientFillLinear(label_rect,
+    m_gradient_cache->GradientFillLinear(dc, label_rect,
 #ifdef __WXOSX__
         label_bg_grad_colour, label_bg_colour, wxSOUTH);
 #else
@@ -801,7 +807,8 @@ void wxRibbonAUIArtProvider::DrawPanelBackground(
         wxColour colour = m_page_hover_background_colour;
         wxColour gradient = m_page_hover_background_gradient_colour;
 #endif
-        dc.GradientFillLinear(gradient_rect, colour, gradient, wxSOUTH);
+        m_gradient_cache->GradientFillLinear(dc, gradient_rect,
+            colour, gradient, wxSOUTH);
     }
 
     if(wnd->HasExtButton())
@@ -850,7 +857,8 @@ void wxRibbonAUIArtProvider::DrawMinimisedPanel(
             colour = gradient;
             gradient = temp;
         }
-        dc.GradientFillLinear(true_rect, colour, gradient, wxSOUTH);
+        m_gradient_cache->GradientFillLinear(dc, true_rect,
+            colour, gradient, wxSOUTH);
     }
 
     wxRect preview;
@@ -865,17 +873,17 @@ void wxRibbonAUIArtProvider::DrawMinimisedPanel(
     preview.y += preview_caption_rect.height;
     preview.height -= preview_caption_rect.height;
 #ifdef __WXOSX__
-    dc.GradientFillLinear(preview_caption_rect,
+    m_gradient_cache->GradientFillLinear(dc, preview_caption_rect,
         m_panel_hover_label_background_gradient_colour,
         m_panel_hover_label_background_colour, wxSOUTH);
-    dc.GradientFillLinear(preview,
+    m_gradient_cache->GradientFillLinear(dc, preview,
         m_page_hover_background_gradient_colour,
         m_page_hover_background_colour, wxSOUTH);
 #else
-    dc.GradientFillLinear(preview_caption_rect,
+    m_gradient_cache->GradientFillLinear(dc, preview_caption_rect,
         m_panel_hover_label_background_colour,
         m_panel_hover_label_background_gradient_colour, wxSOUTH);
-    dc.GradientFillLinear(preview,
+    m_gradient_cache->GradientFillLinear(dc, preview,
         m_page_hover_background_colour,
         m_page_hover_background_gradient_colour, wxSOUTH);
 #endif
@@ -937,15 +945,12 @@ void wxRibbonAUIArtProvider::DrawPartialPanelBackground(wxDC& dc,
     paint_rect.Intersect(background);
     if(!paint_rect.IsEmpty())
     {
-        wxColour starting_colour(wxRibbonInterpolateColour(bg_clr, bg_grad_clr,
-            paint_rect.y, background.y, background.y + background.height));
-        wxColour ending_colour(wxRibbonInterpolateColour(bg_clr, bg_grad_clr,
-            paint_rect.y + paint_rect.height, background.y,
-            background.y + background.height));
         paint_rect.x -= offset.x;
         paint_rect.y -= offset.y;
-        dc.GradientFillLinear(paint_rect, starting_colour, ending_colour
-            , wxSOUTH);
+        m_gradient_cache->GradientFillPartial(dc, paint_rect,
+            bg_clr, bg_grad_clr,
+            background.y - offset.y,
+            background.y + background.height - offset.y);
     }
 }
 
@@ -1001,7 +1006,7 @@ void wxRibbonAUIArtProvider::DrawGalleryButton(wxDC& dc, wxRect rect,
     switch(state)
     {
     case wxRIBBON_GALLERY_BUTTON_NORMAL:
-        dc.GradientFillLinear(reduced_rect,
+        m_gradient_cache->GradientFillLinear(dc, reduced_rect,
             m_gallery_button_background_colour,
             m_gallery_button_background_gradient_colour, wxSOUTH);
         btn_bitmap = bitmaps[0];
@@ -1168,7 +1173,7 @@ void wxRibbonAUIArtProvider::DrawToolGroupBackground(
     dc.DrawRectangle(rect.x, rect.y, rect.width, rect.height);
     wxRect bg_rect(rect);
     bg_rect.Deflate(1);
-    dc.GradientFillLinear(bg_rect, m_tool_background_colour,
+    m_gradient_cache->GradientFillLinear(dc, bg_rect, m_tool_background_colour,
         m_tool_background_gradient_colour, wxSOUTH);
 }
 
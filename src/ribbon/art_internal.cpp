@@ -20,6 +20,7 @@
 
 #ifndef WX_PRECOMP
 #include "wx/dc.h"
+#include "wx/dcmemory.h"
 #endif
 
 #ifdef __WXMSW__
@@ -115,6 +116,205 @@ wxBitmap wxRibbonLoadPixmap(const char* const* bits, wxColour fore)
     return wxBitmap(xpm);
 }
 
+// ----------------------------------------------------------------------------
+// wxRibbonGradientCache
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Width of the cached gradient strips in the direction perpendicular to the
+// gradient is the width of the widest rectangle filled with them, rounded up
+// to a power of 2 not less than the minimal width, to avoid redrawing them
+// every time this rectangle becomes slightly wider. It is limited by the
+// maximal width to avoid using too much memory, the wider rectangles are
+// filled using several blits.
+const int GRADIENT_MIN_WIDTH = 64;
+const int GRADIENT_MAX_WIDTH = 2048;
+
+// Don't cache the gradients longer than this, they're not used by the ribbon
+// elements anyhow and it's not worth keeping such big bitmaps around.
+const int GRADIENT_MAX_LENGTH = 2048;
+
+// Maximal number of entries in the cache: this is much more than what is
+// needed by any art provider normally, so when it's exceeded, the colours or
+// the DPI must have changed and it's fine to just start from scratch.
+const size_t GRADIENT_MAX_ENTRIES = 256;
+
+inline bool IsVertical(wxDirection direction)
+{
+    return direction == wxNORTH || direction == wxSOUTH;
+}
+
+// Fill the given rectangle by repeating the bitmap in the direction
+// perpendicular to the gradient, offset is the position in the bitmap along
+// the gradient direction corresponding to the start of the rectangle.
+void DrawGradientStrips(wxDC& dc,
+                        const wxRect& rect,
+                        const wxBitmap& bitmap,
+                        bool vertical,
+                        int offset)
+{
+    wxMemoryDC mdc;
+    mdc.SelectObjectAsSource(bitmap);
+
+    const wxSize size = bitmap.GetLogicalSize();
+    if(vertical)
+    {
+        const int right = rect.x + rect.width;
+        for(int x = rect.x; x < right; x += size.x)
+        {
+            dc.Blit(x, rect.y, wxMin(size.x, right - x),
+                    rect.height, &mdc, 0, offset);
+        }
+    }
+    else
+    {
+        const int bottom = rect.y + rect.height;
+        for(int y = rect.y; y < bottom; y += size.y)
+        {
+            dc.Blit(rect.x, y, rect.width,
+                    wxMin(size.y, bottom - y), &mdc, offset, 0);
+        }
+    }
+}
+
+} // anonymous namespace
+
+bool wxRibbonGradientCache::Key::operator<(const Key& other) const
+{
+    if(start_colour != other.start_colour)
+        return start_colour < other.start_colour;
+    if(end_colour != other.end_colour)
+        return end_colour < other.end_colour;
+    if(direction != other.direction)
+        return direction < other.direction;
+    if(length != other.length)
+        return length < other.length;
+    return scale < other.scale;
+}
+
+wxBitmap wxRibbonGradientCache::GetBitmap(wxDC& dc,
+                                          const wxColour& start_colour,
+                                          const wxColour& end_colour,
+                                          wxDirection direction,
+                                          int length,
+                                          int width)
+{
+    if(length <= 0 || length > GRADIENT_MAX_LENGTH || !dc.CanDrawBitmap())
+        return wxBitmap();
+
+    // The strips are blitted in logical coordinates, which only map exactly
+    // to the bitmap pixels when no additional scaling is used.
+    double scale_x, scale_y;
+    dc.GetUserScale(&scale_x, &scale_y);
+    if(scale_x != 1.0 || scale_y != 1.0)
+        return wxBitmap();
+    dc.GetLogicalScale(&scale_x, &scale_y);
+    if(scale_x != 1.0 || scale_y != 1.0)
+        return wxBitmap();
+
+    const double scale = dc.GetContentScaleFactor();
+    const Key key = { start_colour.GetRGBA(), end_colour.GetRGBA(),
+                      direction, length, scale };
+
+    const bool vertical = IsVertical(direction);
+    width = wxMin(width, GRADIENT_MAX_WIDTH);
+
+    std::map<Key, wxBitmap>::const_iterator it = m_bitmaps.find(key);
+    if(it != m_bitmaps.end())
+    {
+        // Reuse the existing bitmap if it's wide enough, otherwise replace it
+        // with a wider one below.
+        const wxSize size = it->second.GetLogicalSize();
+        if((vertical ? size.x : size.y) >= width)
+            return it->second;
+    }
+    else if(m_bitmaps.size() >= GRADIENT_MAX_ENTRIES)
+    {
+        m_bitmaps.clear();
+    }
+
+    int strip_width = GRADIENT_MIN_WIDTH;
+    while(strip_width < width)
+        strip_width *= 2;
+
+    const wxSize size = vertical ? wxSize(strip_width, length)
+                                 : wxSize(length, strip_width);
+
+    wxBitmap bitmap;
+    if(!bitmap.CreateWithLogicalSize(size, scale))
+        return wxBitmap();
+
+    {
+        wxMemoryDC mdc(bitmap);
+        mdc.GradientFillLinear(wxRect(size), start_colour, end_colour,
+                               direction);
+    }
+
+    m_bitmaps[key] = bitmap;
+    return bitmap;
+}
+
+void wxRibbonGradientCache::GradientFillLinear(wxDC& dc,
+                                               const wxRect& rect,
+                                               const wxColour& start_colour,
+                                               const wxColour& end_colour,
+                                               wxDirection direction)
+{
+    if(rect.IsEmpty())
+        return;
+
+    const bool vertical = IsVertical(direction);
+    const wxBitmap bitmap = GetBitmap(dc, start_colour, end_colour, direction,
+                                      vertical ? rect.height : rect.width,
+                                      vertical ? rect.width : rect.height);
+    if(!bitmap.IsOk())
+    {
+        dc.GradientFillLinear(rect, start_colour, end_colour, direction);
+        return;
+    }
+
+    DrawGradientStrips(dc, rect, bitmap, vertical, 0);
+}
+
+void wxRibbonGradientCache::GradientFillPartial(wxDC& dc,
+                                                const wxRect& rect,
+                                                const wxColour& start_colour,
+                                                const wxColour& end_colour,
+                                                int start_position,
+                                                int end_position)
+{
+    // Only fill the part of the rectangle inside the gradient.
+    wxRect fill_rect(rect);
+    if(fill_rect.y < start_position)
+    {
+        fill_rect.height -= start_position - fill_rect.y;
+        fill_rect.y = start_position;
+    }
+    if(fill_rect.y + fill_rect.height > end_position)
+        fill_rect.height = end_position - fill_rect.y;
+    if(fill_rect.IsEmpty())
+        return;
+
+    const wxBitmap bitmap = GetBitmap(dc, start_colour, end_colour, wxSOUTH,
+                                      end_position - start_position,
+                                      fill_rect.width);
+    if(!bitmap.IsOk())
+    {
+        dc.GradientFillLinear(fill_rect,
+            wxRibbonInterpolateColour(start_colour, end_colour,
+                fill_rect.y, start_position, end_position),
+            wxRibbonInterpolateColour(start_colour, end_colour,
+                fill_rect.y + fill_rect.height, start_position, end_position),
+            wxSOUTH);
+        return;
+    }
+
+    DrawGradientStrips(dc, fill_rect, bitmap, true,
+                       fill_rect.y - start_position);
+}
+
 wxRibbonHSLColour::wxRibbonHSLColour(const wxColour& col)
 {
     float red = col.Red() / 255.0f;
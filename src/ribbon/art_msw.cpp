@@ -269,6 +269,7 @@ wxRibbonMSWArtProvider::wxRibbonMSWArtProvider(bool set_colour_scheme)
 #endif
 {
     m_flags = 0;
+    m_gradient_cache = new wxRibbonGradientCache;
     m_button_bar_label_font = m_tab_label_font;
     m_panel_label_font = m_tab_label_font;
 
@@ -299,6 +300,7 @@ wxRibbonMSWArtProvider::wxRibbonMSWArtProvider(bool set_colour_scheme)
 
 wxRibbonMSWArtProvider::~wxRibbonMSWArtProvider()
 {
+    delete m_gradient_cache;
 }
 
 void wxRibbonMSWArtProvider::GetColourScheme(
@@ -489,8 +491,9 @@ void wxRibbonMSWArtProvider::SetColourScheme(
     m_tab_highlight_colour = top_colour2;
     m_tab_highlight_gradient_colour = bottom_colour2;
 
-    // Invalidate cached tab separator
+    // Invalidate cached tab separator and gradients
     m_cached_tab_separator_visibility = -1.0;
+    m_gradient_cache->Clear();
 }
 
 wxRibbonArtProvider* wxRibbonMSWArtProvider::Clone() const
@@ -984,6 +987,9 @@ wxColour wxRibbonMSWArtProvider::GetColour(int id) const
 
 void wxRibbonMSWArtProvider::SetColour(int id, const wxColor& colour)
 {
+    // The gradients using the old colour won't be needed any longer.
+    m_gradient_cache->Clear();
+
     switch(id)
     {
         case wxRIBBON_ART_BUTTON_BAR_LABEL_COLOUR:
@@ -1366,7 +1372,8 @@ void wxRibbonMSWArtProvider::DrawTab(
             background.width -= 4;
             background.height -= 2;
 
-            dc.GradientFillLinear(background, m_tab_active_background_colour,
+            m_gradient_cache->GradientFillLinear(dc, background,
+                m_tab_active_background_colour,
                 m_tab_active_background_gradient_colour, wxSOUTH);
 
             // TODO: active and hovered
@@ -1381,13 +1388,14 @@ void wxRibbonMSWArtProvider::DrawTab(
             background.height -= 3;
             int h = background.height;
             background.height /= 2;
-            dc.GradientFillLinear(background,
+            m_gradient_cache->GradientFillLinear(dc, background,
                 m_tab_hover_background_top_colour,
                 m_tab_hover_background_top_gradient_colour, wxSOUTH);
 
             background.y += background.height;
             background.height = h - background.height;
-            dc.GradientFillLinear(background, m_tab_hover_background_colour,
+            m_gradient_cache->GradientFillLinear(dc, background,
+                m_tab_hover_background_colour,
                 m_tab_hover_background_gradient_colour, wxSOUTH);
         }
         else if(tab.highlight)
@@ -1401,12 +1409,14 @@ void wxRibbonMSWArtProvider::DrawTab(
             int h = background.height;
             background.height /= 2;
 
-            dc.GradientFillLinear(background, m_tab_highlight_top_colour, m_tab_highlight_top_gradient_colour, wxSOUTH);
+            m_gradient_cache->GradientFillLinear(dc, background,
+                m_tab_highlight_top_colour, m_tab_highlight_top_gradient_colour, wxSOUTH);
 
             background.y += background.height;
             background.height = h - background.height;
 
-            dc.GradientFillLinear(background, m_tab_highlight_colour, m_tab_highlight_gradient_colour, wxSOUTH);
+            m_gradient_cache->GradientFillLinear(dc, background,
+                m_tab_highlight_colour, m_tab_highlight_gradient_colour, wxSOUTH);
         }
 
         wxPoint border_points[6];
@@ -1627,12 +1637,9 @@ void wxRibbonMSWArtProvider::DrawPartialPageBackground(wxDC& dc,
         rect.Intersect(paint_rect);
         rect.x -= offset.x;
         rect.y -= offset.y;
-        wxColour starting_colour(wxRibbonInterpolateColour(bg_top, bg_top_grad,
-            paint_rect.y, upper_rect.y, upper_rect.y + upper_rect.height));
-        wxColour ending_colour(wxRibbonInterpolateColour(bg_top, bg_top_grad,
-            paint_rect.y + paint_rect.height, upper_rect.y,
-            upper_rect.y + upper_rect.height));
-        dc.GradientFillLinear(rect, starting_colour, ending_colour, wxSOUTH);
+        m_gradient_cache->GradientFillPartial(dc, rect, bg_top, bg_top_grad,
+            upper_rect.y - offset.y,
+            upper_rect.y + upper_rect.height - offset.y);
     }
 
     if(paint_rect.Intersects(lower_rect))
@@ -1641,12 +1648,9 @@ void wxRibbonMSWArtProvider::DrawPartialPageBackground(wxDC& dc,
         rect.Intersect(paint_rect);
         rect.x -= offset.x;
         rect.y -= offset.y;
-        wxColour starting_colour(wxRibbonInterpolateColour(bg_btm, bg_btm_grad,
-            paint_rect.y, lower_rect.y, lower_rect.y + lower_rect.height));
-        wxColour ending_colour(wxRibbonInterpolateColour(bg_btm, bg_btm_grad,
-            paint_rect.y + paint_rect.height,
-            lower_rect.y, lower_rect.y + lower_rect.height));
-        dc.GradientFillLinear(rect, starting_colour, ending_colour, wxSOUTH);
+        m_gradient_cache->GradientFillPartial(dc, rect, bg_btm, bg_btm_grad,
+            lower_rect.y - offset.y,
+            lower_rect.y + lower_rect.height - offset.y);
     }
 }
 
@@ -1680,12 +1684,14 @@ void wxRibbonMSWArtProvider::DrawPageBackground(
         background.height -= 2;
 
         background.height /= 5;
-        dc.GradientFillLinear(background, m_page_background_top_colour,
+        m_gradient_cache->GradientFillLinear(dc, background,
+            m_page_background_top_colour,
             m_page_background_top_gradient_colour, wxSOUTH);
 
         background.y += background.height;
         background.height = rect.height - 2 - background.height;
-        dc.GradientFillLinear(background, m_page_background_colour,
+        m_gradient_cache->GradientFillLinear(dc, background,
+            m_page_background_colour,
             m_page_background_gradient_colour, wxSOUTH);
     }
 
@@ -1756,12 +1762,14 @@ void wxRibbonMSWArtProvider::DrawScrollButton(
             background.height /= 2;
         else
             background.height /= 5;
-        dc.GradientFillLinear(background, m_page_background_top_colour,
+        m_gradient_cache->GradientFillLinear(dc, background,
+            m_page_background_top_colour,
             m_page_background_top_gradient_colour, wxSOUTH);
 
         background.y += background.height;
         background.height = rect.height - 2 - background.height;
-        dc.GradientFillLinear(background, m_page_background_colour,
+        m_gradient_cache->GradientFillLinear(dc, background,
+            m_page_background_colour,
             m_page_background_gradient_colour, wxSOUTH);
     }
 
@@ -2143,7 +2151,8 @@ void wxRibbonMSWArtProvider::DrawGalleryButton(wxDC& dc,
     wxRect lower(rect);
     lower.height = (lower.height + 1) / 2;
     lower.y += rect.height - lower.height;
-    dc.GradientFillLinear(lower, btn_colour, btn_grad_colour, wxSOUTH);
+    m_gradient_cache->GradientFillLinear(dc, lower,
+        btn_colour, btn_grad_colour, wxSOUTH);
 
     dc.DrawBitmap(btn_bitmap, rect.x + rect.width / 2 - 2, lower.y - 2, true);
 }
@@ -2195,7 +2204,8 @@ void wxRibbonMSWArtProvider::DrawGalleryItemBackground(
     wxRect lower(upper);
     lower.y += lower.height;
     lower.height = rect.height - 2 - lower.height;
-    dc.GradientFillLinear(lower, bg_colour, bg_gradient_colour, wxSOUTH);
+    m_gradient_cache->GradientFillLinear(dc, lower,
+        bg_colour, bg_gradient_colour, wxSOUTH);
 }
 
 void wxRibbonMSWArtProvider::DrawPanelBorder(wxDC& dc, const wxRect& rect,
@@ -2258,13 +2268,13 @@ void wxRibbonMSWArtProvider::DrawMinimisedPanel(
         client_rect.width -= 2;
         client_rect.y++;
         client_rect.height = (rect.y + rect.height / 5) - client_rect.x;
-        dc.GradientFillLinear(client_rect,
+        m_gradient_cache->GradientFillLinear(dc, client_rect,
             m_panel_active_background_top_colour,
             m_panel_active_background_top_gradient_colour, wxSOUTH);
 
         client_rect.y += client_rect.height;
         client_rect.height = (true_rect.y + true_rect.height) - client_rect.y;
-        dc.GradientFillLinear(client_rect,
+        m_gradient_cache->GradientFillLinear(dc, client_rect,
             m_panel_active_background_colour,
             m_panel_active_background_gradient_colour, wxSOUTH);
     }
@@ -2296,13 +2306,13 @@ void wxRibbonMSWArtProvider::DrawMinimisedPanel(
         full_rect.height -= 9;
         if(mid_pos < 0)
         {
-            dc.GradientFillLinear(full_rect,
+            m_gradient_cache->GradientFillLinear(dc, full_rect,
                 m_page_hover_background_colour,
                 m_page_hover_background_gradient_colour, wxSOUTH);
         }
         else
         {
-            dc.GradientFillLinear(full_rect,
+            m_gradient_cache->GradientFillLinear(dc, full_rect,
                 m_page_hover_background_top_colour,
                 m_page_hover_background_top_gradient_colour, wxSOUTH);
         }
@@ -2314,14 +2324,14 @@ void wxRibbonMSWArtProvider::DrawMinimisedPanel(
         top_rect.y += 1;
         top_rect.width -= 2;
         top_rect.height = mid_pos;
-        dc.GradientFillLinear(top_rect,
+        m_gradient_cache->GradientFillLinear(dc, top_rect,
             m_page_hover_background_top_colour,
             m_page_hover_background_top_gradient_colour, wxSOUTH);
 
         wxRect btm_rect(top_rect);
         btm_rect.y = preview.y + mid_pos;
         btm_rect.height = preview.y + preview.height - 7 - btm_rect.y;
-        dc.GradientFillLinear(btm_rect,
+        m_gradient_cache->GradientFillLinear(dc, btm_rect,
             m_page_hover_background_colour,
             m_page_hover_background_gradient_colour, wxSOUTH);
     }
@@ -2554,19 +2564,19 @@ void wxRibbonMSWArtProvider::DrawButtonBarButton(
 
         if(state & wxRIBBON_BUTTONBAR_BUTTON_ACTIVE_MASK)
         {
-            dc.GradientFillLinear(bg_rect_top,
+            m_gradient_cache->GradientFillLinear(dc, bg_rect_top,
                 m_button_bar_active_background_top_colour,
                 m_button_bar_active_background_top_gradient_colour, wxSOUTH);
-            dc.GradientFillLinear(bg_rect,
+            m_gradient_cache->GradientFillLinear(dc, bg_rect,
                 m_button_bar_active_background_colour,
                 m_button_bar_active_background_gradient_colour, wxSOUTH);
         }
         else
         {
-            dc.GradientFillLinear(bg_rect_top,
+            m_gradient_cache->GradientFillLinear(dc, bg_rect_top,
                 m_button_bar_hover_background_top_colour,
                 m_button_bar_hover_background_top_gradient_colour, wxSOUTH);
-            dc.GradientFillLinear(bg_rect,
+            m_gradient_cache->GradientFillLinear(dc, bg_rect,
                 m_button_bar_hover_background_colour,
                 m_button_bar_hover_background_gradient_colour, wxSOUTH);
         }
@@ -2760,8 +2770,10 @@ void wxRibbonMSWArtProvider::DrawTool(
         bg_colour = m_tool_hover_background_colour;
         bg_grad_colour = m_tool_hover_background_gradient_colour;
     }
-    dc.GradientFillLinear(bg_rect_top, bg_top_colour, bg_top_grad_colour, wxSOUTH);
-    dc.GradientFillLinear(bg_rect_btm, bg_colour, bg_grad_colour, wxSOUTH);
+    m_gradient_cache->GradientFillLinear(dc, bg_rect_top,
+        bg_top_colour, bg_top_grad_colour, wxSOUTH);
+    m_gradient_cache->GradientFillLinear(dc, bg_rect_btm,
+        bg_colour, bg_grad_colour, wxSOUTH);
     if(is_split_hybrid)
     {
         wxRect nonrect(bg_rect);
@@ -209,6 +209,27 @@ void wxStackWalker::ProcessFrames(size_t skip)
         OnStackFrame(frames[n]);
 }
 
+void wxStackWalker::ProcessAddresses(void* const* addresses, size_t count)
+{
+    void* addrs[MAX_FRAMES];
+    count = wxMin(count, WXSIZEOF(addrs));
+    if ( !count )
+        return;
+
+    memcpy(addrs, addresses, count*sizeof(void*));
+
+    char** const symbols = backtrace_symbols(addrs, count);
+    if ( !symbols )
+        return;
+
+    wxStackFrame frames[MAX_FRAMES];
+    const int numFrames = InitFrames(frames, count, addrs, symbols);
+    for ( int n = 0; n < numFrames; n++ )
+        OnStackFrame(frames[n]);
+
+    free(symbols);
+}
+
 void wxStackWalker::FreeStack()
 {
     // ms_symbols has been allocated by backtrace_symbols() and it's the responsibility
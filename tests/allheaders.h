@@ -95,6 +95,7 @@
 #include <wx/datstrm.h>
 #include <wx/dcbuffer.h>
 #include <wx/dcclient.h>
+#include <wx/bmpcache.h>
 #include <wx/dcgraph.h>
 #include <wx/dc.h>
 #include <wx/dcmemory.h>
@@ -102,6 +103,7 @@
 #include <wx/dcprint.h>
 #include <wx/dcps.h>
 #include <wx/dcscreen.h>
+#include <wx/dcpdf.h>
 #include <wx/dcsvg.h>
 #include <wx/debug.h>
 #include <wx/debugrpt.h>
@@ -128,6 +130,7 @@
 #include <wx/event.h>
 #include <wx/evtloop.h>
 #include <wx/evtloopsrc.h>
+#include <wx/evtprof.h>
 #include <wx/except.h>
 #include <wx/fdrepdlg.h>
 #include <wx/features.h>
@@ -158,6 +161,7 @@
 #include <wx/fs_mem.h>
 #include <wx/fswatcher.h>
 #include <wx/fs_zip.h>
+#include <wx/future.h>
 #include <wx/gauge.h>
 #include <wx/gbsizer.h>
 #include <wx/gdicmn.h>
@@ -343,6 +347,7 @@
 #include <wx/textwrapper.h>
 #include <wx/tglbtn.h>
 #include <wx/thread.h>
+#include <wx/threadpool.h>
 #include <wx/timectrl.h>
 #include <wx/time.h>
 #include <wx/timer.h>
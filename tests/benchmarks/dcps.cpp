@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/dcps.cpp
+// Purpose:     wxPostScriptDC benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/defs.h"
+
+#if wxUSE_PRINTING_ARCHITECTURE && wxUSE_POSTSCRIPT
+
+#include "wx/bitmap.h"
+#include "wx/dcps.h"
+#include "wx/filefn.h"
+#include "wx/filename.h"
+#include "wx/image.h"
+
+#include "bench.h"
+
+namespace
+{
+
+// Create a photo-like image, i.e. one with smooth gradients and some noise,
+// as this is the most common case of big images in the printed documents.
+const wxBitmap& GetTestBitmap()
+{
+    static wxBitmap s_bitmap;
+    if ( !s_bitmap.IsOk() )
+    {
+        const int w = 1600;
+        const int h = 1200;
+
+        wxImage image(w, h);
+        unsigned char* data = image.GetData();
+        unsigned seed = 1;
+        for ( int y = 0; y < h; y++ )
+        {
+            for ( int x = 0; x < w; x++ )
+            {
+                seed = seed*1103515245 + 12345;
+                const int noise = (seed >> 16) % 8;
+
+                *data++ = static_cast<unsigned char>((x*255/w + noise) & 0xff);
+                *data++ = static_cast<unsigned char>((y*255/h + noise) & 0xff);
+                *data++ = static_cast<unsigned char>(((x + y)*127/(w + h)) & 0xff);
+            }
+        }
+
+        s_bitmap = wxBitmap(image);
+    }
+
+    return s_bitmap;
+}
+
+// Print the number of images given by the numeric parameter (100 by default)
+// using the specified compression.
+bool PrintImages(wxPostScriptImageCompression compression)
+{
+    const wxString filename = wxFileName::CreateTempFileName("bench");
+
+    wxPrintData printData;
+    printData.SetPrintMode(wxPRINT_MODE_FILE);
+    printData.SetFilename(filename);
+
+    const wxBitmap& bitmap = GetTestBitmap();
+    const long count = Bench::GetNumericParameter(100);
+
+    {
+        wxPostScriptDC dc(printData);
+        dc.SetImageCompression(compression);
+        if ( !dc.StartDoc("bench") )
+            return false;
+
+        for ( long n = 0; n < count; n++ )
+        {
+            dc.StartPage();
+            dc.DrawBitmap(bitmap, 0, 0);
+            dc.EndPage();
+        }
+
+        dc.EndDoc();
+    }
+
+    const wxFileOffset size = wxFileName::GetSize(filename).GetValue();
+    wxRemoveFile(filename);
+
+    static bool s_sizeShown[3];
+    if ( !s_sizeShown[compression] )
+    {
+        s_sizeShown[compression] = true;
+        wxPrintf("Output size: %lld bytes\n", static_cast<long long>(size));
+    }
+
+    return size > 0;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(PostScriptImagesHex)
+{
+    return PrintImages(wxPS_IMAGE_COMPRESSION_NONE);
+}
+
+BENCHMARK_FUNC(PostScriptImagesRLE)
+{
+    return PrintImages(wxPS_IMAGE_COMPRESSION_RLE);
+}
+
+BENCHMARK_FUNC(PostScriptImagesFlate)
+{
+    return PrintImages(wxPS_IMAGE_COMPRESSION_FLATE);
+}
+
+#endif // wxUSE_PRINTING_ARCHITECTURE && wxUSE_POSTSCRIPT
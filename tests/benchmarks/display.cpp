@@ -9,6 +9,7 @@
 
 #include "wx/display.h"
 #include "wx/gdicmn.h"
+#include "wx/settings.h"
 
 #include "bench.h"
 
@@ -28,3 +29,31 @@ BENCHMARK_FUNC(DisplayGetGeometry)
 {
     return wxDisplay().GetGeometry().GetSize().x > 0;
 }
+
+BENCHMARK_FUNC(DisplayGetClientArea)
+{
+    return wxDisplay().GetClientArea().GetSize().x > 0;
+}
+
+BENCHMARK_FUNC(ClientDisplayRect)
+{
+    return wxGetClientDisplayRect().GetSize().x > 0;
+}
+
+BENCHMARK_FUNC(SystemSettingsGetMetric)
+{
+    // Use the metrics typically queried when handling mouse events.
+    return wxSystemSettings::GetMetric(wxSYS_DCLICK_X) > 0 &&
+            wxSystemSettings::GetMetric(wxSYS_DRAG_X) > 0 &&
+                wxSystemSettings::GetMetric(wxSYS_DCLICK_MSEC) > 0;
+}
+
+BENCHMARK_FUNC(SystemSettingsGetScreenSize)
+{
+    return wxSystemSettings::GetMetric(wxSYS_SCREEN_X) > 0;
+}
+
+BENCHMARK_FUNC(SystemSettingsGetColour)
+{
+    return wxSystemSettings::GetColour(wxSYS_COLOUR_WINDOW).IsOk();
+}
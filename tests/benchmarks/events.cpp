@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/events.cpp
+// Purpose:     Event dispatching benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/app.h"
+#include "wx/event.h"
+#include "wx/evtprof.h"
+
+#include "bench.h"
+
+#include <memory>
+
+// The numeric parameter of the benchmarks here is the number of the event
+// handlers bound to the handler, e.g. run them with "-p 5" and "-p 500" to see
+// how event dispatching scales with the number of Bind() calls.
+
+namespace
+{
+
+const int NUM_EVENTS = 1000;
+
+class BenchEvent;
+wxDEFINE_EVENT(BenchEventMouse, BenchEvent);
+wxDEFINE_EVENT(BenchEventCommand, BenchEvent);
+wxDEFINE_EVENT(BenchEventOther, BenchEvent);
+
+class BenchEvent : public wxEvent
+{
+public:
+    BenchEvent(wxEventType type, int id = wxID_ANY)
+        : wxEvent(id, type)
+    {
+    }
+
+    virtual wxEvent *Clone() const override { return new BenchEvent(*this); }
+};
+
+// Simulate a frame with a lot of command handlers bound to it, as e.g. for
+// its menu and toolbar items, and a single handler for the frequent events.
+class BenchHandler : public wxEvtHandler
+{
+public:
+    BenchHandler()
+    {
+        const long count = Bench::GetNumericParameter(100);
+        for ( long n = 0; n < count; n++ )
+        {
+            Bind(BenchEventCommand, &BenchHandler::OnCommand, this,
+                 static_cast<int>(n + 1));
+        }
+
+        Bind(BenchEventMouse, &BenchHandler::OnMouse, this);
+    }
+
+    long m_processed = 0;
+
+private:
+    void OnCommand(BenchEvent&) { m_processed++; }
+    void OnMouse(BenchEvent&) { m_processed++; }
+};
+
+// Return the handler used by all the benchmarks, creating it again only if
+// the number of handlers changes.
+BenchHandler& GetBenchHandler()
+{
+    static std::unique_ptr<BenchHandler> s_handler;
+    static long s_count = -1;
+
+    const long count = Bench::GetNumericParameter(100);
+    if ( count != s_count )
+    {
+        s_handler.reset(new BenchHandler);
+        s_count = count;
+    }
+
+    return *s_handler;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(EventDispatchFrequent)
+{
+    // Process the event handled by the handler bound last.
+    BenchHandler& handler = GetBenchHandler();
+
+    BenchEvent event(BenchEventMouse);
+    for ( int n = 0; n < NUM_EVENTS; n++ )
+        handler.ProcessEvent(event);
+
+    return handler.m_processed > 0;
+}
+
+#if wxUSE_EVENT_PROFILER
+
+BENCHMARK_FUNC(EventDispatchProfiled)
+{
+    // Same as EventDispatchFrequent but with the profiler enabled, to check
+    // its overhead.
+    BenchHandler& handler = GetBenchHandler();
+
+    wxEventProfiler::Enable();
+
+    BenchEvent event(BenchEventMouse);
+    for ( int n = 0; n < NUM_EVENTS; n++ )
+        handler.ProcessEvent(event);
+
+    wxEventProfiler::Enable(false);
+
+    return handler.m_processed > 0;
+}
+
+#endif // wxUSE_EVENT_PROFILER
+
+BENCHMARK_FUNC(EventDispatchCommand)
+{
+    // Process the events handled by the handlers bound to specific IDs.
+    BenchHandler& handler = GetBenchHandler();
+    const int count = static_cast<int>(Bench::GetNumericParameter(100));
+
+    for ( int n = 0; n < NUM_EVENTS; n++ )
+    {
+        BenchEvent event(BenchEventCommand, n % count + 1);
+        handler.ProcessEvent(event);
+    }
+
+    return handler.m_processed > 0;
+}
+
+BENCHMARK_FUNC(EventDispatchUnhandled)
+{
+    // Process the events not handled at all, which is the worst case for
+    // the search in the dynamic event table.
+    BenchHandler& handler = GetBenchHandler();
+
+    BenchEvent event(BenchEventOther);
+    for ( int n = 0; n < NUM_EVENTS; n++ )
+        handler.ProcessEvent(event);
+
+    return true;
+}
+
+BENCHMARK_FUNC(EventBindUnbind)
+{
+    // Bind and unbind the handlers while processing the events, which
+    // requires keeping the index of the handlers up to date.
+    BenchHandler& handler = GetBenchHandler();
+
+    const auto onEvent = [](BenchEvent&) { };
+    for ( int n = 0; n < NUM_EVENTS; n++ )
+    {
+        handler.Bind(BenchEventMouse, onEvent, n);
+
+        BenchEvent event(BenchEventMouse, n);
+        handler.ProcessEvent(event);
+
+        handler.Unbind(BenchEventMouse, onEvent, n);
+    }
+
+    return true;
+}
+
+BENCHMARK_FUNC(EventQueueAndProcess)
+{
+    BenchHandler& handler = GetBenchHandler();
+
+    for ( int n = 0; n < NUM_EVENTS; n++ )
+        handler.QueueEvent(new BenchEvent(BenchEventMouse));
+
+    wxTheApp->ProcessPendingEvents();
+
+    return !wxTheApp->HasPendingEvents();
+}
+
+BENCHMARK_FUNC(EventCallAfter)
+{
+    // Queue the calls which allocate an event each, typically reusing the
+    // memory of the previously processed ones.
+    BenchHandler& handler = GetBenchHandler();
+
+    for ( int n = 0; n < NUM_EVENTS; n++ )
+        handler.CallAfter([&handler]() { handler.m_processed++; });
+
+    wxTheApp->ProcessPendingEvents();
+
+    return !wxTheApp->HasPendingEvents();
+}
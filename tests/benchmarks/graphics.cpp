@@ -17,6 +17,12 @@
 #include "wx/rawbmp.h"
 #include "wx/stopwatch.h"
 #include "wx/crt.h"
+#include "wx/filename.h"
+#include "wx/graphics.h"
+
+#if wxUSE_SVG
+    #include "wx/dcsvg.h"
+#endif // wxUSE_SVG
 
 #if wxUSE_GLCANVAS
     #include "wx/glcanvas.h"
@@ -66,6 +72,9 @@ struct GraphicsBenchmarkOptions
         testRectangles =
         testCircles =
         testEllipses =
+        testPolygons =
+        testText =
+        testGradients =
         testTextExtent =
         testMultiLineTextExtent =
         testPartialTextExtents = false;
@@ -76,7 +85,11 @@ struct GraphicsBenchmarkOptions
 
         useDC =
         useGC =
-        useGL = false;
+        useGL =
+        useSVG = false;
+
+        headless =
+        csv = false;
 
         renderer = Default;
     }
@@ -97,6 +110,9 @@ struct GraphicsBenchmarkOptions
          testRectangles,
          testCircles,
          testEllipses,
+         testPolygons,
+         testText,
+         testGradients,
          testTextExtent,
          testMultiLineTextExtent,
          testPartialTextExtents;
@@ -107,7 +123,11 @@ struct GraphicsBenchmarkOptions
 
     bool useDC,
          useGC,
-         useGL;
+         useGL,
+         useSVG;
+
+    bool headless,
+         csv;
 
 #ifdef __WXMSW__
     enum GraphicsRenderer { Default, GDIPlus, Direct2D, Cairo };
@@ -117,51 +137,74 @@ struct GraphicsBenchmarkOptions
     GraphicsRenderer renderer;
 } opts;
 
-class GraphicsBenchmarkFrame : public wxFrame
+// Just change the image in some (quick) way to show that it's really being
+// updated on screen.
+void UpdateRGB(unsigned char* data, int n)
 {
-public:
-    GraphicsBenchmarkFrame()
-        : wxFrame(nullptr, wxID_ANY, "wxWidgets Graphics Benchmark")
+    for ( int y = 0; y < opts.height; ++y )
     {
-        SetClientSize(opts.width, opts.height);
+        memset(data, n % 256, 3*opts.width);
 
-#if wxUSE_GLCANVAS
-        m_glCanvas = nullptr;
-        m_glContext = nullptr;
+        data += 3*opts.width;
+        n++;
+    }
+}
 
-        if ( opts.useGL )
-        {
-            m_glCanvas = new wxGLCanvas(this, wxID_ANY, nullptr,
-                                        wxPoint(0, 0),
-                                        wxSize(opts.width, opts.height));
-            m_glContext = new wxGLContext(m_glCanvas);
-            m_glContext->SetCurrent(*m_glCanvas);
+// Show the name of the benchmark which is about to run, this is only done in
+// the human-readable output mode.
+void StartBenchmark(const wxString& msg)
+{
+    if ( opts.csv )
+        return;
 
-            glViewport(0, 0, opts.width, opts.height);
-            glMatrixMode(GL_PROJECTION);
-            glLoadIdentity();
-            glOrtho(-1, 1, -1, 1, -1, 1);
-            glMatrixMode(GL_MODELVIEW);
-            glLoadIdentity();
+    wxPrintf("Benchmarking %s: ", msg);
+    fflush(stdout);
+}
 
-            InitializeTexture(opts.width, opts.height);
+// Output the results of the benchmark which performed the given number of
+// operations, either in human-readable form or as a CSV line with the DC
+// kind, the operation, the number of operations, the total time in
+// microseconds, the time per operation in nanoseconds and the number of
+// operations per second.
+void ReportResults(const wxString& msg,
+                   const char* what,
+                   const char* unit,
+                   long count,
+                   const wxStopWatch& sw,
+                   bool showFPS = false)
+{
+    const double usec = sw.TimeInMicro().ToDouble();
 
-            m_glCanvas->Connect(
-                wxEVT_PAINT,
-                wxPaintEventHandler(GraphicsBenchmarkFrame::OnGLRender),
-                nullptr,
-                this
-            );
-        }
-        else // Not using OpenGL
-#endif // wxUSE_GLCANVAS
-        {
-            Connect(wxEVT_PAINT,
-                    wxPaintEventHandler(GraphicsBenchmarkFrame::OnPaint));
-        }
+    if ( opts.csv )
+    {
+        wxPrintf("\"%s\",\"%s\",%ld,%.0f,%.1f,%.1f\n",
+                 msg.Strip(wxString::both), what, count, usec,
+                 1000.*usec/count, usec > 0 ? 1e6*count/usec : 0.);
+        return;
+    }
 
-        Connect(wxEVT_SIZE, wxSizeEventHandler(GraphicsBenchmarkFrame::OnSize));
+    const long t = static_cast<long>(usec / 1000);
 
+    if ( showFPS )
+    {
+        wxPrintf("%ld %s done in %ldms = %gus/%s or %ld FPS\n",
+                 count, what, t, usec/count, unit,
+                 (1000*count + t - 1)/(t ? t : 1));
+    }
+    else
+    {
+        wxPrintf("%ld %s done in %ldms = %gus/%s\n",
+                 count, what, t, usec/count, unit);
+    }
+}
+
+// Contains the benchmark functions themselves, which can be used with any DC,
+// whether it's associated with a window or not.
+class GraphicsBenchmarker
+{
+public:
+    GraphicsBenchmarker()
+    {
         m_bitmapARGB.Create(64, 64, 32);
 #if defined(__WXMSW__) || defined(__WXOSX__)
         m_bitmapARGB.UseAlpha(true);
@@ -212,174 +255,9 @@ public:
                 m_renderer = wxGraphicsRenderer::GetDefaultRenderer();
         }
 
-        Show();
-    }
-
-#if wxUSE_GLCANVAS
-    virtual ~GraphicsBenchmarkFrame()
-    {
-        delete m_glContext;
-    }
-#endif // wxUSE_GLCANVAS
-
-private:
-    // Just change the image in some (quick) way to show that it's really being
-    // updated on screen.
-    void UpdateRGB(unsigned char* data, int n)
-    {
-        for ( int y = 0; y < opts.height; ++y )
-        {
-            memset(data, n % 256, 3*opts.width);
-
-            data += 3*opts.width;
-            n++;
-        }
-    }
-
-#if wxUSE_GLCANVAS
-    void OnGLRender(wxPaintEvent& WXUNUSED(event))
-    {
-        m_glContext->SetCurrent(*m_glCanvas);
-        glEnable(GL_TEXTURE_2D);
-
-        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        wxPrintf("Benchmarking %s: ", "OpenGL images");
-        fflush(stdout);
-
-        wxStopWatch sw;
-        for ( int n = 0; n < opts.numIters; n++ )
-        {
-            UpdateRGB(g_image.GetData(), n);
-
-            glTexSubImage2D(GL_TEXTURE_2D, 0,
-                            0, 0, opts.width, opts.height,
-                            GL_RGB, GL_UNSIGNED_BYTE, g_image.GetData());
-            glBegin(GL_QUADS);
-                glTexCoord2f(0, 0);
-                glVertex2f(-1.0, -1.0);
-
-                glTexCoord2f(0, 1);
-                glVertex2f(-1.0, 1.0);
-
-                glTexCoord2f(1, 1);
-                glVertex2f(1.0, 1.0);
-
-                glTexCoord2f(1, 0);
-                glVertex2f(1.0, -1.0);
-            glEnd();
-
-            m_glCanvas->SwapBuffers();
-        }
-
-        const long t = sw.Time();
-
-        wxPrintf("%ld images done in %ldms = %gus/image or %ld FPS\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters,
-                 (1000*opts.numIters + t - 1)/t);
-
-        wxTheApp->ExitMainLoop();
     }
-#endif // wxUSE_GLCANVAS
-
-    void OnPaint(wxPaintEvent& WXUNUSED(event))
-    {
-        if ( opts.usePaint )
-        {
-            {
-                wxPaintDC dc(this);
-                wxGCDC gcdc;
-                if ( m_renderer )
-                {
-                    wxGraphicsContext* gc = m_renderer->CreateContext(dc);
-                    gcdc.SetGraphicsContext(gc);
-                }
-                BenchmarkDCAndGC("paint", dc, gcdc);
-            }
-            // Since some renderers use back buffers and hence
-            // drawing results are not displayed when the test
-            // is running then wait a second after graphics
-            // contents is commited to DC to present the output.
-            wxSleep(1);
-        }
-
-        if ( opts.useClient )
-        {
-            {
-                wxClientDC dc(this);
-                wxGCDC gcdc;
-                if ( m_renderer )
-                {
-                    wxGraphicsContext* gc = m_renderer->CreateContext(dc);
-                    gcdc.SetGraphicsContext(gc);
-                }
-                BenchmarkDCAndGC("client", dc, gcdc);
-            }
-            // Since some renderers use back buffers and hence
-            // drawing results are not displayed when the test
-            // is running then wait a second after graphics
-            // contents is commited to DC to present the output.
-            wxSleep(1);
-        }
-
-        if ( opts.useMemory )
-        {
-            {
-                wxBitmap bmp(opts.width, opts.height);
-                wxMemoryDC dc(bmp);
-                wxGCDC gcdc;
-                if ( m_renderer )
-                {
-                    wxGraphicsContext* gc = m_renderer->CreateContext(dc);
-                    gcdc.SetGraphicsContext(gc);
-                }
-                BenchmarkDCAndGC("default memory", dc, gcdc);
-            }
-            {
-                wxBitmap bmp(opts.width, opts.height, 24);
-                wxMemoryDC dc(bmp);
-                wxGCDC gcdc;
-                if ( m_renderer )
-                {
-                    wxGraphicsContext* gc = m_renderer->CreateContext(dc);
-                    gcdc.SetGraphicsContext(gc);
-                }
-                BenchmarkDCAndGC("RGB memory", dc, gcdc);
-            }
-            {
-#if defined(__WXMSW__) || defined(__WXOSX__)
-                wxBitmap bmp(opts.width, opts.height, 32);
-                bmp.UseAlpha(false);
-                wxMemoryDC dc(bmp);
-                wxGCDC gcdc;
-                if ( m_renderer )
-                {
-                    wxGraphicsContext* gc = m_renderer->CreateContext(dc);
-                    gcdc.SetGraphicsContext(gc);
-                }
-                BenchmarkDCAndGC("0RGB memory", dc, gcdc);
-#endif // __WXMSW__ ||__WXOSX__
-            }
-            {
-                wxBitmap bmp(opts.width, opts.height, 32);
-#if defined(__WXMSW__) || defined(__WXOSX__)
-                bmp.UseAlpha(true);
-#endif // __WXMSW__ || __WXOSX__
-                wxMemoryDC dc(bmp);
-                wxGCDC gcdc;
-                if ( m_renderer )
-                {
-                    wxGraphicsContext* gc = m_renderer->CreateContext(dc);
-                    gcdc.SetGraphicsContext(gc);
-                }
-                BenchmarkDCAndGC("ARGB memory", dc, gcdc);
-            }
 
-        }
-
-        wxTheApp->ExitMainLoop();
-    }
+    wxGraphicsRenderer* GetRenderer() const { return m_renderer; }
 
     void BenchmarkDCAndGC(const char* dckind, wxDC& dc, wxGCDC& gcdc)
     {
@@ -404,10 +282,61 @@ private:
         BenchmarkRoundedRectangles(msg, dc);
         BenchmarkCircles(msg, dc);
         BenchmarkEllipses(msg, dc);
+        BenchmarkPolygons(msg, dc);
+        BenchmarkText(msg, dc);
+        BenchmarkGradients(msg, dc);
         BenchmarkTextExtent(msg, dc);
         BenchmarkPartialTextExtents(msg, dc);
     }
 
+    // Run the benchmarks using only the DCs not requiring any windows.
+    void BenchmarkHeadless()
+    {
+        if ( opts.useDC )
+        {
+            wxBitmap bmp(opts.width, opts.height);
+            wxMemoryDC dc(bmp);
+            BenchmarkAll("memory DC", dc);
+        }
+
+        if ( opts.useGC && m_renderer )
+        {
+            wxBitmap bmp(opts.width, opts.height);
+            wxMemoryDC dc(bmp);
+            wxGCDC gcdc(m_renderer->CreateContext(dc));
+            BenchmarkAll(wxString::Format("memory GC (%s)", m_renderer->GetName()),
+                         gcdc);
+        }
+
+#if wxUSE_CAIRO
+        if ( opts.useGC )
+        {
+            wxGraphicsRenderer* const renderer = wxGraphicsRenderer::GetCairoRenderer();
+            if ( renderer )
+            {
+                wxImage image(opts.width, opts.height);
+                {
+                    wxGCDC gcdc(renderer->CreateContextFromImage(image));
+                    BenchmarkAll("image GC (cairo)", gcdc);
+                }
+            }
+        }
+#endif // wxUSE_CAIRO
+
+#if wxUSE_SVG
+        if ( opts.useSVG )
+        {
+            const wxString filename = wxFileName::CreateTempFileName("bench");
+            {
+                wxSVGFileDC dc(filename, opts.width, opts.height);
+                BenchmarkAll("SVG DC", dc);
+            }
+            wxRemoveFile(filename);
+        }
+#endif // wxUSE_SVG
+    }
+
+private:
     void SetupDC(wxDC& dc)
     {
         if ( opts.mapMode != 0 )
@@ -444,8 +373,7 @@ private:
 
         SetupDC(dc);
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         wxStopWatch sw;
         int x0 = 0,
@@ -461,14 +389,10 @@ private:
             y0 = y1;
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld lines done in %ldms = %gus/line\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters);
+        ReportResults(msg, "lines", "line", opts.numIters, sw);
 
         // Horizontal lines
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         sw.Start();
         x0 = 0;
@@ -482,14 +406,10 @@ private:
             x0 = x1;
         }
 
-        const long t2 = sw.Time();
-
-        wxPrintf("%ld horizontal lines done in %ldms = %gus/line\n",
-            opts.numIters, t2, (1000. * t2) / opts.numIters);
+        ReportResults(msg, "horizontal lines", "line", opts.numIters, sw);
 
         // Vertical lines
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         sw.Start();
         y0 = 0;
@@ -503,14 +423,10 @@ private:
             y0 = y1;
         }
 
-        const long t3 = sw.Time();
-
-        wxPrintf("%ld vertical lines done in %ldms = %gus/line\n",
-            opts.numIters, t3, (1000. * t3) / opts.numIters);
+        ReportResults(msg, "vertical lines", "line", opts.numIters, sw);
 
         // Cross hair
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         sw.Start();
         for ( int n = 0; n < opts.numIters; n++ )
@@ -520,10 +436,7 @@ private:
 
             dc.CrossHair(x0, y0);
         }
-        const long t4 = sw.Time();
-
-        wxPrintf("%ld cross hairs done in %ldms = %gus/line\n",
-            opts.numIters, t4, (1000. * t4) / (2*opts.numIters));
+        ReportResults(msg, "cross hair lines", "line", 2*opts.numIters, sw);
     }
 
 
@@ -536,8 +449,7 @@ private:
 
         dc.SetBrush( *wxRED_BRUSH );
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         wxStopWatch sw;
         for ( int n = 0; n < opts.numIters; n++ )
@@ -548,10 +460,7 @@ private:
             dc.DrawRectangle(x, y, 32, 32);
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld rects done in %ldms = %gus/rect\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters);
+        ReportResults(msg, "rects", "rect", opts.numIters, sw);
     }
 
     void BenchmarkRoundedRectangles(const wxString& msg, wxDC& dc)
@@ -563,8 +472,7 @@ private:
 
         dc.SetBrush( *wxCYAN_BRUSH );
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         wxStopWatch sw;
         for ( int n = 0; n < opts.numIters; n++ )
@@ -575,10 +483,7 @@ private:
             dc.DrawRoundedRectangle(x, y, 48, 32, 8);
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld rounded rects done in %ldms = %gus/rect\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters);
+        ReportResults(msg, "rounded rects", "rect", opts.numIters, sw);
     }
 
     void BenchmarkCircles(const wxString& msg, wxDC& dc)
@@ -590,8 +495,7 @@ private:
 
         dc.SetBrush( *wxGREEN_BRUSH );
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         wxStopWatch sw;
         for ( long n = 0; n < opts.numIters; n++ )
@@ -602,10 +506,7 @@ private:
             dc.DrawCircle(x, y, 32);
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld circles done in %ldms = %gus/circle\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters);
+        ReportResults(msg, "circles", "circle", opts.numIters, sw);
     }
 
     void BenchmarkEllipses(const wxString& msg, wxDC& dc)
@@ -617,8 +518,7 @@ private:
 
         dc.SetBrush( *wxBLUE_BRUSH );
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         wxStopWatch sw;
         for ( long n = 0; n < opts.numIters; n++ )
@@ -629,10 +529,111 @@ private:
             dc.DrawEllipse(x, y, 48, 32);
         }
 
-        const long t = sw.Time();
+        ReportResults(msg, "ellipses", "ellipse", opts.numIters, sw);
+    }
+
+    void BenchmarkPolygons(const wxString& msg, wxDC& dc)
+    {
+        if ( !opts.testPolygons )
+            return;
+
+        SetupDC(dc);
+
+        dc.SetBrush( *wxYELLOW_BRUSH );
+
+        StartBenchmark(msg);
+
+        // Use a star-like, i.e. self-intersecting, polygon, to test the
+        // filling rule handling too.
+        static const wxPoint star[] =
+        {
+            wxPoint(0, 30), wxPoint(64, 30), wxPoint(12, 64),
+            wxPoint(32, 0), wxPoint(52, 64),
+        };
 
-        wxPrintf("%ld ellipses done in %ldms = %gus/ellipse\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters);
+        wxStopWatch sw;
+        for ( long n = 0; n < opts.numIters; n++ )
+        {
+            int x = rand() % opts.width,
+                y = rand() % opts.height;
+
+            dc.DrawPolygon(WXSIZEOF(star), star, x, y, wxWINDING_RULE);
+        }
+
+        ReportResults(msg, "polygons", "polygon", opts.numIters, sw);
+    }
+
+    void BenchmarkText(const wxString& msg, wxDC& dc)
+    {
+        if ( !opts.testText )
+            return;
+
+        SetupDC(dc);
+
+        dc.SetTextForeground(*wxBLACK);
+
+        StartBenchmark(msg);
+
+        const wxString str("The quick brown fox jumps over the lazy dog");
+
+        wxStopWatch sw;
+        for ( long n = 0; n < opts.numIters; n++ )
+        {
+            int x = rand() % opts.width,
+                y = rand() % opts.height;
+
+            dc.DrawText(str, x, y);
+        }
+
+        ReportResults(msg, "strings", "string", opts.numIters, sw);
+
+        StartBenchmark(msg);
+
+        sw.Start();
+        for ( long n = 0; n < opts.numIters; n++ )
+        {
+            int x = rand() % opts.width,
+                y = rand() % opts.height;
+
+            dc.DrawRotatedText(str, x, y, n % 360);
+        }
+
+        ReportResults(msg, "rotated strings", "string", opts.numIters, sw);
+    }
+
+    void BenchmarkGradients(const wxString& msg, wxDC& dc)
+    {
+        if ( !opts.testGradients )
+            return;
+
+        SetupDC(dc);
+
+        StartBenchmark(msg);
+
+        wxStopWatch sw;
+        for ( long n = 0; n < opts.numIters; n++ )
+        {
+            int x = rand() % opts.width,
+                y = rand() % opts.height;
+
+            dc.GradientFillLinear(wxRect(x, y, 64, 64), *wxRED, *wxBLUE,
+                                  n % 2 ? wxEAST : wxSOUTH);
+        }
+
+        ReportResults(msg, "linear gradients", "gradient", opts.numIters, sw);
+
+        StartBenchmark(msg);
+
+        sw.Start();
+        for ( long n = 0; n < opts.numIters; n++ )
+        {
+            int x = rand() % opts.width,
+                y = rand() % opts.height;
+
+            dc.GradientFillConcentric(wxRect(x, y, 64, 64), *wxWHITE, *wxGREEN);
+        }
+
+        ReportResults(msg, "concentric gradients", "gradient", opts.numIters, sw);
     }
 
     void BenchmarkTextExtent(const wxString& msg, wxDC& dc)
@@ -642,8 +643,7 @@ private:
 
         SetupDC(dc);
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         const wxString str("The quick brown fox jumps over the lazy dog");
         wxSize size;
@@ -657,10 +657,7 @@ private:
                 size += dc.GetTextExtent(str);
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld text extent measures done in %ldms = %gus/call\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters);
+        ReportResults(msg, "text extent measures", "call", opts.numIters, sw);
     }
 
     void BenchmarkPartialTextExtents(const wxString& msg, wxDC& dc)
@@ -670,8 +667,7 @@ private:
 
         SetupDC(dc);
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         const wxString str("The quick brown fox jumps over the lazy dog");
         wxArrayInt widths;
@@ -686,10 +682,7 @@ private:
             }
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld partial text extents measures done in %ldms = %gus/call\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters);
+        ReportResults(msg, "partial text extents measures", "call", opts.numIters, sw);
     }
 
     void BenchmarkBitmaps(const wxString& msg, wxDC& dc)
@@ -699,8 +692,7 @@ private:
 
         SetupDC(dc);
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         wxStopWatch sw;
         for ( int n = 0; n < opts.numIters; n++ )
@@ -711,13 +703,9 @@ private:
             dc.DrawBitmap(m_bitmapARGB, x, y, true);
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld ARGB bitmaps done in %ldms = %gus/bitmap\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters);
+        ReportResults(msg, "ARGB bitmaps", "bitmap", opts.numIters, sw);
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         sw.Start();
         for ( int n = 0; n < opts.numIters; n++ )
@@ -727,13 +715,9 @@ private:
 
             dc.DrawBitmap(m_bitmapRGB, x, y, true);
         }
-        const long t2 = sw.Time();
+        ReportResults(msg, "RGB bitmaps", "bitmap", opts.numIters, sw);
 
-        wxPrintf("%ld RGB bitmaps done in %ldms = %gus/bitmap\n",
-                 opts.numIters, t2, (1000. * t2)/opts.numIters);
-
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         sw.Start();
         for ( int n = 0; n < opts.numIters; n++ )
@@ -743,13 +727,9 @@ private:
 
             dc.DrawBitmap(m_bitmapARGBwithMask, x, y, true);
         }
-        const long t3 = sw.Time();
-
-        wxPrintf("%ld ARGB bitmaps with mask done in %ldms = %gus/bitmap\n",
-            opts.numIters, t3, (1000. * t3) / opts.numIters);
+        ReportResults(msg, "ARGB bitmaps with mask", "bitmap", opts.numIters, sw);
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         sw.Start();
         for ( int n = 0; n < opts.numIters; n++ )
@@ -759,10 +739,7 @@ private:
 
             dc.DrawBitmap(m_bitmapRGBwithMask, x, y, true);
         }
-        const long t4 = sw.Time();
-
-        wxPrintf("%ld RGB bitmaps with mask done in %ldms = %gus/bitmap\n",
-            opts.numIters, t4, (1000. * t4) / opts.numIters);
+        ReportResults(msg, "RGB bitmaps with mask", "bitmap", opts.numIters, sw);
     }
 
     void BenchmarkImages(const wxString& msg, wxDC& dc)
@@ -773,8 +750,7 @@ private:
         if ( opts.mapMode != 0 )
             dc.SetMapMode((wxMappingMode)opts.mapMode);
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         wxImage image(wxSize(opts.width, opts.height), false /* don't clear */);
 
@@ -785,11 +761,7 @@ private:
             dc.DrawBitmap(image, 0, 0);
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld images done in %ldms = %gus/image or %ld FPS\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters,
-                 (1000*opts.numIters + t - 1)/t);
+        ReportResults(msg, "images", "image", opts.numIters, sw, true);
     }
 
     void BenchmarkRawBitmaps(const wxString& msg, wxDC& dc)
@@ -800,8 +772,7 @@ private:
         if ( opts.mapMode != 0 )
             dc.SetMapMode((wxMappingMode)opts.mapMode);
 
-        wxPrintf("Benchmarking %s: ", msg);
-        fflush(stdout);
+        StartBenchmark(msg);
 
         wxBitmap bitmap(opts.width, opts.height, 24);
         wxNativePixelData data(bitmap);
@@ -833,11 +804,7 @@ private:
             dc.DrawBitmap(bitmap, 0, 0);
         }
 
-        const long t = sw.Time();
-
-        wxPrintf("%ld raw bitmaps done in %ldms = %gus/bitmap or %ld FPS\n",
-                 opts.numIters, t, (1000. * t)/opts.numIters,
-                 (1000*opts.numIters + t - 1)/t);
+        ReportResults(msg, "raw bitmaps", "bitmap", opts.numIters, sw, true);
     }
 
 
@@ -845,11 +812,210 @@ private:
     wxBitmap m_bitmapRGB;
     wxBitmap m_bitmapARGBwithMask;
     wxBitmap m_bitmapRGBwithMask;
+    wxGraphicsRenderer* m_renderer;
+};
+
+class GraphicsBenchmarkFrame : public wxFrame
+{
+public:
+    GraphicsBenchmarkFrame()
+        : wxFrame(nullptr, wxID_ANY, "wxWidgets Graphics Benchmark")
+    {
+        SetClientSize(opts.width, opts.height);
+
+#if wxUSE_GLCANVAS
+        m_glCanvas = nullptr;
+        m_glContext = nullptr;
+
+        if ( opts.useGL )
+        {
+            m_glCanvas = new wxGLCanvas(this, wxID_ANY, nullptr,
+                                        wxPoint(0, 0),
+                                        wxSize(opts.width, opts.height));
+            m_glContext = new wxGLContext(m_glCanvas);
+            m_glContext->SetCurrent(*m_glCanvas);
+
+            glViewport(0, 0, opts.width, opts.height);
+            glMatrixMode(GL_PROJECTION);
+            glLoadIdentity();
+            glOrtho(-1, 1, -1, 1, -1, 1);
+            glMatrixMode(GL_MODELVIEW);
+            glLoadIdentity();
+
+            InitializeTexture(opts.width, opts.height);
+
+            m_glCanvas->Connect(
+                wxEVT_PAINT,
+                wxPaintEventHandler(GraphicsBenchmarkFrame::OnGLRender),
+                nullptr,
+                this
+            );
+        }
+        else // Not using OpenGL
+#endif // wxUSE_GLCANVAS
+        {
+            Connect(wxEVT_PAINT,
+                    wxPaintEventHandler(GraphicsBenchmarkFrame::OnPaint));
+        }
+
+        Connect(wxEVT_SIZE, wxSizeEventHandler(GraphicsBenchmarkFrame::OnSize));
+
+        Show();
+    }
+
+#if wxUSE_GLCANVAS
+    virtual ~GraphicsBenchmarkFrame()
+    {
+        delete m_glContext;
+    }
+#endif // wxUSE_GLCANVAS
+
+private:
+#if wxUSE_GLCANVAS
+    void OnGLRender(wxPaintEvent& WXUNUSED(event))
+    {
+        m_glContext->SetCurrent(*m_glCanvas);
+        glEnable(GL_TEXTURE_2D);
+
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        StartBenchmark("OpenGL");
+
+        wxStopWatch sw;
+        for ( int n = 0; n < opts.numIters; n++ )
+        {
+            UpdateRGB(g_image.GetData(), n);
+
+            glTexSubImage2D(GL_TEXTURE_2D, 0,
+                            0, 0, opts.width, opts.height,
+                            GL_RGB, GL_UNSIGNED_BYTE, g_image.GetData());
+            glBegin(GL_QUADS);
+                glTexCoord2f(0, 0);
+                glVertex2f(-1.0, -1.0);
+
+                glTexCoord2f(0, 1);
+                glVertex2f(-1.0, 1.0);
+
+                glTexCoord2f(1, 1);
+                glVertex2f(1.0, 1.0);
+
+                glTexCoord2f(1, 0);
+                glVertex2f(1.0, -1.0);
+            glEnd();
+
+            m_glCanvas->SwapBuffers();
+        }
+
+        ReportResults("OpenGL", "images", "image", opts.numIters, sw, true);
+
+        wxTheApp->ExitMainLoop();
+    }
+#endif // wxUSE_GLCANVAS
+
+    void OnPaint(wxPaintEvent& WXUNUSED(event))
+    {
+        if ( opts.usePaint )
+        {
+            {
+                wxPaintDC dc(this);
+                wxGCDC gcdc;
+                if ( m_benchmarker.GetRenderer() )
+                {
+                    wxGraphicsContext* gc = m_benchmarker.GetRenderer()->CreateContext(dc);
+                    gcdc.SetGraphicsContext(gc);
+                }
+                m_benchmarker.BenchmarkDCAndGC("paint", dc, gcdc);
+            }
+            // Since some renderers use back buffers and hence
+            // drawing results are not displayed when the test
+            // is running then wait a second after graphics
+            // contents is commited to DC to present the output.
+            wxSleep(1);
+        }
+
+        if ( opts.useClient )
+        {
+            {
+                wxClientDC dc(this);
+                wxGCDC gcdc;
+                if ( m_benchmarker.GetRenderer() )
+                {
+                    wxGraphicsContext* gc = m_benchmarker.GetRenderer()->CreateContext(dc);
+                    gcdc.SetGraphicsContext(gc);
+                }
+                m_benchmarker.BenchmarkDCAndGC("client", dc, gcdc);
+            }
+            // Since some renderers use back buffers and hence
+            // drawing results are not displayed when the test
+            // is running then wait a second after graphics
+            // contents is commited to DC to present the output.
+            wxSleep(1);
+        }
+
+        if ( opts.useMemory )
+        {
+            {
+                wxBitmap bmp(opts.width, opts.height);
+                wxMemoryDC dc(bmp);
+                wxGCDC gcdc;
+                if ( m_benchmarker.GetRenderer() )
+                {
+                    wxGraphicsContext* gc = m_benchmarker.GetRenderer()->CreateContext(dc);
+                    gcdc.SetGraphicsContext(gc);
+                }
+                m_benchmarker.BenchmarkDCAndGC("default memory", dc, gcdc);
+            }
+            {
+                wxBitmap bmp(opts.width, opts.height, 24);
+                wxMemoryDC dc(bmp);
+                wxGCDC gcdc;
+                if ( m_benchmarker.GetRenderer() )
+                {
+                    wxGraphicsContext* gc = m_benchmarker.GetRenderer()->CreateContext(dc);
+                    gcdc.SetGraphicsContext(gc);
+                }
+                m_benchmarker.BenchmarkDCAndGC("RGB memory", dc, gcdc);
+            }
+            {
+#if defined(__WXMSW__) || defined(__WXOSX__)
+                wxBitmap bmp(opts.width, opts.height, 32);
+                bmp.UseAlpha(false);
+                wxMemoryDC dc(bmp);
+                wxGCDC gcdc;
+                if ( m_benchmarker.GetRenderer() )
+                {
+                    wxGraphicsContext* gc = m_benchmarker.GetRenderer()->CreateContext(dc);
+                    gcdc.SetGraphicsContext(gc);
+                }
+                m_benchmarker.BenchmarkDCAndGC("0RGB memory", dc, gcdc);
+#endif // __WXMSW__ ||__WXOSX__
+            }
+            {
+                wxBitmap bmp(opts.width, opts.height, 32);
+#if defined(__WXMSW__) || defined(__WXOSX__)
+                bmp.UseAlpha(true);
+#endif // __WXMSW__ || __WXOSX__
+                wxMemoryDC dc(bmp);
+                wxGCDC gcdc;
+                if ( m_benchmarker.GetRenderer() )
+                {
+                    wxGraphicsContext* gc = m_benchmarker.GetRenderer()->CreateContext(dc);
+                    gcdc.SetGraphicsContext(gc);
+                }
+                m_benchmarker.BenchmarkDCAndGC("ARGB memory", dc, gcdc);
+            }
+
+        }
+
+        wxTheApp->ExitMainLoop();
+    }
+
 #if wxUSE_GLCANVAS
     wxGLCanvas* m_glCanvas;
     wxGLContext* m_glContext;
 #endif // wxUSE_GLCANVAS
-    wxGraphicsRenderer* m_renderer;
+    GraphicsBenchmarker m_benchmarker;
 };
 
 class GraphicsBenchmarkApp : public wxApp
@@ -866,6 +1032,9 @@ public:
             { wxCMD_LINE_SWITCH, "",  "rectangles" },
             { wxCMD_LINE_SWITCH, "",  "circles" },
             { wxCMD_LINE_SWITCH, "",  "ellipses" },
+            { wxCMD_LINE_SWITCH, "",  "polygons" },
+            { wxCMD_LINE_SWITCH, "",  "text" },
+            { wxCMD_LINE_SWITCH, "",  "gradients" },
             { wxCMD_LINE_SWITCH, "",  "textextent" },
             { wxCMD_LINE_SWITCH, "",  "multilinetextextent" },
             { wxCMD_LINE_SWITCH, "",  "partialtextextents" },
@@ -877,6 +1046,11 @@ public:
 #if wxUSE_GLCANVAS
             { wxCMD_LINE_SWITCH, "",  "gl" },
 #endif // wxUSE_GLCANVAS
+#if wxUSE_SVG
+            { wxCMD_LINE_SWITCH, "",  "svg" },
+#endif // wxUSE_SVG
+            { wxCMD_LINE_SWITCH, "",  "headless", "don't create any windows, use offscreen DCs only" },
+            { wxCMD_LINE_SWITCH, "",  "csv", "output results in CSV format" },
             { wxCMD_LINE_OPTION, "m", "map-mode", "", wxCMD_LINE_VAL_NUMBER },
             { wxCMD_LINE_OPTION, "p", "pen-width", "", wxCMD_LINE_VAL_NUMBER },
             { wxCMD_LINE_OPTION, "s", "pen-style", "solid | dot | long_dash | short_dash", wxCMD_LINE_VAL_STRING },
@@ -956,12 +1130,17 @@ public:
         opts.testRectangles = parser.Found("rectangles");
         opts.testCircles = parser.Found("circles");
         opts.testEllipses = parser.Found("ellipses");
+        opts.testPolygons = parser.Found("polygons");
+        opts.testText = parser.Found("text");
+        opts.testGradients = parser.Found("gradients");
         opts.testTextExtent = parser.Found("textextent");
         opts.testMultiLineTextExtent = parser.Found("multilinetextextent");
         opts.testPartialTextExtents = parser.Found("partialtextextents");
         if ( !(opts.testBitmaps || opts.testImages || opts.testLines
                     || opts.testRawBitmaps || opts.testRectangles
                     || opts.testCircles || opts.testEllipses
+                    || opts.testPolygons || opts.testText
+                    || opts.testGradients
                     || opts.testTextExtent || opts.testPartialTextExtents) )
         {
             // Do everything by default.
@@ -972,6 +1151,9 @@ public:
             opts.testRectangles =
             opts.testCircles =
             opts.testEllipses =
+            opts.testPolygons =
+            opts.testText =
+            opts.testGradients =
             opts.testTextExtent =
             opts.testPartialTextExtents = true;
         }
@@ -986,12 +1168,28 @@ public:
             opts.useMemory = true;
         }
 
+        opts.headless = parser.Found("headless");
+        opts.csv = parser.Found("csv");
+
         opts.useDC = parser.Found("dc");
         opts.useGC = parser.Found("gc");
+#if wxUSE_SVG
+        opts.useSVG = parser.Found("svg");
+        if ( opts.useSVG && !opts.headless )
+        {
+            wxLogError("SVG DC can be only used in headless mode.");
+            return false;
+        }
+#endif // wxUSE_SVG
 #if wxUSE_GLCANVAS
         opts.useGL = parser.Found("gl");
         if ( opts.useGL )
         {
+            if ( opts.headless )
+            {
+                wxLogError("Can't use OpenGL in headless mode.");
+                return false;
+            }
             if ( opts.useDC || opts.useGC )
             {
                 wxLogError("Can't use both OpenGL and normal graphics.");
@@ -1001,10 +1199,13 @@ public:
         else // Not using OpenGL
 #endif // wxUSE_GLCANVAS
         {
-            if ( !(opts.useDC || opts.useGC) )
+            if ( !(opts.useDC || opts.useGC || opts.useSVG) )
             {
                 opts.useDC =
                 opts.useGC = true;
+#if wxUSE_SVG
+                opts.useSVG = opts.headless;
+#endif // wxUSE_SVG
             }
         }
 
@@ -1049,10 +1250,26 @@ public:
         if ( !wxApp::OnInit() )
             return false;
 
-        new GraphicsBenchmarkFrame;
+        if ( opts.csv )
+            wxPrintf("dc,operation,count,total_us,ns_per_op,ops_per_sec\n");
+
+        // In headless mode the benchmarks are run from OnRun().
+        if ( !opts.headless )
+            new GraphicsBenchmarkFrame;
 
         return true;
     }
+
+    virtual int OnRun()
+    {
+        if ( !opts.headless )
+            return wxApp::OnRun();
+
+        // Just run all the benchmarks without entering the main loop.
+        GraphicsBenchmarker().BenchmarkHeadless();
+
+        return 0;
+    }
 };
 
 wxIMPLEMENT_APP_CONSOLE(GraphicsBenchmarkApp);
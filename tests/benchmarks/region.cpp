@@ -0,0 +1,117 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/region.cpp
+// Purpose:     wxRegion benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/region.h"
+
+#include "bench.h"
+
+// The numeric parameter of all benchmarks here is the number of rectangles
+// in the region, e.g. run them with "-p 10", "-p 1000" and "-p 10000" to see
+// how they scale with the region complexity.
+
+namespace
+{
+
+const int RECT_SIZE = 8;
+
+// Create a region consisting of the given number of separate rectangles
+// arranged in a grid, as e.g. for a region created from a bitmap mask.
+wxRegion CreateGridRegion(long count)
+{
+    const int cols = 100;
+
+    wxRegion region;
+    for ( long n = 0; n < count; n++ )
+    {
+        region.Union(static_cast<int>(n % cols) * 2 * RECT_SIZE,
+                     static_cast<int>(n / cols) * 2 * RECT_SIZE,
+                     RECT_SIZE, RECT_SIZE);
+    }
+
+    return region;
+}
+
+// Return the region used by the containment benchmarks, creating it only once
+// for the given number of rectangles.
+const wxRegion& GetGridRegion()
+{
+    static wxRegion s_region;
+    static long s_count = -1;
+
+    const long count = Bench::GetNumericParameter(100);
+    if ( count != s_count )
+    {
+        s_region = CreateGridRegion(count);
+        s_count = count;
+    }
+
+    return s_region;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(RegionUnionRowByRow)
+{
+    return !CreateGridRegion(Bench::GetNumericParameter(100)).IsEmpty();
+}
+
+BENCHMARK_FUNC(RegionUnionReversed)
+{
+    // Add the rectangles from bottom to top, which always requires merging
+    // the new rectangle with the existing ones.
+    const long count = Bench::GetNumericParameter(100);
+    const int cols = 100;
+
+    wxRegion region;
+    for ( long n = count - 1; n >= 0; n-- )
+    {
+        region.Union(static_cast<int>(n % cols) * 2 * RECT_SIZE,
+                     static_cast<int>(n / cols) * 2 * RECT_SIZE,
+                     RECT_SIZE, RECT_SIZE);
+    }
+
+    return !region.IsEmpty();
+}
+
+BENCHMARK_FUNC(RegionContainsPoint)
+{
+    const wxRegion& region = GetGridRegion();
+    const wxRect box = region.GetBox();
+
+    // Check points both inside and outside of the region rectangles.
+    int inside = 0;
+    for ( int y = box.y; y < box.GetBottom(); y += RECT_SIZE / 2 + 1 )
+    {
+        for ( int x = box.x; x < box.GetRight(); x += RECT_SIZE / 2 + 1 )
+        {
+            if ( region.Contains(x, y) == wxInRegion )
+                inside++;
+        }
+    }
+
+    return inside > 0;
+}
+
+BENCHMARK_FUNC(RegionContainsRect)
+{
+    const wxRegion& region = GetGridRegion();
+    const wxRect box = region.GetBox();
+
+    int found = 0;
+    for ( int y = box.y; y < box.GetBottom(); y += RECT_SIZE )
+    {
+        for ( int x = box.x; x < box.GetRight(); x += RECT_SIZE )
+        {
+            if ( region.Contains(wxRect(x, y, RECT_SIZE, RECT_SIZE)) != wxOutRegion )
+                found++;
+        }
+    }
+
+    return found > 0;
+}
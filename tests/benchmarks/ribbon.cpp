@@ -0,0 +1,66 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/ribbon.cpp
+// Purpose:     wxRibbon art providers benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/defs.h"
+
+#if wxUSE_RIBBON
+
+#include "wx/bitmap.h"
+#include "wx/dcmemory.h"
+#include "wx/ribbon/art_internal.h"
+
+#include "bench.h"
+
+// The numeric parameter of the benchmarks here is the width of the filled
+// rectangle, 2000 by default, which corresponds to a maximized ribbon bar.
+
+namespace
+{
+
+// Height of a typical ribbon page.
+const int FILL_HEIGHT = 90;
+
+// Return the bitmap to draw on, of the size given by the numeric parameter.
+wxBitmap& GetTargetBitmap()
+{
+    static wxBitmap s_bitmap;
+
+    const int width = static_cast<int>(Bench::GetNumericParameter(2000));
+    if ( !s_bitmap.IsOk() || s_bitmap.GetWidth() != width )
+        s_bitmap.Create(width, FILL_HEIGHT);
+
+    return s_bitmap;
+}
+
+const wxColour START_COLOUR(0xe7, 0xef, 0xfa);
+const wxColour END_COLOUR(0xc4, 0xd6, 0xee);
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(RibbonGradientDirect)
+{
+    wxMemoryDC dc(GetTargetBitmap());
+    dc.GradientFillLinear(wxRect(dc.GetSize()), START_COLOUR, END_COLOUR,
+                          wxSOUTH);
+
+    return dc.IsOk();
+}
+
+BENCHMARK_FUNC(RibbonGradientCached)
+{
+    static wxRibbonGradientCache s_cache;
+
+    wxMemoryDC dc(GetTargetBitmap());
+    s_cache.GradientFillLinear(dc, wxRect(dc.GetSize()),
+                               START_COLOUR, END_COLOUR, wxSOUTH);
+
+    return dc.IsOk();
+}
+
+#endif // wxUSE_RIBBON
@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/threadpool.cpp
+// Purpose:     wxThreadPool benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/thread.h"
+#include "wx/threadpool.h"
+
+#include "bench.h"
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// The numeric parameter of the throughput benchmarks here is the number of
+// tasks to execute, e.g. run them with "-p 100" and "-p 10000" to see how
+// the pool compares with creating a thread per task for different loads.
+
+#if wxUSE_THREADS
+
+namespace
+{
+
+// Number of tasks executed one after another by the latency benchmarks.
+const int NUM_ROUND_TRIPS = 100;
+
+class TaskThread : public wxThread
+{
+public:
+    explicit TaskThread(std::atomic<long>& counter)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_counter(counter)
+    {
+    }
+
+    virtual void* Entry() override
+    {
+        m_counter++;
+
+        return nullptr;
+    }
+
+private:
+    std::atomic<long>& m_counter;
+};
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(ThreadPerTask)
+{
+    // Execute the tasks by creating a thread for each of them, which is the
+    // baseline for the pool benchmark below.
+    const long count = Bench::GetNumericParameter(1000);
+
+    std::atomic<long> counter(0);
+    std::vector<std::unique_ptr<TaskThread>> threads;
+    for ( long n = 0; n < count; n++ )
+    {
+        threads.emplace_back(new TaskThread(counter));
+        if ( threads.back()->Run() != wxTHREAD_NO_ERROR )
+            return false;
+    }
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    return counter == count;
+}
+
+BENCHMARK_FUNC(ThreadPoolSubmit)
+{
+    const long count = Bench::GetNumericParameter(1000);
+
+    std::atomic<long> counter(0);
+    std::vector<std::future<void>> results;
+    results.reserve(count);
+    for ( long n = 0; n < count; n++ )
+        results.push_back(wxThreadPool::GetDefault().Submit([&counter]() { counter++; }));
+
+    for ( auto& result : results )
+        result.wait();
+
+    return counter == count;
+}
+
+BENCHMARK_FUNC(ThreadPoolTaskGroup)
+{
+    // Same as above but without the overhead of the futures.
+    const long count = Bench::GetNumericParameter(1000);
+
+    std::atomic<long> counter(0);
+    wxTaskGroup group;
+    for ( long n = 0; n < count; n++ )
+        group.Run([&counter]() { counter++; });
+
+    group.Wait();
+
+    return counter == count;
+}
+
+BENCHMARK_FUNC(ThreadPerTaskLatency)
+{
+    // Execute the tasks one by one, waiting for each of them to complete
+    // before starting the next one.
+    std::atomic<long> counter(0);
+    for ( int n = 0; n < NUM_ROUND_TRIPS; n++ )
+    {
+        TaskThread thread(counter);
+        if ( thread.Run() != wxTHREAD_NO_ERROR )
+            return false;
+
+        thread.Wait();
+    }
+
+    return counter == NUM_ROUND_TRIPS;
+}
+
+BENCHMARK_FUNC(ThreadPoolLatency)
+{
+    std::atomic<long> counter(0);
+    for ( int n = 0; n < NUM_ROUND_TRIPS; n++ )
+        wxThreadPool::GetDefault().Submit([&counter]() { counter++; }).wait();
+
+    return counter == NUM_ROUND_TRIPS;
+}
+
+BENCHMARK_FUNC(ThreadPoolParallelFor)
+{
+    // Do some non-trivial computation for each element.
+    const size_t count = Bench::GetNumericParameter(1000) * 1000;
+
+    std::vector<double> values(count);
+    wxThreadPool::GetDefault().ParallelFor(0, count, 0, [&values](size_t i)
+    {
+        values[i] = std::sqrt(static_cast<double>(i));
+    });
+
+    return values[count - 1] > 0;
+}
+
+#endif // wxUSE_THREADS
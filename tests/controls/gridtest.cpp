@@ -1813,6 +1813,70 @@ TEST_CASE_METHOD(GridTestCase, "Grid::AutoSizeColumn", "[grid]")
     }
 }
 
+TEST_CASE_METHOD(GridTestCase, "Grid::AutoSizeColumnSameAttr", "[grid]")
+{
+    // Table allowing wxGrid to measure all the values of a column at once.
+    class SameAttrTable : public wxGridStringTable
+    {
+    public:
+        SameAttrTable(int rows, int cols) : wxGridStringTable(rows, cols) { }
+
+        virtual bool CanMeasureColUsingSameAttr(int WXUNUSED(col)) const override
+        {
+            return true;
+        }
+    };
+
+    const wxString values[] =
+    {
+        "W",
+        wxString(),
+        "WWWWWWWW",
+        "WWWW\nWWWWWWWWWWWW\nW",
+        wxString(),
+        "iiiiiiiiiiiiiiii",
+    };
+
+    // Use an empty label to make sure the width is determined by the values.
+    m_grid->SetColLabelValue(0, wxString());
+
+    for ( size_t n = 0; n < WXSIZEOF(values); n++ )
+        m_grid->SetCellValue(n, 0, values[n]);
+
+    m_grid->AutoSizeColumn(0);
+    const int widthPerCell = m_grid->GetColSize(0);
+
+    SameAttrTable* const table = new SameAttrTable(m_grid->GetNumberRows(),
+                                                   m_grid->GetNumberCols());
+    m_grid->SetTable(table, true);
+    m_grid->SetColLabelValue(0, wxString());
+
+    for ( size_t n = 0; n < WXSIZEOF(values); n++ )
+        m_grid->SetCellValue(n, 0, values[n]);
+
+    // The width must be the same when all the values are measured together.
+    m_grid->AutoSizeColumn(0);
+    CHECK( m_grid->GetColSize(0) == widthPerCell );
+
+    // And also when using a bigger font for the entire grid.
+    wxFont font = m_grid->GetDefaultCellFont();
+    font.SetFractionalPointSize(2*font.GetFractionalPointSize());
+    font.MakeBold();
+    m_grid->SetDefaultCellFont(font);
+
+    m_grid->AutoSizeColumn(0);
+    const int widthBatched = m_grid->GetColSize(0);
+    CHECK( widthBatched > widthPerCell );
+
+    wxGridCellAttrPtr attr(m_grid->GetOrCreateCellAttr(3, 0));
+    wxGridCellRendererPtr renderer(attr->GetRenderer(m_grid, 3, 0));
+    wxClientDC dc(m_grid->GetGridWindow());
+    CHECK( widthBatched ==
+           renderer->GetBestWidth(*m_grid, *attr, dc, 3, 0,
+                                  m_grid->GetRowHeight(3))
+           + m_grid->FromDIP(10) );
+}
+
 TEST_CASE_METHOD(GridTestCase, "Grid::DrawInvalidCell", "[grid][multicell]")
 {
     // Set up a multicell with inside an overflowing cell.
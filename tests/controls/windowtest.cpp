@@ -25,6 +25,7 @@
 #include "wx/caret.h"
 #include "wx/cshelp.h"
 #include "wx/dcclient.h"
+#include "wx/dcmemory.h"
 #include "wx/tooltip.h"
 #include "wx/wupdlock.h"
 
@@ -518,3 +519,102 @@ TEST_CASE_METHOD(WindowTestCase, "Window::Refresh", "[window]")
     CHECK(isChild2Painted == true);
     CHECK(isChild3Painted == true);
 }
+
+#ifdef __WXGTK3__
+
+TEST_CASE_METHOD(WindowTestCase, "Window::ScrollBackingStore", "[window][scroll]")
+{
+    // The window shows horizontal bands of 10 pixels, alternating between the
+    // two colours, of a virtual document scrolled by the given offset.
+    wxColour colours[] = { *wxRED, *wxBLUE };
+    int offset = 0;
+    bool painted = false;
+    wxRegion updated;
+
+    m_window->SetBackgroundStyle(wxBG_STYLE_PAINT);
+    m_window->SetSize(100, 100);
+    m_window->Bind(wxEVT_PAINT, [&](wxPaintEvent&)
+    {
+        wxPaintDC dc(m_window);
+        dc.SetPen(*wxTRANSPARENT_PEN);
+
+        for ( int y = -(offset % 10); y < 100; y += 10 )
+        {
+            dc.SetBrush(wxBrush(colours[((y + offset) / 10) % 2]));
+            dc.DrawRectangle(0, y, 100, 10);
+        }
+
+        updated.Union(m_window->GetUpdateRegion());
+        painted = true;
+    });
+
+    REQUIRE( m_window->EnableScrollBackingStore() );
+
+    const auto waitForRepaint = [&]()
+    {
+        painted = false;
+        updated.Clear();
+        return WaitFor("repaint", [&]() { return painted; });
+    };
+
+    // Check that the window shows the expected bands.
+    const auto checkPixels = [&]()
+    {
+        if ( !wxClientDC::CanBeUsedForDrawing(m_window) )
+        {
+            WARN("Skipping pixels check as wxClientDC can't be used.");
+            return;
+        }
+
+        wxBitmap bmp(100, 100);
+        {
+            wxMemoryDC dcMem(bmp);
+            wxClientDC dcWin(m_window);
+            dcMem.Blit(0, 0, 100, 100, &dcWin, 0, 0);
+        }
+        const wxImage image = bmp.ConvertToImage();
+
+        for ( int y = 2; y < 100; y += 5 )
+        {
+            INFO("At y=" << y << " with offset " << offset);
+
+            const wxColour& c = colours[((y + offset) / 10) % 2];
+            CHECK( wxColour(image.GetRed(50, y),
+                            image.GetGreen(50, y),
+                            image.GetBlue(50, y)) == c );
+        }
+    };
+
+    m_window->Refresh();
+    REQUIRE( waitForRepaint() );
+    checkPixels();
+
+    // Scrolling only repaints the newly exposed strip.
+    offset += 5;
+    m_window->ScrollWindow(0, -5);
+    REQUIRE( waitForRepaint() );
+    CHECK( updated.GetBox() == wxRect(0, 95, 100, 5) );
+    checkPixels();
+
+    offset += 20;
+    m_window->ScrollWindow(0, -20);
+    REQUIRE( waitForRepaint() );
+    CHECK( updated.GetBox() == wxRect(0, 80, 100, 20) );
+    checkPixels();
+
+    // But refreshing the window still repaints all of it.
+    std::swap(colours[0], colours[1]);
+    m_window->Refresh();
+    REQUIRE( waitForRepaint() );
+    CHECK( updated.GetBox() == wxRect(0, 0, 100, 100) );
+    checkPixels();
+
+    // And so does thawing it.
+    std::swap(colours[0], colours[1]);
+    m_window->Freeze();
+    m_window->Thaw();
+    REQUIRE( waitForRepaint() );
+    checkPixels();
+}
+
+#endif // __WXGTK3__
@@ -14,6 +14,15 @@
 
 
 #include "wx/event.h"
+#include "wx/evtprof.h"
+#include "wx/ffile.h"
+#include "wx/stopwatch.h"
+#include "wx/thread.h"
+
+#include "testfile.h"
+
+#include <memory>
+#include <vector>
 
 // ----------------------------------------------------------------------------
 // test events and their handlers
@@ -23,6 +32,7 @@ const wxEventType LegacyEventType = wxNewEventType();
 
 class MyEvent;
 wxDEFINE_EVENT(MyEventType, MyEvent);
+wxDEFINE_EVENT(MyOtherEventType, MyEvent);
 
 class MyEvent : public wxEvent
 {
@@ -510,6 +520,629 @@ TEST_CASE("Event::UnbindFromHandler", "[event][bind][unbind]")
     handler.ProcessEvent(e);
 }
 
+TEST_CASE("Event::ManyHandlers", "[event][bind]")
+{
+    // Bind enough handlers to use the index of the dynamic event table and
+    // check that the handlers are still called in the correct order.
+    MyHandler handler;
+
+    const auto noop = [](MyEvent&) { };
+    for ( int n = 0; n < 50; n++ )
+        handler.Bind(MyOtherEventType, noop, n);
+
+    wxString log;
+    const auto bindLogger = [&handler, &log](int id, const char* s)
+        {
+            handler.Bind(MyEventType, [&log, s](MyEvent& e)
+                {
+                    log += s;
+                    e.Skip();
+                }, id);
+        };
+
+    bindLogger(wxID_ANY, "a");
+    bindLogger(1, "b");
+    bindLogger(wxID_ANY, "c");
+    bindLogger(2, "x");
+    bindLogger(1, "d");
+
+    const auto onRange = [&log](MyEvent& e)
+        {
+            log += "r";
+            e.Skip();
+        };
+    handler.Bind(MyEventType, onRange, 0, 5);
+
+    MyEvent e;
+    e.SetId(1);
+    handler.ProcessEvent(e);
+    CHECK( log == "rdcba" );
+
+    // Check that unbinding the handlers while processing the event works.
+    log.clear();
+    const auto unbinder = [&handler, &onRange, &noop](MyEvent& event)
+        {
+            handler.Unbind(MyEventType, onRange, 0, 5);
+
+            for ( int n = 0; n < 50; n++ )
+                handler.Unbind(MyOtherEventType, noop, n);
+
+            event.Skip();
+        };
+    handler.Bind(MyEventType, unbinder, 1);
+    bindLogger(1, "e");
+
+    handler.ProcessEvent(e);
+    CHECK( log == "edcba" );
+
+    // And that the remaining handlers still work after pruning the unbound
+    // ones, which happens when processing an unhandled event.
+    MyEvent other;
+    other.SetEventType(MyOtherEventType);
+    handler.ProcessEvent(other);
+
+    log.clear();
+    CHECK( handler.Unbind(MyEventType, unbinder, 1) );
+    handler.ProcessEvent(e);
+    CHECK( log == "edcba" );
+
+    // Check that pruning the table from a nested call while processing an
+    // event doesn't result in skipping or repeating any handlers.
+    const auto filler = [&log](MyEvent& event)
+        {
+            log += "!";
+            event.Skip();
+        };
+    handler.Bind(MyEventType, filler, 1);
+    bindLogger(1, "f");
+
+    const auto pruner = [&handler, &log, &filler](MyEvent& event)
+        {
+            log += "p";
+
+            if ( handler.Unbind(MyEventType, filler, 1) )
+            {
+                MyEvent unhandled;
+                unhandled.SetEventType(MyOtherEventType);
+                unhandled.SetId(100);
+                handler.ProcessEvent(unhandled);
+            }
+
+            event.Skip();
+        };
+    handler.Bind(MyEventType, pruner, 1);
+
+    log.clear();
+    handler.ProcessEvent(e);
+    CHECK( log == "pfedcba" );
+}
+
+TEST_CASE("Event::DeletePendingEvents", "[event][queue]")
+{
+    MyHandler handler;
+
+    int count = 0;
+    handler.Bind(MyEventType, [&count](MyEvent&) { count++; });
+
+    handler.QueueEvent(new MyEvent);
+    handler.QueueEvent(new MyEvent);
+    CHECK( wxTheApp->HasPendingEvents() );
+
+    // The handler must be removed from the application list immediately.
+    handler.DeletePendingEvents();
+    CHECK( !wxTheApp->HasPendingEvents() );
+
+    wxTheApp->ProcessPendingEvents();
+    CHECK( count == 0 );
+
+    // Check that the handler is still processed after deleting its events.
+    handler.QueueEvent(new MyEvent);
+    CHECK( wxTheApp->HasPendingEvents() );
+
+    wxTheApp->ProcessPendingEvents();
+    CHECK( count == 1 );
+    CHECK( !wxTheApp->HasPendingEvents() );
+
+    // Deleting the events of all handlers must work too.
+    MyHandler handler2;
+    handler2.Bind(MyEventType, [&count](MyEvent&) { count++; });
+
+    handler.QueueEvent(new MyEvent);
+    handler2.QueueEvent(new MyEvent);
+    handler.QueueEvent(new MyEvent);
+
+    wxTheApp->DeletePendingEvents();
+    CHECK( !wxTheApp->HasPendingEvents() );
+
+    wxTheApp->ProcessPendingEvents();
+    CHECK( count == 1 );
+}
+
+TEST_CASE("Event::AllocStats", "[event][queue]")
+{
+    // Ensure that the pool contains at least one block of the right size.
+    delete new MyEvent;
+
+    wxEvent::ResetAllocStats();
+
+    MyHandler handler;
+
+    int count = 0;
+    handler.Bind(MyEventType, [&count](MyEvent&) { count++; });
+
+    for ( int n = 0; n < 10; n++ )
+    {
+        handler.QueueEvent(new MyEvent);
+        wxTheApp->ProcessPendingEvents();
+    }
+
+    CHECK( count == 10 );
+
+    const wxEvent::AllocStats stats = wxEvent::GetAllocStats();
+    CHECK( stats.allocations == 10 );
+    CHECK( stats.reused == 10 );
+    CHECK( stats.pooled > 0 );
+
+    wxEvent::ResetAllocStats();
+    CHECK( wxEvent::GetAllocStats().allocations == 0 );
+
+    // Non-throwing new must be usable with the events too.
+    MyEvent* const event = new (std::nothrow) MyEvent;
+    REQUIRE( event );
+    delete event;
+    CHECK( wxEvent::GetAllocStats().allocations == 1 );
+}
+
+#if wxUSE_EVENT_PROFILER
+
+TEST_CASE("Event::Profiler", "[event][profiler]")
+{
+    wxEventProfiler::Reset();
+    wxEventProfiler::Enable();
+    wxEventProfiler::EnableTrace();
+
+    MyHandler handler;
+    handler.Bind(MyEventType, &MyHandler::OnMyEvent, &handler);
+
+    // This handler processes another event while it's being executed.
+    handler.Bind(MyOtherEventType, [&handler](MyEvent&)
+        {
+            MyEvent event;
+            handler.ProcessEvent(event);
+        });
+
+    MyEvent event;
+    handler.ProcessEvent(event);
+
+    event.SetEventType(MyOtherEventType);
+    handler.ProcessEvent(event);
+
+    handler.CallAfter([]() { });
+    wxTheApp->ProcessPendingEvents();
+
+    wxEventProfiler::Enable(false);
+
+    // This one is not counted any more.
+    event.SetEventType(MyEventType);
+    handler.ProcessEvent(event);
+
+    const std::vector<wxEventProfiler::Entry> stats = wxEventProfiler::GetStats();
+    REQUIRE( stats.size() == 3 );
+
+    const wxEventProfiler::Entry* method = nullptr;
+    const wxEventProfiler::Entry* lambda = nullptr;
+    for ( const auto& entry : stats )
+    {
+        CHECK( entry.handlerClass.Contains("MyHandler") );
+
+        if ( entry.eventType == MyEventType )
+            method = &entry;
+        else if ( entry.eventType == MyOtherEventType )
+            lambda = &entry;
+        else
+            CHECK( entry.eventType == wxEVT_ASYNC_METHOD_CALL );
+    }
+
+    REQUIRE( method );
+    CHECK( method->count == 2 );
+    CHECK( method->maxDepth == 2 );
+    CHECK( method->eventClass.Contains("MyEvent") );
+
+    REQUIRE( lambda );
+    CHECK( lambda->count == 1 );
+    CHECK( lambda->maxDepth == 1 );
+    CHECK( lambda->totalTime >= lambda->maxTime );
+
+    CHECK( wxEventProfiler::Dump().Contains("MyHandler") );
+
+    TempFile trace("profiler-trace.json");
+    REQUIRE( wxEventProfiler::ExportChromeTrace(trace.GetName()) );
+
+    wxFFile file(trace.GetName());
+    wxString json;
+    REQUIRE( file.ReadAll(&json) );
+    CHECK( json.StartsWith("{\"traceEvents\":[") );
+    CHECK( json.Contains("\"depth\":2") );
+
+    wxEventProfiler::Reset();
+    CHECK( wxEventProfiler::GetStats().empty() );
+
+    wxEventProfiler::EnableTrace(0);
+}
+
+#if wxUSE_THREADS
+
+namespace
+{
+
+void DoNothingOnMyEvent(MyEvent&)
+{
+}
+
+// Thread processing the given number of events with the profiler enabled.
+class ProfiledThread : public wxThread
+{
+public:
+    explicit ProfiledThread(int count)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_count(count)
+    {
+    }
+
+    virtual void *Entry() override
+    {
+        MyHandler handler;
+        handler.Bind(MyEventType, &DoNothingOnMyEvent);
+
+        MyEvent event;
+        for ( int n = 0; n < m_count; n++ )
+            handler.ProcessEvent(event);
+
+        return nullptr;
+    }
+
+private:
+    const int m_count;
+};
+
+} // anonymous namespace
+
+TEST_CASE("Event::ProfilerThreads", "[event][profiler][thread]")
+{
+    wxEventProfiler::Reset();
+    wxEventProfiler::Enable();
+
+    MyHandler handler;
+    handler.Bind(MyEventType, &DoNothingOnMyEvent);
+
+    MyEvent event;
+    handler.ProcessEvent(event);
+
+    // The statistics of the threads must be merged with those of the main
+    // thread, even after the threads terminate.
+    ProfiledThread thread1(10);
+    ProfiledThread thread2(20);
+    REQUIRE( thread1.Run() == wxTHREAD_NO_ERROR );
+    REQUIRE( thread2.Run() == wxTHREAD_NO_ERROR );
+    thread1.Wait();
+    thread2.Wait();
+
+    wxEventProfiler::Enable(false);
+
+    const std::vector<wxEventProfiler::Entry> stats = wxEventProfiler::GetStats();
+    REQUIRE( stats.size() == 1 );
+    CHECK( stats[0].count == 31 );
+    CHECK( stats[0].maxDepth == 1 );
+
+    wxEventProfiler::Reset();
+    CHECK( wxEventProfiler::GetStats().empty() );
+}
+
+#endif // wxUSE_THREADS
+
+#endif // wxUSE_EVENT_PROFILER
+
+TEST_CASE("Event::QueueCoalesced", "[event][queue]")
+{
+    MyHandler handler;
+
+    wxString log;
+    handler.Bind(wxEVT_THREAD, [&log](wxThreadEvent& event)
+        {
+            log += event.GetString();
+        });
+
+    const auto queue = [&handler](const char* s, wxUIntPtr key)
+        {
+            wxThreadEvent* const event = new wxThreadEvent;
+            event->SetString(s);
+            if ( key )
+                handler.QueueEventCoalesced(event, key);
+            else
+                handler.QueueEvent(event);
+        };
+
+    queue("a", 1);
+    queue("b", 2);
+    queue("c", 0);
+    queue("d", 1);
+    queue("e", 1);
+    queue("f", 2);
+
+    // The coalesced events keep the position of the first event queued with
+    // the same key but use the value of the last one.
+    wxTheApp->ProcessPendingEvents();
+    CHECK( log == "efc" );
+
+    // Once an event is processed, the next one is queued again.
+    log.clear();
+    queue("g", 1);
+    wxTheApp->ProcessPendingEvents();
+    CHECK( log == "g" );
+
+    // Deleting the pending events must work for coalesced ones too.
+    log.clear();
+    queue("h", 1);
+    handler.DeletePendingEvents();
+    queue("i", 1);
+    wxTheApp->ProcessPendingEvents();
+    CHECK( log == "i" );
+
+    int calls = 0,
+        last = 0;
+    for ( int n = 1; n <= 10; n++ )
+    {
+        handler.CallAfterCoalesced(1, [&calls, &last, n]()
+            {
+                calls++;
+                last = n;
+            });
+    }
+
+    wxTheApp->ProcessPendingEvents();
+    CHECK( calls == 1 );
+    CHECK( last == 10 );
+}
+
+TEST_CASE("Event::IdleSubscribers", "[event][idle]")
+{
+    const wxIdleMode modeOld = wxIdleEvent::GetMode();
+    wxIdleEvent::SetMode(wxIDLE_PROCESS_SUBSCRIBED);
+
+    wxEvtHandler handler;
+    CHECK( !handler.IsSubscribedToIdleEvents() );
+    CHECK( !handler.HasIdleEventHandlers() );
+
+    int idleCount = 0;
+    const auto onIdle = [&idleCount](wxIdleEvent& event)
+    {
+        idleCount++;
+        event.Skip();
+    };
+
+    // Binding wxEVT_IDLE handler subscribes to the idle events.
+    handler.Bind(wxEVT_IDLE, onIdle);
+    CHECK( handler.IsSubscribedToIdleEvents() );
+
+    wxTheApp->ProcessIdle();
+    CHECK( idleCount == 1 );
+
+    // Other events don't affect the subscription.
+    handler.Bind(MyEventType, [](wxEvent&) { });
+    handler.Unbind(wxEVT_IDLE, onIdle);
+    CHECK( !handler.IsSubscribedToIdleEvents() );
+
+    wxTheApp->ProcessIdle();
+    CHECK( idleCount == 1 );
+
+    // The handlers using event tables must be subscribed explicitly.
+    g_called.Reset();
+    {
+        MyClassWithEventTable handlerWithTable;
+        CHECK( handlerWithTable.HasIdleEventHandlers() );
+        CHECK( !handlerWithTable.IsSubscribedToIdleEvents() );
+
+        handlerWithTable.SubscribeToIdleEvents();
+        wxTheApp->ProcessIdle();
+        CHECK( g_called.method );
+    }
+
+    // Destroying a subscribed handler unsubscribes it.
+    g_called.Reset();
+    wxTheApp->ProcessIdle();
+    CHECK( !g_called.method );
+
+    // The events are sent to the next handlers in the chain too, but only
+    // once, even if they're subscribed themselves, and the subscribed handler
+    // is used as the event object.
+    wxEvtHandler next;
+    handler.SetNextHandler(&next);
+    next.SetPreviousHandler(&handler);
+
+    wxObject* eventObject = nullptr;
+    next.Bind(wxEVT_IDLE, [&eventObject](wxIdleEvent& event)
+        {
+            eventObject = event.GetEventObject();
+            event.Skip();
+        });
+    handler.Bind(wxEVT_IDLE, onIdle);
+    CHECK( next.IsSubscribedToIdleEvents() );
+
+    idleCount = 0;
+    wxTheApp->ProcessIdle();
+    CHECK( idleCount == 1 );
+    CHECK( eventObject == &handler );
+
+    handler.Unbind(wxEVT_IDLE, onIdle);
+    eventObject = nullptr;
+    wxTheApp->ProcessIdle();
+    CHECK( idleCount == 1 );
+    CHECK( eventObject == &next );
+
+    next.Unlink();
+
+    // The handlers are not used in the other modes.
+    handler.Bind(wxEVT_IDLE, onIdle);
+    wxIdleEvent::SetMode(wxIDLE_PROCESS_ALL);
+    wxTheApp->ProcessIdle();
+    CHECK( idleCount == 1 );
+
+    // And binding the handlers in them doesn't subscribe to idle events.
+    wxEvtHandler other;
+    other.Bind(wxEVT_IDLE, onIdle);
+    CHECK( !other.IsSubscribedToIdleEvents() );
+
+    // So it has to be done explicitly after switching to the subscribed mode.
+    wxIdleEvent::SetMode(wxIDLE_PROCESS_SUBSCRIBED);
+    wxTheApp->ProcessIdle();
+    CHECK( idleCount == 2 );
+
+    other.SubscribeToIdleEvents();
+    wxTheApp->ProcessIdle();
+    CHECK( idleCount == 4 );
+
+    wxIdleEvent::SetMode(modeOld);
+}
+
+#if wxUSE_THREADS
+
+namespace
+{
+
+class SeqEvent;
+wxDEFINE_EVENT(SeqEventType, SeqEvent);
+
+// Event carrying the index of the thread which posted it and its sequence
+// number in this thread.
+class SeqEvent : public wxEvent
+{
+public:
+    SeqEvent(int producer, int seq)
+        : wxEvent(0, SeqEventType),
+          m_producer(producer),
+          m_seq(seq)
+    {
+    }
+
+    int GetProducer() const { return m_producer; }
+    int GetSeq() const { return m_seq; }
+
+    virtual wxEvent *Clone() const override { return new SeqEvent(*this); }
+
+private:
+    const int m_producer;
+    const int m_seq;
+};
+
+class ProducerThread : public wxThread
+{
+public:
+    ProducerThread(wxEvtHandler& handler, int producer, int count)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_handler(handler),
+          m_producer(producer),
+          m_count(count)
+    {
+    }
+
+    virtual void *Entry() override
+    {
+        for ( int n = 0; n < m_count; n++ )
+            m_handler.QueueEvent(new SeqEvent(m_producer, n));
+
+        return nullptr;
+    }
+
+private:
+    wxEvtHandler& m_handler;
+    const int m_producer;
+    const int m_count;
+};
+
+} // anonymous namespace
+
+TEST_CASE("Event::QueueFromThreads", "[event][queue][thread]")
+{
+    const int NUM_PRODUCERS = 8;
+    const int NUM_EVENTS = 20000;
+
+    MyHandler handler;
+
+    // Next expected sequence number for each producer: the events from the
+    // same thread must be processed in the order in which they were queued.
+    std::vector<int> expected(NUM_PRODUCERS, 0);
+    int received = 0;
+    bool ordered = true;
+
+    handler.Bind(SeqEventType, [&](SeqEvent& event)
+        {
+            if ( event.GetSeq() != expected[event.GetProducer()] )
+                ordered = false;
+
+            expected[event.GetProducer()] = event.GetSeq() + 1;
+            received++;
+        });
+
+    std::vector<std::unique_ptr<ProducerThread>> threads;
+    for ( int n = 0; n < NUM_PRODUCERS; n++ )
+    {
+        threads.emplace_back(new ProducerThread(handler, n, NUM_EVENTS));
+        REQUIRE( threads.back()->Run() == wxTHREAD_NO_ERROR );
+    }
+
+    // Process the events while they're being queued to check that consuming
+    // them concurrently works too, but don't hang if some of them are lost.
+    wxStopWatch sw;
+    while ( received < NUM_PRODUCERS*NUM_EVENTS && sw.Time() < 60000 )
+    {
+        if ( wxTheApp->HasPendingEvents() )
+            wxTheApp->ProcessPendingEvents();
+        else
+            wxThread::Yield();
+    }
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    CHECK( ordered );
+    CHECK( received == NUM_PRODUCERS*NUM_EVENTS );
+    CHECK( !wxTheApp->HasPendingEvents() );
+
+    for ( int n = 0; n < NUM_PRODUCERS; n++ )
+        CHECK( expected[n] == NUM_EVENTS );
+}
+
+TEST_CASE("Event::AllocStatsThreads", "[event][queue][thread]")
+{
+    const int NUM_EVENTS = 1000;
+
+    MyHandler handler;
+
+    int received = 0;
+    handler.Bind(SeqEventType, [&received](SeqEvent&) { received++; });
+
+    // The events allocated in another thread and deleted in this one must be
+    // reused when allocating them in another thread again.
+    for ( int round = 0; round < 2; round++ )
+    {
+        wxEvent::ResetAllocStats();
+
+        ProducerThread thread(handler, 0, NUM_EVENTS);
+        REQUIRE( thread.Run() == wxTHREAD_NO_ERROR );
+        thread.Wait();
+
+        wxTheApp->ProcessPendingEvents();
+    }
+
+    CHECK( received == 2*NUM_EVENTS );
+
+    const wxEvent::AllocStats stats = wxEvent::GetAllocStats();
+    CHECK( stats.allocations == NUM_EVENTS );
+    CHECK( stats.reused >= NUM_EVENTS / 2 );
+}
+
+#endif // wxUSE_THREADS
+
 // This is a compilation-time-only test: just check that a class inheriting
 // from wxEvtHandler non-publicly can use Bind() with its method, this used to
 // result in compilation errors.
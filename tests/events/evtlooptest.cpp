@@ -13,8 +13,16 @@
 #include "testprec.h"
 
 
+#include "wx/evtloop.h"
 #include "wx/timer.h"
 
+#include <atomic>
+#include <climits>
+
+#ifdef __UNIX__
+    #include <signal.h>
+#endif
+
 // ----------------------------------------------------------------------------
 // constants
 // ----------------------------------------------------------------------------
@@ -122,3 +130,132 @@ void EvtloopTestCase::TestExit()
     timerRun2.StartOnce(1);
     CPPUNIT_ASSERT_EQUAL( EXIT_CODE_OUTER_LOOP, loopOuter.Run() );
 }
+
+#if wxUSE_THREADS
+
+TEST_CASE("EventLoop::Watchdog", "[evtloop][thread]")
+{
+    // The callback is called from the watchdog thread, so it must not use
+    // any CHECKs, but just record the results to be checked in this thread.
+    // Note that the stack is only accessed after stopping the watchdog.
+    std::atomic<int> stalls(0);
+    std::atomic<long> minElapsed(LONG_MAX);
+    wxString stack;
+    wxEventLoopWatchdog::SetCallback([&](long elapsed, const wxString& s)
+        {
+            if ( elapsed < minElapsed )
+                minElapsed = elapsed;
+
+            stack = s;
+            stalls++;
+        });
+
+    REQUIRE( wxEventLoopWatchdog::Start(100) );
+    CHECK( wxEventLoopWatchdog::IsRunning() );
+
+    SECTION("Stall")
+    {
+        // Don't process any events, the signal used to get the stack could
+        // interrupt the sleep, so don't rely on sleeping for the full time.
+        wxStopWatch sw;
+        while ( !stalls && sw.Time() < 5000 )
+            wxMilliSleep(10);
+
+        wxEventLoopWatchdog::Stop();
+
+        CHECK( stalls == 1 );
+        CHECK( minElapsed >= 100 );
+
+#if defined(__LINUX__) && wxUSE_STACKWALKER
+        INFO("Stack: " << stack);
+        CHECK( stack.Contains("wxMilliSleep") );
+#endif
+    }
+
+    SECTION("Idle")
+    {
+        // Running the event loop, even if it has nothing to do, is not a
+        // stall.
+        wxEventLoop loop;
+        ScheduleLoopExitTimer timerExit(loop, EXIT_CODE_OUTER_LOOP);
+        timerExit.StartOnce(1000);
+        CHECK( loop.Run() == EXIT_CODE_OUTER_LOOP );
+
+        CHECK( stalls == 0 );
+    }
+
+    SECTION("Busy")
+    {
+        // Processing events without ever returning to the event loop is not
+        // a stall either.
+        wxEvtHandler handler;
+        handler.Bind(wxEVT_IDLE, [](wxIdleEvent&) { wxMilliSleep(10); });
+
+        wxStopWatch sw;
+        while ( sw.Time() < 500 )
+        {
+            wxIdleEvent event;
+            handler.ProcessEvent(event);
+        }
+
+        CHECK( stalls == 0 );
+    }
+
+    wxEventLoopWatchdog::Stop();
+    CHECK( !wxEventLoopWatchdog::IsRunning() );
+
+    wxEventLoopWatchdog::SetCallback(wxEventLoopWatchdog::Callback());
+}
+
+#if defined(__LINUX__) && wxUSE_STACKWALKER
+
+namespace
+{
+
+void DummySignalHandler(int)
+{
+}
+
+} // anonymous namespace
+
+TEST_CASE("EventLoop::WatchdogSignal", "[evtloop][thread]")
+{
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = DummySignalHandler;
+    sigemptyset(&sa.sa_mask);
+
+    struct sigaction saOld;
+    REQUIRE( sigaction(SIGUSR1, &sa, &saOld) == 0 );
+
+    std::atomic<int> stalls(0);
+    wxString stack;
+    wxEventLoopWatchdog::SetCallback([&](long, const wxString& s)
+        {
+            stack = s;
+            stalls++;
+        });
+
+    REQUIRE( wxEventLoopWatchdog::Start(100, SIGUSR1) );
+
+    wxStopWatch sw;
+    while ( !stalls && sw.Time() < 5000 )
+        wxMilliSleep(10);
+
+    wxEventLoopWatchdog::Stop();
+    wxEventLoopWatchdog::SetCallback(wxEventLoopWatchdog::Callback());
+
+    CHECK( stalls == 1 );
+
+    INFO("Stack: " << stack);
+    CHECK( stack.Contains("wxMilliSleep") );
+
+    // The original handler must have been restored.
+    struct sigaction saCur;
+    REQUIRE( sigaction(SIGUSR1, &saOld, &saCur) == 0 );
+    CHECK( saCur.sa_handler == DummySignalHandler );
+}
+
+#endif // __LINUX__ && wxUSE_STACKWALKER
+
+#endif // wxUSE_THREADS
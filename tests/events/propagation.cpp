@@ -731,3 +731,47 @@ void EventPropagationTestCase::PropagationLevel()
 }
 
 #endif // wxUSE_UIACTIONSIMULATOR
+
+TEST_CASE("EventPropagation::IdleSubscribed", "[event][idle]")
+{
+    wxIdleEvent::SetMode(wxIDLE_PROCESS_SUBSCRIBED);
+    wxON_BLOCK_EXIT1(wxIdleEvent::SetMode, wxIDLE_PROCESS_ALL);
+
+    std::unique_ptr<wxWindow>
+        win(new wxWindow(wxTheApp->GetTopWindow(), wxID_ANY));
+
+    // Both the window and the handler pushed on it get the event once, with
+    // the window as the event object.
+    int winCount = 0,
+        handlerCount = 0;
+    wxObject* handlerObject = nullptr;
+
+    win->Bind(wxEVT_IDLE, [&winCount](wxIdleEvent& event)
+        {
+            winCount++;
+            event.Skip();
+        });
+
+    wxEvtHandler handler;
+    win->PushEventHandler(&handler);
+    handler.Bind(wxEVT_IDLE, [&handlerCount, &handlerObject](wxIdleEvent& event)
+        {
+            handlerCount++;
+            handlerObject = event.GetEventObject();
+            event.Skip();
+        });
+
+    CHECK( win->IsSubscribedToIdleEvents() );
+
+    wxTheApp->ProcessIdle();
+    CHECK( winCount == 1 );
+    CHECK( handlerCount == 1 );
+    CHECK( handlerObject == win.get() );
+
+    // After popping the handler, it doesn't get the events any more.
+    win->PopEventHandler();
+
+    wxTheApp->ProcessIdle();
+    CHECK( winCount == 2 );
+    CHECK( handlerCount == 1 );
+}
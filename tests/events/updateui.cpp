@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/events/updateui.cpp
+// Purpose:     Test wxUpdateUIEvent generation
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/event.h"
+    #include "wx/window.h"
+#endif // WX_PRECOMP
+
+#include "wx/scopeguard.h"
+
+#include <memory>
+
+// ----------------------------------------------------------------------------
+// helper window counting the update UI events it gets
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+class UpdateUIWindow : public wxWindow
+{
+public:
+    UpdateUIWindow()
+        : wxWindow(wxTheApp->GetTopWindow(), wxID_ANY),
+          m_updates(0)
+    {
+        Bind(wxEVT_UPDATE_UI, &UpdateUIWindow::OnUpdateUI, this);
+    }
+
+    // Return the number of update events received since the last call.
+    int GetAndResetUpdates()
+    {
+        const int updates = m_updates;
+        m_updates = 0;
+        return updates;
+    }
+
+private:
+    void OnUpdateUI(wxUpdateUIEvent& event)
+    {
+        // Don't count the events propagated from the other windows.
+        if ( event.GetEventObject() == this )
+            m_updates++;
+    }
+
+    int m_updates;
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests themselves
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxUpdateUIEvent::Registered", "[event][updateui]")
+{
+    wxUpdateUIEvent::SetMode(wxUPDATE_UI_PROCESS_REGISTERED);
+    wxON_BLOCK_EXIT1(wxUpdateUIEvent::SetMode, wxUPDATE_UI_PROCESS_ALL);
+
+    std::unique_ptr<UpdateUIWindow> registered(new UpdateUIWindow());
+    std::unique_ptr<UpdateUIWindow> other(new UpdateUIWindow());
+
+    // Registering the window requests an update for it.
+    wxUpdateUIEvent::ResetUpdateRequest();
+    registered->RegisterForUpdateUI();
+    CHECK( registered->IsRegisteredForUpdateUI() );
+    CHECK( !other->IsRegisteredForUpdateUI() );
+    CHECK( wxUpdateUIEvent::IsUpdateRequested() );
+
+    SECTION("OnlyRegistered")
+    {
+        wxTheApp->ProcessIdle();
+        CHECK( registered->GetAndResetUpdates() == 1 );
+        CHECK( other->GetAndResetUpdates() == 0 );
+        CHECK( !wxUpdateUIEvent::IsUpdateRequested() );
+    }
+
+    SECTION("RequestUpdate")
+    {
+        wxTheApp->ProcessIdle();
+        registered->GetAndResetUpdates();
+
+        // Without a request, nothing is updated.
+        wxTheApp->ProcessIdle();
+        CHECK( registered->GetAndResetUpdates() == 0 );
+
+        // And several requests result in a single update.
+        wxUpdateUIEvent::RequestUpdate();
+        wxUpdateUIEvent::RequestUpdate();
+        wxTheApp->ProcessIdle();
+        CHECK( registered->GetAndResetUpdates() == 1 );
+        CHECK( other->GetAndResetUpdates() == 0 );
+    }
+
+    SECTION("ModeSwitch")
+    {
+        wxUpdateUIEvent::SetMode(wxUPDATE_UI_PROCESS_ALL);
+        wxTheApp->ProcessIdle();
+        CHECK( registered->GetAndResetUpdates() >= 1 );
+        CHECK( other->GetAndResetUpdates() >= 1 );
+
+        // The pending request is still processed after switching back.
+        wxUpdateUIEvent::SetMode(wxUPDATE_UI_PROCESS_REGISTERED);
+        wxTheApp->ProcessIdle();
+        CHECK( registered->GetAndResetUpdates() == 1 );
+        CHECK( other->GetAndResetUpdates() == 0 );
+
+        wxTheApp->ProcessIdle();
+        CHECK( registered->GetAndResetUpdates() == 0 );
+    }
+
+    SECTION("Unregister")
+    {
+        registered->RegisterForUpdateUI(false);
+        CHECK( !registered->IsRegisteredForUpdateUI() );
+
+        wxTheApp->ProcessIdle();
+        CHECK( registered->GetAndResetUpdates() == 0 );
+    }
+
+    SECTION("Destroy")
+    {
+        std::unique_ptr<UpdateUIWindow> first(new UpdateUIWindow());
+        std::unique_ptr<UpdateUIWindow> last(new UpdateUIWindow());
+        first->RegisterForUpdateUI();
+        last->RegisterForUpdateUI();
+
+        // Destroying the window unregisters it, even when it's done from an
+        // update handler of another window: this must not prevent the other
+        // registered windows from being updated.
+        first->Bind(wxEVT_UPDATE_UI, [&registered](wxUpdateUIEvent& event)
+            {
+                event.Skip();
+                registered.reset();
+            });
+
+        wxTheApp->ProcessIdle();
+        CHECK( !registered );
+        CHECK( first->GetAndResetUpdates() == 1 );
+        CHECK( last->GetAndResetUpdates() == 1 );
+
+        last.reset();
+
+        wxUpdateUIEvent::RequestUpdate();
+        wxTheApp->ProcessIdle();
+        CHECK( first->GetAndResetUpdates() == 1 );
+    }
+}
@@ -27,6 +27,8 @@
 #include "wx/txtstrm.h"
 #include "wx/timer.h"
 
+#include <memory>
+
 #ifdef __UNIX__
     #define COMMAND "echo hi"
     #define COMMAND_STDERR "cat nonexistentfile"
@@ -520,6 +522,50 @@ void ExecTestCase::TestOverlappedSyncExecute()
 #endif // !__WINDOWS__
 }
 
+TEST_CASE("wxExecute::Future", "[exec][future]")
+{
+    wxEventLoop loop;
+
+    // Launch the process from inside the event loop, as wxExecute(ASYNC)
+    // requires it, and exit it from the continuation.
+    //
+    // Note that the continuation could be called after the end of this test
+    // if we time out below, so it must not reference any local variables.
+    struct Result
+    {
+        bool done = false;
+        int exitCode = -1;
+    };
+    const auto result = std::make_shared<Result>();
+    wxTheApp->CallAfter([result]()
+    {
+        wxExecuteAsync(COMMAND_NO_OUTPUT).Then([result](int rc)
+        {
+            result->exitCode = rc;
+            result->done = true;
+
+            if ( wxEventLoopBase* const active = wxEventLoop::GetActive() )
+                active->ScheduleExit();
+        });
+    });
+
+    // Don't wait forever if the process termination is never detected.
+    wxTimer timeout;
+    timeout.Bind(wxEVT_TIMER, [&loop](wxTimerEvent&)
+    {
+        WARN("Exiting loop on timeout");
+        loop.ScheduleExit();
+    });
+    timeout.StartOnce(30000);
+
+    loop.Run();
+
+    timeout.Stop();
+
+    REQUIRE( result->done );
+    CHECK( result->exitCode == 0 );
+}
+
 #ifdef __UNIX__
 
 // This test is disabled by default because it must be run in French locale,
@@ -476,6 +476,34 @@ TEST_CASE("wxFont::NativeFontInfoUserDesc", "[font][fontinfo]")
     }
 }
 
+#ifdef __WXGTK__
+
+TEST_CASE("wxFont::SharedData", "[font]")
+{
+    // Fonts with the same attributes share their data in wxGTK.
+    const wxFont font1(wxFontInfo(11).FaceName("Sans"));
+    const wxFont font2(wxFontInfo(11).FaceName("Sans"));
+    CHECK( font1.GetRefData() == font2.GetRefData() );
+
+    const wxFont bold1 = font1.Bold();
+    const wxFont bold2 = font2.Bold();
+    CHECK( bold1.GetRefData() == bold2.GetRefData() );
+    CHECK( bold1.GetRefData() != font1.GetRefData() );
+
+    // But modifying one of them must not affect the other one.
+    wxFont font3(font1);
+    font3.SetUnderlined(true);
+    CHECK( font3.GetUnderlined() );
+    CHECK( !font1.GetUnderlined() );
+    CHECK( !font2.GetUnderlined() );
+
+    // And modifying it back makes it use the same data again.
+    font3.SetUnderlined(false);
+    CHECK( font3.GetRefData() == font1.GetRefData() );
+}
+
+#endif // __WXGTK__
+
 TEST_CASE("wxFontList::FindOrCreate", "[font][fontinfo][fontlist]")
 {
     const double pointSize = 10.5;
@@ -500,3 +528,31 @@ TEST_CASE("wxFontList::FindOrCreate", "[font][fontinfo][fontlist]")
     wxFont* const font2 = wxTheFontList->FindOrCreateFont(info);
     CHECK(font2 == font1);
 }
+
+TEST_CASE("wxFontList::SetMaxCount", "[font][fontinfo][fontlist]")
+{
+    wxFontList list;
+    list.SetMaxCount(2);
+
+    wxFont* const font10 = list.FindOrCreateFont(wxFontInfo(10));
+    REQUIRE(font10);
+    wxFont* const font11 = list.FindOrCreateFont(wxFontInfo(11));
+    REQUIRE(font11);
+    CHECK( list.GetCount() == 2 );
+
+    // Using the first font makes it the most recently used one, so it's the
+    // second one which gets deleted when a new font is created.
+    CHECK( list.FindOrCreateFont(wxFontInfo(10)) == font10 );
+    REQUIRE( list.FindOrCreateFont(wxFontInfo(12)) );
+    CHECK( list.GetCount() == 2 );
+    CHECK( list.FindOrCreateFont(wxFontInfo(10)) == font10 );
+
+    list.SetMaxCount(1);
+    CHECK( list.GetCount() == 1 );
+    CHECK( list.FindOrCreateFont(wxFontInfo(10)) == font10 );
+
+    list.SetMaxCount(0);
+    list.FindOrCreateFont(wxFontInfo(11));
+    list.FindOrCreateFont(wxFontInfo(12));
+    CHECK( list.GetCount() == 3 );
+}
@@ -134,3 +134,100 @@ void RegionTestCase::Intersect()
     CPPUNIT_ASSERT( region1.Intersect(region2) );
     CPPUNIT_ASSERT( region1.IsEmpty() );
 }
+
+TEST_CASE("wxRegion::Banded", "[region]")
+{
+    SECTION("Columns")
+    {
+        // Add the rectangles row by row, as when creating a region from a
+        // mask: the rows should be merged into just two columns.
+        wxRegion r;
+        for ( int y = 0; y < 10; y++ )
+        {
+            r.Union(0, y, 5, 1);
+            r.Union(10, y, 5, 1);
+        }
+
+        wxRegion expected(0, 0, 5, 10);
+        expected.Union(10, 0, 5, 10);
+        CHECK( r == expected );
+        CHECK( r.GetBox() == wxRect(0, 0, 15, 10) );
+
+        CHECK( r.Contains(4, 9) == wxInRegion );
+        CHECK( r.Contains(5, 0) == wxOutRegion );
+        CHECK( r.Contains(10, 0) == wxInRegion );
+        CHECK( r.Contains(10, 10) == wxOutRegion );
+    }
+
+    SECTION("Adjacent")
+    {
+        // Adjacent rectangles in the same row must be merged too, and the
+        // resulting row coalesced with the identical one above it.
+        wxRegion r(0, 0, 10, 1);
+        r.Union(0, 1, 10, 1);
+        r.Union(0, 2, 5, 1);
+        r.Union(5, 2, 5, 1);
+
+        CHECK( r == wxRegion(0, 0, 10, 3) );
+    }
+
+    SECTION("Gaps")
+    {
+        // Rows separated by an empty one must not be merged.
+        wxRegion r(0, 0, 10, 1);
+        r.Union(0, 2, 10, 1);
+
+        CHECK( r.Contains(5, 0) == wxInRegion );
+        CHECK( r.Contains(5, 1) == wxOutRegion );
+        CHECK( r.Contains(5, 2) == wxInRegion );
+        CHECK( r.Contains(wxRect(0, 0, 10, 3)) == wxPartRegion );
+    }
+}
+
+TEST_CASE("wxRegion::ContainsBandEdges", "[region]")
+{
+    // Staircase region consisting of two bands.
+    wxRegion r(0, 0, 10, 10);
+    r.Union(5, 10, 10, 10);
+
+    CHECK( r.Contains(9, 9) == wxInRegion );
+    CHECK( r.Contains(10, 5) == wxOutRegion );
+    CHECK( r.Contains(0, 10) == wxOutRegion );
+    CHECK( r.Contains(5, 10) == wxInRegion );
+    CHECK( r.Contains(14, 19) == wxInRegion );
+    CHECK( r.Contains(15, 19) == wxOutRegion );
+    CHECK( r.Contains(5, 20) == wxOutRegion );
+
+    // Rectangles spanning both bands.
+    CHECK( r.Contains(wxRect(5, 5, 5, 10)) == wxInRegion );
+    CHECK( r.Contains(wxRect(0, 5, 10, 10)) == wxPartRegion );
+    CHECK( r.Contains(wxRect(5, 5, 10, 10)) == wxPartRegion );
+
+    // Rectangles touching the bands edges from outside.
+    CHECK( r.Contains(wxRect(10, 0, 5, 10)) == wxOutRegion );
+    CHECK( r.Contains(wxRect(0, 10, 5, 10)) == wxOutRegion );
+    CHECK( r.Contains(wxRect(0, 20, 20, 5)) == wxOutRegion );
+
+    // And from inside.
+    CHECK( r.Contains(wxRect(0, 0, 10, 10)) == wxInRegion );
+    CHECK( r.Contains(wxRect(5, 10, 10, 10)) == wxInRegion );
+}
+
+TEST_CASE("wxRegion::ContainsPartialOverlap", "[region]")
+{
+    // Square with a hole in the middle.
+    wxRegion r(0, 0, 30, 30);
+    r.Subtract(wxRect(10, 10, 10, 10));
+
+    CHECK( r.Contains(15, 15) == wxOutRegion );
+    CHECK( r.Contains(9, 15) == wxInRegion );
+    CHECK( r.Contains(20, 15) == wxInRegion );
+
+    CHECK( r.Contains(wxRect(10, 10, 10, 10)) == wxOutRegion );
+    CHECK( r.Contains(wxRect(5, 5, 10, 10)) == wxPartRegion );
+    CHECK( r.Contains(wxRect(0, 0, 10, 30)) == wxInRegion );
+    CHECK( r.Contains(wxRect(0, 0, 30, 10)) == wxInRegion );
+    CHECK( r.Contains(wxRect(0, 5, 30, 10)) == wxPartRegion );
+    CHECK( r.Contains(wxRect(25, 0, 10, 10)) == wxPartRegion );
+    CHECK( r.Contains(wxRect(30, 0, 10, 10)) == wxOutRegion );
+}
@@ -36,10 +36,14 @@ private:
     CPPUNIT_TEST_SUITE( AffineTransformTestCase );
         CPPUNIT_TEST( InvertMatrix );
         CPPUNIT_TEST( Concat );
+        CPPUNIT_TEST( TransformPoints );
+        CPPUNIT_TEST( TransformRects );
     CPPUNIT_TEST_SUITE_END();
 
     void InvertMatrix();
     void Concat();
+    void TransformPoints();
+    void TransformRects();
 
     wxDECLARE_NO_COPY_CLASS(AffineTransformTestCase);
 };
@@ -94,6 +98,97 @@ void AffineTransformTestCase::Concat()
     CPPUNIT_ASSERT_DOUBLES_EQUAL( 5.7, p.m_y, delta );
 }
 
+void AffineTransformTestCase::TransformPoints()
+{
+    wxAffineMatrix2D matrix;
+    matrix.Set(wxMatrix2D(0.9, 0.4, -0.4, 0.9), wxPoint2DDouble(3.0, 5.0));
+
+    wxPoint2DDouble points[] =
+    {
+        wxPoint2DDouble(0, 0),
+        wxPoint2DDouble(1, 2),
+        wxPoint2DDouble(-7.5, 3.25),
+    };
+    const size_t count = WXSIZEOF(points);
+
+    wxPoint2DDouble result[count];
+    matrix.TransformPoints(points, result, count);
+
+    for ( size_t n = 0; n < count; n++ )
+    {
+        const wxPoint2DDouble expected = matrix.TransformPoint(points[n]);
+        CPPUNIT_ASSERT_EQUAL( expected.m_x, result[n].m_x );
+        CPPUNIT_ASSERT_EQUAL( expected.m_y, result[n].m_y );
+    }
+
+    // Transforming the points in place must work too.
+    matrix.TransformPoints(points, points, count);
+    for ( size_t n = 0; n < count; n++ )
+    {
+        CPPUNIT_ASSERT_EQUAL( result[n].m_x, points[n].m_x );
+        CPPUNIT_ASSERT_EQUAL( result[n].m_y, points[n].m_y );
+    }
+}
+
+void AffineTransformTestCase::TransformRects()
+{
+    // Rotating by 90 degrees and scaling.
+    wxAffineMatrix2D matrix;
+    matrix.Set(wxMatrix2D(0, 2, -1, 0), wxPoint2DDouble(10, 20));
+
+    wxRect2DDouble rects[] =
+    {
+        wxRect2DDouble(0, 0, 4, 2),
+        wxRect2DDouble(1, -3, 0.5, 6),
+    };
+
+    wxRect2DDouble result[WXSIZEOF(rects)];
+    matrix.TransformRects(rects, result, WXSIZEOF(rects));
+
+    const double delta = 1e-9;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 8, result[0].m_x, delta );
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 20, result[0].m_y, delta );
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 2, result[0].m_width, delta );
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 8, result[0].m_height, delta );
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 7, result[1].m_x, delta );
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 22, result[1].m_y, delta );
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 6, result[1].m_width, delta );
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1, result[1].m_height, delta );
+
+    // For a general transformation, the result must be the bounding box of
+    // the transformed corners.
+    matrix.Set(wxMatrix2D(0.9, 0.4, -0.4, 0.9), wxPoint2DDouble(3.0, 5.0));
+    matrix.TransformRects(rects, result, WXSIZEOF(rects));
+
+    for ( size_t n = 0; n < WXSIZEOF(rects); n++ )
+    {
+        const wxRect2DDouble& r = rects[n];
+        const wxPoint2DDouble corners[] =
+        {
+            matrix.TransformPoint(wxPoint2DDouble(r.GetLeft(), r.GetTop())),
+            matrix.TransformPoint(wxPoint2DDouble(r.GetRight(), r.GetTop())),
+            matrix.TransformPoint(wxPoint2DDouble(r.GetLeft(), r.GetBottom())),
+            matrix.TransformPoint(wxPoint2DDouble(r.GetRight(), r.GetBottom())),
+        };
+
+        double left = corners[0].m_x, right = left,
+               top = corners[0].m_y, bottom = top;
+        for ( const wxPoint2DDouble& p : corners )
+        {
+            left = wxMin(left, p.m_x);
+            right = wxMax(right, p.m_x);
+            top = wxMin(top, p.m_y);
+            bottom = wxMax(bottom, p.m_y);
+        }
+
+        CPPUNIT_ASSERT_DOUBLES_EQUAL( left, result[n].GetLeft(), delta );
+        CPPUNIT_ASSERT_DOUBLES_EQUAL( top, result[n].GetTop(), delta );
+        CPPUNIT_ASSERT_DOUBLES_EQUAL( right, result[n].GetRight(), delta );
+        CPPUNIT_ASSERT_DOUBLES_EQUAL( bottom, result[n].GetBottom(), delta );
+    }
+}
+
 #if wxUSE_DC_TRANSFORM_MATRIX
 // -------------------------------
 //  Transform matrix test classes
@@ -16,9 +16,12 @@
 
 
 #include "wx/bitmap.h"
+#include "wx/bmpcache.h"
 #include "wx/rawbmp.h"
 #include "wx/dcmemory.h"
+#include "wx/dcpdf.h"
 #include "wx/dcsvg.h"
+#include "wx/file.h"
 #if wxUSE_GRAPHICS_CONTEXT
 #include "wx/graphics.h"
 #endif // wxUSE_GRAPHICS_CONTEXT
@@ -1729,6 +1732,59 @@ TEST_CASE("Bitmap::DC", "[bitmap][dc]")
 #endif // wxUSE_SVG
 }
 
+#if wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+
+TEST_CASE("Bitmap::PDFFileDC", "[bitmap][dc][pdfdc]")
+{
+    TempFile pdf("bitmaps.pdf");
+
+    wxBitmap bmp1(wxImage(16, 16));
+    wxImage image2(16, 16);
+    image2.SetRGB(wxRect(0, 0, 8, 8), 255, 0, 0);
+    wxBitmap bmp2(image2);
+
+    {
+        wxPDFFileDC dc(pdf.GetName());
+        REQUIRE( dc.IsOk() );
+
+        dc.StartPage();
+        dc.DrawBitmap(bmp1, 0, 0);
+        dc.DrawBitmap(bmp2, 20, 0);
+        dc.EndPage();
+
+        // A different bitmap with the same contents shouldn't be embedded
+        // in the file again.
+        dc.StartPage();
+        dc.DrawBitmap(wxBitmap(image2), 0, 20);
+        dc.DrawBitmap(bmp1, 0, 0);
+        dc.EndPage();
+
+        dc.EndDoc();
+    }
+
+    wxFile file(pdf.GetName());
+    REQUIRE( file.IsOpened() );
+
+    std::string contents(file.Length(), '\0');
+    REQUIRE( file.Read(&contents[0], contents.size()) == (ssize_t)contents.size() );
+
+    CHECK( contents.compare(0, 5, "%PDF-") == 0 );
+    CHECK( contents.compare(contents.size() - 6, 6, "%%EOF\n") == 0 );
+
+    size_t images = 0;
+    for ( size_t pos = contents.find("/Subtype /Image");
+          pos != std::string::npos;
+          pos = contents.find("/Subtype /Image", pos + 1) )
+    {
+        images++;
+    }
+    CHECK( images == 2 );
+
+    CHECK( contents.find("/Count 2") != std::string::npos );
+}
+
+#endif // wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+
 #if wxUSE_GRAPHICS_CONTEXT
 
 inline void DrawScaledBmp(wxBitmap& bmp, float scale, wxGraphicsRenderer* renderer)
@@ -1864,6 +1920,78 @@ TEST_CASE("Bitmap::ScaleFactor", "[bitmap][dc][scale]")
 #endif
 }
 
+TEST_CASE("Bitmap::ScaledCache", "[bitmap][scale][cache]")
+{
+    wxScaledBitmapCache::Enable();
+    wxScaledBitmapCache::ResetStats();
+
+    wxImage img(8, 8);
+    img.SetRGB(wxRect(0, 0, 4, 4), 255, 0, 0);
+
+    wxBitmap bmp(img);
+    REQUIRE( bmp.GetScaleFactor() == 1 );
+
+    // No rescaling is needed if the scale factor is the same.
+    CHECK( wxScaledBitmapCache::GetScaled(bmp, 1).IsSameAs(bmp) );
+    CHECK( wxScaledBitmapCache::GetStats().misses == 0 );
+
+    const wxBitmap bmp2 = wxScaledBitmapCache::GetScaled(bmp, 2);
+    CHECK( bmp2.GetScaleFactor() == 2 );
+    CHECK( bmp2.GetSize() == wxSize(16, 16) );
+    CHECK( bmp2.ConvertToImage().GetRed(7, 7) == 255 );
+    CHECK( bmp2.ConvertToImage().GetRed(8, 8) == 0 );
+
+    // Getting the same variant again should reuse the existing bitmap.
+    CHECK( wxScaledBitmapCache::GetScaled(bmp, 2).IsSameAs(bmp2) );
+    CHECK( wxScaledBitmapCache::GetScaled(wxBitmap(bmp), 2).IsSameAs(bmp2) );
+
+    wxScaledBitmapCache::Stats stats = wxScaledBitmapCache::GetStats();
+    CHECK( stats.hits == 2 );
+    CHECK( stats.misses == 1 );
+    CHECK( stats.count == 1 );
+
+    // Different quality results in a different variant.
+    wxScaledBitmapCache::GetScaled(bmp, 2, wxIMAGE_QUALITY_HIGH);
+    CHECK( wxScaledBitmapCache::GetStats().count == 2 );
+
+    // The cache must not keep references to the source bitmap.
+    CHECK( bmp.GetRefData()->GetRefCount() == 1 );
+
+    // Modifying the bitmap makes its existing variants unused.
+    bmp.SetMask(new wxMask(bmp, *wxBLACK));
+    CHECK( !wxScaledBitmapCache::GetScaled(bmp, 2).IsSameAs(bmp2) );
+    CHECK( wxScaledBitmapCache::GetStats().count == 3 );
+
+    // Removing the bitmap removes all its variants, old or new.
+    wxScaledBitmapCache::Remove(bmp);
+    CHECK( wxScaledBitmapCache::GetStats().count == 0 );
+
+    // The least recently used entries are removed when the cache is full.
+    wxScaledBitmapCache::SetMaxBytes(2*16*16*4);
+
+    const wxBitmap bmpA(img), bmpB(img), bmpC(img);
+    const wxBitmap bmpA2 = wxScaledBitmapCache::GetScaled(bmpA, 2);
+    wxScaledBitmapCache::GetScaled(bmpB, 2);
+    CHECK( wxScaledBitmapCache::GetScaled(bmpA, 2).IsSameAs(bmpA2) );
+
+    wxScaledBitmapCache::ResetStats();
+    wxScaledBitmapCache::GetScaled(bmpC, 2);
+
+    stats = wxScaledBitmapCache::GetStats();
+    CHECK( stats.evictions == 1 );
+    CHECK( stats.count == 2 );
+    CHECK( stats.bytes == 2*16*16*4 );
+
+    // The entry for bmpB, and not bmpA, must have been removed.
+    CHECK( wxScaledBitmapCache::GetScaled(bmpA, 2).IsSameAs(bmpA2) );
+    CHECK( wxScaledBitmapCache::GetStats().hits == 1 );
+
+    wxScaledBitmapCache::SetMaxBytes(16*1024*1024);
+
+    wxScaledBitmapCache::Enable(false);
+    CHECK( wxScaledBitmapCache::GetStats().count == 0 );
+}
+
 TEST_CASE("wxBitmap::GetSubBitmap", "[bitmap]")
 {
     // Make the logical size odd to test correct rounding.
@@ -18,6 +18,7 @@
 #include "wx/dcclient.h"
 #include "wx/dcgraph.h"
 #include "wx/dcmemory.h"
+#include "wx/dcpdf.h"
 #include "wx/dcsvg.h"
 #include "wx/app.h"
 #include "wx/window.h"
@@ -661,6 +662,66 @@ TEST_CASE("ClipperTestCase::wxSVGFileDC", "[clipper][dc][svgdc]")
 }
 #endif // wxUSE_SVG
 
+#if wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+TEST_CASE("ClipperTestCase::wxPDFFileDC", "[clipper][dc][pdfdc]")
+{
+    TestFile tf;
+    wxPDFFileDC dc(tf.GetName(), s_dcSize.x, s_dcSize.y);
+    dc.SetBackground(*wxWHITE_BRUSH);
+    dc.Clear();
+
+    SECTION("NoTransform")
+    {
+        NoTransform(dc);
+    }
+
+    SECTION("ExternalTransform 1")
+    {
+        ExternalTransform(dc, false);
+    }
+
+    SECTION("ExternalTransform 2")
+    {
+        ExternalTransform(dc, true);
+    }
+
+    SECTION("InternalTransform 1")
+    {
+        InternalTransform(dc, false);
+    }
+
+    SECTION("InternalTransform 2")
+    {
+        InternalTransform(dc, true);
+    }
+
+    SECTION("SpecificClipping")
+    {
+        SpecificClipping(dc);
+    }
+
+    SECTION("InternalTransformSpecificClipping 1")
+    {
+        InternalTransformSpecificClipping(dc, false);
+    }
+
+    SECTION("InternalTransformSpecificClipping 2")
+    {
+        InternalTransformSpecificClipping(dc, true);
+    }
+
+    SECTION("NoTransformEmbeddedClip")
+    {
+        NoTransformEmbeddedClip(dc);
+    }
+
+    SECTION("DCAttributes")
+    {
+        DCAttributes(dc);
+    }
+}
+#endif // wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+
 TEST_CASE("ClipperTestCase::wxPaintDC", "[clipper][dc][paintdc]")
 {
     // Ensure window is shown and large enough for testing
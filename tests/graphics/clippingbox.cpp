@@ -16,6 +16,7 @@
 #include "wx/bitmap.h"
 #include "wx/dcmemory.h"
 #include "wx/dcgraph.h"
+#include "wx/dcpdf.h"
 #include "wx/dcsvg.h"
 #include "wx/app.h"
 #include "wx/window.h"
@@ -3966,6 +3967,332 @@ TEST_CASE("ClippingBoxTestCase::wxSVGFileDC", "[clip][dc][svgdc]")
 }
 #endif // wxUSE_SVG
 
+#if wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+TEST_CASE("ClippingBoxTestCase::wxPDFFileDC", "[clip][dc][pdfdc]")
+{
+    wxBitmap bmp; // We need wxNullBitmap because we can't check the output
+    TestFile tf;
+    wxPDFFileDC dc(tf.GetName(), s_dcSize.x, s_dcSize.y);
+    dc.SetBackground(wxBrush(s_bgColour, wxBRUSHSTYLE_SOLID));
+    dc.Clear();
+
+    SECTION("InitialState")
+    {
+        InitialState(dc, bmp, wxPoint());
+    }
+
+    SECTION("InitialStateWithTransformedDC 1")
+    {
+        InitialStateWithTransformedDC(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("InitialStateWithTransformedDC 2")
+    {
+        InitialStateWithTransformedDC(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("InitialStateWithTransformedDC Transform Matrix")
+    {
+        InitialStateWithTransformedDC(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("InitialStateWithRotatedDC")
+    {
+        InitialStateWithRotatedDC(dc, bmp, wxPoint());
+    }
+
+    SECTION("SameRegionRepeatRotatedDC")
+    {
+        SameRegionRepeatRotatedDC(dc, wxPoint());
+    }
+
+    SECTION("OneRegion")
+    {
+        OneRegion(dc, bmp, wxPoint());
+    }
+
+    SECTION("OneLargeRegion")
+    {
+        OneLargeRegion(dc, bmp, wxPoint());
+    }
+
+    SECTION("OneOuterRegion")
+    {
+        OneOuterRegion(dc, bmp);
+    }
+
+    SECTION("OneRegionNegDim")
+    {
+        OneRegionNegDim(dc, bmp, wxPoint());
+    }
+
+    SECTION("OneRegionAndReset")
+    {
+        OneRegionAndReset(dc, bmp, wxPoint());
+    }
+
+    SECTION("OneRegionAndEmpty")
+    {
+        OneRegionAndEmpty(dc, bmp);
+    }
+
+    SECTION("OneRegionOverTransformedDC 1")
+    {
+        OneRegionOverTransformedDC(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneRegionOverTransformedDC 2")
+    {
+        OneRegionOverTransformedDC(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneRegionOverTransformedDC Transform Matrix")
+    {
+        OneRegionOverTransformedDC(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("OneRegionOverRotatedDC")
+    {
+        OneRegionOverRotatedDC(dc);
+    }
+
+    SECTION("OneRegionAndDCTransformation 1")
+    {
+        OneRegionAndDCTransformation(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneRegionAndDCTransformation 2")
+    {
+        OneRegionAndDCTransformation(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneRegionAndDCTransformation Transform Matrix")
+    {
+        OneRegionAndDCTransformation(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("OneRegionRTL")
+    {
+        OneRegionRTL(dc, bmp);
+    }
+
+    SECTION("TwoRegionsOverlapping")
+    {
+        TwoRegionsOverlapping(dc, bmp, wxPoint());
+    }
+
+    SECTION("TwoRegionsOverlappingNegDim")
+    {
+        TwoRegionsOverlappingNegDim(dc, bmp, wxPoint());
+    }
+
+    SECTION("TwoRegionsNonOverlapping")
+    {
+        TwoRegionsNonOverlapping(dc, bmp);
+    }
+
+    SECTION("TwoRegionsNonOverlappingNegDim")
+    {
+        TwoRegionsNonOverlappingNegDim(dc, bmp);
+    }
+
+    SECTION("OneDevRegion 1")
+    {
+        OneDevRegion(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneDevRegion 2")
+    {
+        OneDevRegion(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneDevRegion Transform Matrix")
+    {
+        OneDevRegion(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("OneDevRegionRTL")
+    {
+        OneDevRegionRTL(dc, bmp, false);
+    }
+
+    SECTION("OneDevRegionRTL TransformMatrix")
+    {
+        OneDevRegionRTL(dc, bmp, true);
+    }
+
+    SECTION("OneLargeDevRegion 1")
+    {
+        OneLargeDevRegion(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneLargeDevRegion 2")
+    {
+        OneLargeDevRegion(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneLargeDevRegion Transform Matrix")
+    {
+        OneLargeDevRegion(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("OneOuterDevRegion")
+    {
+        OneOuterDevRegion(dc, bmp, false);
+    }
+
+    SECTION("OneOuterDevRegion Transform Matrix")
+    {
+        OneOuterDevRegion(dc, bmp, true);
+    }
+
+    SECTION("OneDevRegionNegDim 1")
+    {
+        OneDevRegionNegDim(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionNegDim 2")
+    {
+        OneDevRegionNegDim(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionNegDim Transform Matrix")
+    {
+        OneDevRegionNegDim(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("OneDevRegionNonRect 1")
+    {
+        OneDevRegionNonRect(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionNonRect 2")
+    {
+        OneDevRegionNonRect(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionNonRect Transform Matrix")
+    {
+        OneDevRegionNonRect(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("OneDevRegionAndReset 1")
+    {
+        OneDevRegionAndReset(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionAndReset 2")
+    {
+        OneDevRegionAndReset(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionAndReset Transform Matrix")
+    {
+        OneDevRegionAndReset(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("OneDevRegionAndEmpty")
+    {
+        OneDevRegionAndEmpty(dc, bmp, false);
+    }
+
+    SECTION("OneDevRegionAndEmpty Transform Matrix")
+    {
+        OneDevRegionAndEmpty(dc, bmp, true);
+    }
+
+    SECTION("OneDevRegionOverTransformedDC 1")
+    {
+        OneDevRegionOverTransformedDC(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionOverTransformedDC 2")
+    {
+        OneDevRegionOverTransformedDC(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionOverTransformedDC Transform Matrix")
+    {
+        OneDevRegionOverTransformedDC(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("OneDevRegionOverRotatedDC")
+    {
+        OneDevRegionOverRotatedDC(dc);
+    }
+
+    SECTION("OneDevRegionAndDCTransformation 1")
+    {
+        OneDevRegionAndDCTransformation(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionAndDCTransformation 2")
+    {
+        OneDevRegionAndDCTransformation(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("OneDevRegionAndDCTransformation Transform Matrix")
+    {
+        OneDevRegionAndDCTransformation(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("TwoDevRegionsOverlapping 1")
+    {
+        TwoDevRegionsOverlapping(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("TwoDevRegionsOverlapping 2")
+    {
+        TwoDevRegionsOverlapping(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("TwoDevRegionsOverlapping Transform Matrix")
+    {
+        TwoDevRegionsOverlapping(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("TwoDevRegionsOverlappingNegDim 1")
+    {
+        TwoDevRegionsOverlappingNegDim(dc, bmp, false, false, wxPoint());
+    }
+
+    SECTION("TwoDevRegionsOverlappingNegDim 2")
+    {
+        TwoDevRegionsOverlappingNegDim(dc, bmp, true, false, wxPoint());
+    }
+
+    SECTION("TwoDevRegionsOverlappingNegDim Transform Matrix")
+    {
+        TwoDevRegionsOverlappingNegDim(dc, bmp, true, true, wxPoint());
+    }
+
+    SECTION("TwoDevRegionsNonOverlapping")
+    {
+        TwoDevRegionsNonOverlapping(dc, bmp, false);
+    }
+
+    SECTION("TwoDevRegionsNonOverlapping Transform Matrix")
+    {
+        TwoDevRegionsNonOverlapping(dc, bmp, true);
+    }
+
+    SECTION("TwoDevRegionsNonOverlappingNegDim")
+    {
+        TwoDevRegionsNonOverlappingNegDim(dc, bmp, false);
+    }
+
+    SECTION("TwoDevRegionsNonOverlappingNegDim Transform Matrix")
+    {
+        TwoDevRegionsNonOverlappingNegDim(dc, bmp, true);
+    }
+
+    SECTION("DCAttributes")
+    {
+        DcAttributes(dc);
+    }
+}
+#endif // wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+
 TEST_CASE("ClippingBoxTestCase::wxPaintDC", "[clip][dc][paintdc]")
 {
     wxBitmap bmp; // We need wxNullBitmap because we can't check the output
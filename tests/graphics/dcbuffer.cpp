@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/graphics/dcbuffer.cpp
+// Purpose:     wxBufferedPaintDC unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/image.h"
+    #include "wx/window.h"
+#endif // WX_PRECOMP
+
+#include "wx/dcbuffer.h"
+
+#include "asserthelper.h"
+#include "waitfor.h"
+
+#include <memory>
+
+// ----------------------------------------------------------------------------
+// helper window using a retained buffer
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+class RetainedCanvas : public wxWindow
+{
+public:
+    explicit RetainedCanvas(wxWindow* parent)
+        : wxWindow(parent, wxID_ANY, wxPoint(), wxSize(100, 100)),
+          m_colour(*wxRED),
+          m_painted(false)
+    {
+        SetBackgroundStyle(wxBG_STYLE_PAINT);
+        Bind(wxEVT_PAINT, &RetainedCanvas::OnPaint, this);
+    }
+
+    // Colour used for the background of the damaged parts.
+    void SetColour(const wxColour& colour) { m_colour = colour; }
+
+    // Wait until the window is repainted and return true if it was.
+    bool WaitForRepaint()
+    {
+        m_painted = false;
+        m_damaged.Clear();
+
+        return WaitFor("repaint", [this]() { return m_painted; });
+    }
+
+    // Region damaged during the repaints since the last WaitForRepaint().
+    const wxRegion& GetDamaged() const { return m_damaged; }
+
+    // Colour of the given point of the buffer after the last repaint.
+    wxColour GetBufferColour(int x, int y) const
+    {
+        const wxImage image = m_buffer.ConvertToImage();
+        return wxColour(image.GetRed(x, y),
+                        image.GetGreen(x, y),
+                        image.GetBlue(x, y));
+    }
+
+private:
+    void OnPaint(wxPaintEvent&)
+    {
+        wxBufferedPaintDC dc(this, wxBUFFER_RETAINED);
+
+        m_damaged.Union(dc.GetDamagedRegion());
+        m_painted = true;
+
+        // The drawing is clipped to the damaged region, so only the damaged
+        // parts of the background and of the band are really drawn.
+        const wxSize size = GetClientSize();
+        dc.SetPen(*wxTRANSPARENT_PEN);
+        dc.SetBrush(wxBrush(m_colour));
+        dc.DrawRectangle(wxPoint(), size);
+
+        dc.SetBrush(*wxGREEN_BRUSH);
+        dc.DrawRectangle(0, 20, size.x, 10);
+
+        m_buffer = dc.GetSelectedBitmap();
+    }
+
+    wxColour m_colour;
+    wxRegion m_damaged;
+    wxBitmap m_buffer;
+    bool m_painted;
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests themselves
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxBufferedPaintDC::Retained", "[dc][dcbuffer]")
+{
+    bool hasBufferAfterDestroy = true;
+
+    std::unique_ptr<RetainedCanvas>
+        win(new RetainedCanvas(wxTheApp->GetTopWindow()));
+
+    // This must be bound before the window is painted for the first time
+    // for this handler to be called after the one used by wxBufferedPaintDC.
+    wxWindow* const canvas = win.get();
+    win->Bind(wxEVT_DESTROY,
+              [canvas, &hasBufferAfterDestroy](wxWindowDestroyEvent& event)
+              {
+                  event.Skip();
+
+                  if ( event.GetWindow() == canvas )
+                  {
+                      hasBufferAfterDestroy =
+                          wxBufferedPaintDC::ScrollBuffer(canvas, 0, 0);
+                  }
+              });
+
+    const wxRect rectAll(win->GetClientSize());
+
+    // The entire buffer is damaged when it is drawn for the first time.
+    win->Refresh();
+    CHECK( win->WaitForRepaint() );
+    CHECK( win->GetDamaged().GetBox() == rectAll );
+
+    SECTION("Refresh")
+    {
+        // Plain Refresh() doesn't damage anything.
+        win->Refresh();
+        CHECK( win->WaitForRepaint() );
+        CHECK( win->GetDamaged().IsEmpty() );
+    }
+
+    SECTION("Accumulate")
+    {
+        const wxRect rect1(0, 0, 10, 10);
+        const wxRect rect2(50, 50, 10, 10);
+
+        wxBufferedPaintDC::RefreshBuffer(win.get(), &rect1);
+        wxBufferedPaintDC::RefreshBuffer(win.get(), &rect2);
+        CHECK( win->WaitForRepaint() );
+
+        const wxRegion& damaged = win->GetDamaged();
+        CHECK( damaged.Contains(rect1) == wxInRegion );
+        CHECK( damaged.Contains(rect2) == wxInRegion );
+        CHECK( damaged.Contains(wxRect(20, 20, 10, 10)) == wxOutRegion );
+        CHECK( damaged.GetBox() == wxRect(0, 0, 60, 60) );
+    }
+
+    SECTION("Scroll")
+    {
+        win->SetColour(*wxBLUE);
+
+        REQUIRE( wxBufferedPaintDC::ScrollBuffer(win.get(), 0, 10) );
+        CHECK( win->WaitForRepaint() );
+
+        // Only the uncovered strip is redrawn.
+        CHECK( win->GetDamaged().GetBox() == wxRect(0, 0, rectAll.width, 10) );
+
+        // And the rest of the buffer contents is shifted down.
+        CHECK( win->GetBufferColour(5, 5) == *wxBLUE );
+        CHECK( win->GetBufferColour(5, 15) == *wxRED );
+        CHECK( win->GetBufferColour(5, 25) == *wxRED );
+        CHECK( win->GetBufferColour(5, 35) == *wxGREEN );
+        CHECK( win->GetBufferColour(5, 45) == *wxRED );
+    }
+
+    SECTION("Destroy")
+    {
+        // Destroying a child window doesn't affect the parent buffer.
+        delete new wxWindow(win.get(), wxID_ANY);
+        CHECK( wxBufferedPaintDC::ScrollBuffer(win.get(), 0, 0) );
+
+        // But destroying the window itself frees its buffer.
+        win.reset();
+        CHECK( !hasBufferAfterDestroy );
+    }
+
+    SECTION("Discard")
+    {
+        wxBufferedPaintDC::DiscardBuffer(win.get());
+        CHECK( !wxBufferedPaintDC::ScrollBuffer(win.get(), 0, 10) );
+
+        win->Refresh();
+        CHECK( win->WaitForRepaint() );
+        CHECK( win->GetDamaged().GetBox() == rectAll );
+    }
+}
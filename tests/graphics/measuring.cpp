@@ -28,10 +28,16 @@
 
 #include "wx/dcclient.h"
 #include "wx/dcmemory.h"
+#include "wx/dcpdf.h"
 #include "wx/dcps.h"
 #include "wx/metafile.h"
 
+#include "wx/private/textmeasure.h"
+
 #include "asserthelper.h"
+#include "testfile.h"
+
+#include <vector>
 
 // ----------------------------------------------------------------------------
 // helper for XXXTextExtent() methods
@@ -112,6 +118,33 @@ TEST_CASE("wxPostScriptDC::GetTextExtent", "[psdc][text-extent]")
 }
 #endif // wxUSE_POSTSCRIPT
 
+#if wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+TEST_CASE("wxPDFFileDC::GetTextExtent", "[pdfdc][text-extent]")
+{
+    TempFile pdf("textextent.pdf");
+
+    // Use 72 DPI for the device units to be the same as points.
+    wxPDFFileDC dc(pdf.GetName(), 595, 842, 72);
+    dc.SetFont(*wxNORMAL_FONT);
+    GetTextExtentTester(dc);
+
+    // The extents must be computed using the metrics of the standard fonts
+    // used in the output file and not those of the screen fonts.
+    dc.SetFont(wxFontInfo(10).Family(wxFONTFAMILY_TELETYPE));
+    CHECK( dc.GetTextExtent("Hello").x == 30 );
+
+    dc.SetFont(wxFontInfo(100).FaceName("Helvetica"));
+    wxCoord w, h, descent;
+    dc.GetTextExtent("Hi", &w, &h, &descent);
+    CHECK( w == 94 );
+    CHECK( h == 93 );
+    CHECK( descent == 21 );
+
+    dc.SetFont(wxFontInfo(100).FaceName("Helvetica").Bold());
+    CHECK( dc.GetTextExtent("Hi").x == 100 );
+}
+#endif // wxUSE_ZLIB && wxUSE_STREAMS && wxUSE_IMAGE
+
 #if wxUSE_ENH_METAFILE
 TEST_CASE("wxEnhMetaFileDC::GetTextExtent", "[emfdc][text-extent]")
 {
@@ -167,6 +200,64 @@ TEST_CASE("wxDC::GetPartialTextExtent", "[dc][text-extent][partial]")
     CHECK( widths[4] == dc.GetTextExtent("Hello").x );
 }
 
+TEST_CASE("wxTextMeasure::GetTextExtents", "[text-extent]")
+{
+    wxWindow* const win = wxTheApp->GetTopWindow();
+
+    wxArrayString strings;
+    strings.push_back("Hello");
+    strings.push_back(wxString());
+    strings.push_back("W");
+    strings.push_back("Good\nbye");
+    strings.push_back("\n");
+    strings.push_back(wxString());
+    strings.push_back("iiiiiiiiiiii");
+
+    // Check that the batch results are the same as when measuring each string
+    // individually, using the different fonts in turn.
+    wxFont fontBig = win->GetFont();
+    fontBig.SetFractionalPointSize(2*fontBig.GetFractionalPointSize());
+    fontBig.MakeBold();
+
+    const wxFont fonts[] = { win->GetFont(), fontBig, win->GetFont() };
+
+    for ( size_t n = 0; n < WXSIZEOF(fonts); n++ )
+    {
+        const wxFont& font = fonts[n];
+        INFO("Using font " << font.GetNativeFontInfoUserDesc());
+
+        std::vector<wxSize> sizes(strings.size());
+        wxTextMeasure(win, &font).GetTextExtents(strings, &sizes[0]);
+
+        int widthMax = 0;
+        for ( size_t i = 0; i < strings.size(); i++ )
+        {
+            const wxString& s = strings[i];
+            INFO("Measuring \"" << s << "\"");
+
+            wxCoord w, h;
+            wxTextMeasure(win, &font).GetMultiLineTextExtent(s, &w, &h);
+            CHECK( sizes[i] == wxSize(w, h) );
+
+            if ( s.empty() )
+                CHECK( sizes[i].x == 0 );
+            else if ( s.find('\n') == wxString::npos )
+            {
+                int x, y;
+                win->GetTextExtent(s, &x, &y, nullptr, nullptr, &font);
+                CHECK( sizes[i] == wxSize(x, y) );
+            }
+
+            if ( w > widthMax )
+                widthMax = w;
+        }
+
+        CHECK( wxTextMeasure(win, &font).GetMaxTextWidth(strings) == widthMax );
+    }
+
+    CHECK( wxTextMeasure(win, nullptr).GetMaxTextWidth(wxArrayString()) == 0 );
+}
+
 #ifdef TEST_GC
 
 TEST_CASE("wxGC::GetTextExtent", "[dc][text-extent]")
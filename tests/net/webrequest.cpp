@@ -508,6 +508,58 @@ TEST_CASE_METHOD(RequestFixture,
     CHECK( responseStringFromEvent == "Still alive!" );
 }
 
+TEST_CASE_METHOD(RequestFixture,
+                 "WebRequest::Get::Future", "[net][webrequest][get][future]")
+{
+    if ( !InitBaseURL() )
+        return;
+
+    Create("/base64/VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw==");
+
+    // The continuation added without a handler is executed immediately
+    // after the event is processed by the request handler.
+    wxString body;
+    wxFuture<wxWebRequest::State> future = request.StartAsync()
+        .Then([&body](const wxWebRequestEvent& event)
+        {
+            if ( event.GetResponse().IsOk() )
+                body = event.GetResponse().AsString();
+
+            return event.GetState();
+        });
+    REQUIRE( future.IsValid() );
+    CHECK( !future.IsReady() );
+
+    RunLoopWithTimeout();
+
+    // The events are still sent to the handler and the future gets the
+    // same final state.
+    REQUIRE( future.IsReady() );
+    CHECK( future.Get() == stateFromEvent );
+
+    REQUIRE( stateFromEvent == wxWebRequest::State_Completed );
+    CHECK( body == "The quick brown fox jumps over the lazy dog" );
+
+    // Completed requests can't be restarted.
+    WX_ASSERT_FAILS_WITH_ASSERT( request.StartAsync() );
+}
+
+TEST_CASE_METHOD(RequestFixture,
+                 "WebRequest::Get::FutureCancel", "[net][webrequest][get][future]")
+{
+    if ( !InitBaseURL() )
+        return;
+
+    Create("/delay/10");
+
+    wxFuture<wxWebRequestEvent> future = request.StartAsync();
+    request.Cancel();
+    RunLoopWithTimeout();
+
+    REQUIRE( future.IsReady() );
+    CHECK( future.Get().GetState() == wxWebRequest::State_Cancelled );
+}
+
 // This test is not run by default and has to be explicitly selected to run.
 TEST_CASE_METHOD(RequestFixture,
                  "WebRequest::Manual", "[.]")
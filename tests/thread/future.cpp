@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/thread/future.cpp
+// Purpose:     Unit tests for wxFuture and wxPromise
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#include "testprec.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/thread.h"
+#endif // WX_PRECOMP
+
+#include "wx/future.h"
+#include "wx/stopwatch.h"
+
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+// Process the pending events until the future becomes ready.
+template <typename T>
+bool WaitProcessingEvents(const wxFuture<T>& future)
+{
+    wxStopWatch sw;
+    while ( !future.IsReady() && sw.Time() < 10000 )
+    {
+        wxTheApp->ProcessPendingEvents();
+        wxMilliSleep(1);
+    }
+
+    return future.IsReady();
+}
+
+} // anonymous namespace
+
+TEST_CASE("Future::Promise", "[future]")
+{
+    wxPromise<int> promise;
+    wxFuture<int> future = promise.GetFuture();
+    CHECK( future.IsValid() );
+    CHECK( !future.IsReady() );
+
+    promise.SetValue(17);
+    CHECK( future.IsReady() );
+    CHECK( future.Get() == 17 );
+
+    CHECK( !wxFuture<int>().IsValid() );
+
+    wxFuture<void> ready = wxMakeReadyFuture();
+    CHECK( ready.IsReady() );
+    CHECK_NOTHROW( ready.Get() );
+}
+
+TEST_CASE("Future::MoveOnly", "[future]")
+{
+    wxPromise< std::unique_ptr<int> > promise;
+    wxFuture< std::unique_ptr<int> > future = promise.GetFuture();
+
+    // Continuations can still access the value by reference.
+    wxFuture<int> copy = future
+        .Then([](const std::unique_ptr<int>& p) { return *p; });
+
+    promise.SetValue(std::unique_ptr<int>(new int(17)));
+    CHECK( copy.Get() == 17 );
+
+    // And it can be moved out of the future once.
+    std::unique_ptr<int> value = future.TakeValue();
+    REQUIRE( value );
+    CHECK( *value == 17 );
+
+    // Exceptions are rethrown by TakeValue() as well.
+    wxPromise< std::unique_ptr<int> > failing;
+    failing.SetException(std::make_exception_ptr(std::runtime_error("oops")));
+    CHECK_THROWS_AS( failing.GetFuture().TakeValue(), std::runtime_error );
+}
+
+TEST_CASE("Future::Then", "[future]")
+{
+    wxPromise<int> promise;
+
+    bool calledVoid = false;
+    wxFuture<wxString> result = promise.GetFuture()
+        .Then([](int n) { return 2*n; })
+        .Then([&calledVoid](int n) { calledVoid = n == 42; })
+        .Then([]() { return wxString("done"); });
+
+    CHECK( !result.IsReady() );
+
+    // Inline continuations are executed when the value is set.
+    promise.SetValue(21);
+    CHECK( calledVoid );
+    REQUIRE( result.IsReady() );
+    CHECK( result.Get() == "done" );
+
+    // And immediately if it already is.
+    CHECK( wxMakeReadyFuture(1).Then([](int n) { return n + 1; }).Get() == 2 );
+}
+
+TEST_CASE("Future::Unwrap", "[future]")
+{
+    wxPromise<int> inner;
+
+    wxFuture<int> result = wxMakeReadyFuture()
+        .Then([inner]() { return inner.GetFuture(); });
+
+    CHECK( !result.IsReady() );
+
+    inner.SetValue(3);
+    REQUIRE( result.IsReady() );
+    CHECK( result.Get() == 3 );
+}
+
+TEST_CASE("Future::Exception", "[future]")
+{
+    SECTION("Propagate")
+    {
+        wxPromise<int> promise;
+
+        bool called = false;
+        wxFuture<int> result = promise.GetFuture()
+            .Then([&called](int n) { called = true; return n; });
+
+        promise.SetException(std::make_exception_ptr(std::runtime_error("oops")));
+        CHECK( !called );
+        CHECK_THROWS_AS( result.Get(), std::runtime_error );
+    }
+
+    SECTION("Throw")
+    {
+        wxFuture<void> result = wxMakeReadyFuture(1)
+            .Then([](int) { throw std::runtime_error("oops"); });
+        CHECK_THROWS_AS( result.Get(), std::runtime_error );
+    }
+
+    SECTION("Broken")
+    {
+        wxFuture<int> future;
+        {
+            wxPromise<int> promise;
+            future = promise.GetFuture();
+
+            wxPromise<int> copy(promise);
+        }
+
+        REQUIRE( future.IsReady() );
+        CHECK_THROWS_AS( future.Get(), std::future_error );
+    }
+}
+
+TEST_CASE("Future::Pool", "[future][thread]")
+{
+    wxThreadPool pool(2);
+
+    wxFuture<int> result = wxRunAsync([]() { return 6; }, pool)
+        .Then([&pool](int n) { return pool.IsWorkerThread() ? 7*n : 0; }, pool);
+
+    CHECK( result.Get() == 42 );
+}
+
+TEST_CASE("Future::Handler", "[future][thread]")
+{
+    wxThreadPool pool(2);
+
+    bool inMain = false;
+    wxFuture<void> result = wxRunAsync([]() { return 1; }, pool)
+        .Then([&inMain](int) { inMain = wxThread::IsMain(); }, wxTheApp);
+
+    REQUIRE( WaitProcessingEvents(result) );
+    CHECK( inMain );
+
+    // The continuation is not called if the handler is destroyed before it.
+    wxPromise<int> promise;
+    bool called = false;
+    wxFuture<void> dropped;
+    {
+        wxEvtHandler handler;
+        dropped = promise.GetFuture()
+            .Then([&called](int) { called = true; }, &handler);
+
+        promise.SetValue(1);
+    }
+
+    REQUIRE( WaitProcessingEvents(dropped) );
+    CHECK( !called );
+    CHECK_THROWS_AS( dropped.Get(), std::future_error );
+}
+
+TEST_CASE("Future::WhenAll", "[future]")
+{
+    std::vector< wxPromise<int> > promises(3);
+    std::vector< wxFuture<int> > futures;
+    for ( const auto& promise : promises )
+        futures.push_back(promise.GetFuture());
+
+    wxFuture< std::vector<int> > all = wxWhenAll(futures);
+
+    promises[2].SetValue(2);
+    promises[0].SetValue(0);
+    CHECK( !all.IsReady() );
+
+    promises[1].SetValue(1);
+    REQUIRE( all.IsReady() );
+    CHECK( all.Get() == std::vector<int>{0, 1, 2} );
+
+    CHECK( wxWhenAll(std::vector< wxFuture<int> >()).Get().empty() );
+
+    std::vector< wxFuture<void> > voids;
+    voids.push_back(wxMakeReadyFuture());
+    voids.push_back(wxMakeReadyFuture()
+                        .Then([]() { throw std::runtime_error("oops"); }));
+    CHECK_THROWS_AS( wxWhenAll(voids).Get(), std::runtime_error );
+}
+
+TEST_CASE("Future::WhenAny", "[future]")
+{
+    std::vector< wxPromise<void> > promises(3);
+    std::vector< wxFuture<void> > futures;
+    for ( const auto& promise : promises )
+        futures.push_back(promise.GetFuture());
+
+    wxFuture<size_t> any = wxWhenAny(futures);
+    CHECK( !any.IsReady() );
+
+    promises[1].SetValue();
+    REQUIRE( any.IsReady() );
+    CHECK( any.Get() == 1 );
+
+    promises[0].SetValue();
+    CHECK( any.Get() == 1 );
+}
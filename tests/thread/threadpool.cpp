@@ -0,0 +1,288 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/thread/threadpool.cpp
+// Purpose:     Unit tests for wxThreadPool and wxTaskGroup
+// Author:      wxWidgets team
+// Created:     2026-10-18
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#include "testprec.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/thread.h"
+#endif // WX_PRECOMP
+
+#include "wx/stopwatch.h"
+#include "wx/threadpool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("ThreadPool::Submit", "[thread][threadpool]")
+{
+    wxThreadPool pool(4);
+    CHECK( pool.GetWorkerCount() == 4 );
+    CHECK( !pool.IsWorkerThread() );
+
+    std::vector<std::future<int>> results;
+    for ( int n = 0; n < 100; n++ )
+        results.push_back(pool.Submit([n]() { return n*n; }));
+
+    for ( int n = 0; n < 100; n++ )
+        CHECK( results[n].get() == n*n );
+
+    auto inWorker = pool.Submit([&pool]() { return pool.IsWorkerThread(); });
+    CHECK( inWorker.get() );
+
+    auto failed = pool.Submit([]() -> int { throw std::runtime_error("oops"); });
+    CHECK_THROWS_AS( failed.get(), std::runtime_error );
+}
+
+TEST_CASE("ThreadPool::ParallelFor", "[thread][threadpool]")
+{
+    wxThreadPool pool(4);
+
+    const size_t count = 10000;
+    std::vector<int> hits(count);
+
+    SECTION("Auto")
+    {
+        pool.ParallelFor(0, count, 0, [&hits](size_t i) { hits[i]++; });
+
+        for ( size_t i = 0; i < count; i++ )
+            CHECK( hits[i] == 1 );
+    }
+
+    SECTION("Grain")
+    {
+        pool.ParallelFor(10, count, 7, [&hits](size_t i) { hits[i]++; });
+
+        for ( size_t i = 0; i < count; i++ )
+            CHECK( hits[i] == (i < 10 ? 0 : 1) );
+    }
+
+    SECTION("Empty")
+    {
+        pool.ParallelFor(5, 5, 1, [&hits](size_t i) { hits[i]++; });
+
+        CHECK( hits[5] == 0 );
+    }
+
+    SECTION("Cancel")
+    {
+        wxCancellationToken token;
+        std::atomic<size_t> done(0);
+        pool.ParallelFor(0, count, 1,
+                         [&](size_t i)
+                         {
+                             if ( i == 100 )
+                                 token.Cancel();
+                             done++;
+                         },
+                         token);
+
+        CHECK( done < count );
+    }
+
+    SECTION("Exception")
+    {
+        CHECK_THROWS_AS
+        (
+            pool.ParallelFor(0, count, 10,
+                             [](size_t i)
+                             {
+                                 if ( i == 1234 )
+                                     throw std::runtime_error("oops");
+                             }),
+            std::runtime_error
+        );
+    }
+}
+
+TEST_CASE("ThreadPool::TaskGroup", "[thread][threadpool]")
+{
+    wxThreadPool pool(2);
+
+    SECTION("Nested")
+    {
+        // Create the tasks from the other tasks and wait for them from the
+        // workers too, this must not deadlock even with just 2 workers.
+        wxTaskGroup group(pool);
+        std::atomic<int> done(0);
+        for ( int n = 0; n < 10; n++ )
+        {
+            group.Run([&pool, &done]()
+            {
+                wxTaskGroup inner(pool);
+                for ( int m = 0; m < 10; m++ )
+                    inner.Run([&done]() { done++; });
+                inner.Wait();
+            });
+        }
+
+        group.Wait();
+        CHECK( group.IsDone() );
+        CHECK( done == 100 );
+    }
+
+    SECTION("Cancel")
+    {
+        // Block both workers until the group is cancelled.
+        wxSemaphore started, cancelled;
+        wxTaskGroup blockers(pool);
+        for ( int n = 0; n < 2; n++ )
+        {
+            blockers.Run([&]()
+            {
+                started.Post();
+                cancelled.Wait();
+            });
+        }
+
+        started.Wait();
+        started.Wait();
+
+        wxTaskGroup group(pool);
+        bool called = false;
+        group.Run([&called]() { called = true; });
+        CHECK( !group.IsDone() );
+
+        group.Cancel();
+        CHECK( group.IsCancelled() );
+        CHECK( group.GetCancellationToken().IsCancelled() );
+
+        cancelled.Post();
+        cancelled.Post();
+
+        group.Wait();
+        blockers.Wait();
+        CHECK( !called );
+    }
+
+    SECTION("Exception")
+    {
+        wxTaskGroup group(pool);
+        group.Run([]() { throw std::runtime_error("oops"); });
+        CHECK_THROWS_AS( group.Wait(), std::runtime_error );
+
+        // The exception is only rethrown once.
+        CHECK_NOTHROW( group.Wait() );
+    }
+
+    SECTION("OnlyOwnTasks")
+    {
+        // Block both workers, so that the tasks can only be executed by the
+        // waiting thread.
+        wxSemaphore started, release;
+        wxTaskGroup blockers(pool);
+        for ( int n = 0; n < 2; n++ )
+        {
+            blockers.Run([&]()
+            {
+                started.Post();
+                release.Wait();
+            });
+        }
+
+        started.Wait();
+        started.Wait();
+
+        std::atomic<bool> otherDone(false);
+        pool.Post([&otherDone]() { otherDone = true; });
+
+        wxTaskGroup group(pool);
+        bool inWaiting = false;
+        group.Run([&inWaiting]() { inWaiting = wxThread::IsMain(); });
+        group.Wait();
+
+        // Only the task of the group was executed by Wait().
+        CHECK( inWaiting );
+        CHECK( !otherDone );
+
+        release.Post();
+        release.Post();
+        blockers.Wait();
+
+        wxStopWatch sw;
+        while ( !otherDone && sw.Time() < 10000 )
+            wxMilliSleep(1);
+        CHECK( otherDone );
+    }
+}
+
+TEST_CASE("ThreadPool::ContinueWith", "[thread][threadpool]")
+{
+    wxThreadPool pool(2);
+
+    std::atomic<int> done(0);
+    bool continued = false;
+    bool inMain = false;
+
+    wxTaskGroup group(pool);
+    for ( int n = 0; n < 10; n++ )
+        group.Run([&done]() { done++; });
+
+    group.ContinueWith([&]()
+    {
+        continued = true;
+        inMain = wxThread::IsMain();
+    });
+
+    group.Wait();
+    CHECK( done == 10 );
+
+    // The continuation is queued once the last task completes, which can
+    // happen slightly after Wait() returns.
+    wxStopWatch sw;
+    while ( !continued && sw.Time() < 10000 )
+    {
+        wxTheApp->ProcessPendingEvents();
+        wxMilliSleep(1);
+    }
+
+    CHECK( continued );
+    CHECK( inMain );
+}
+
+TEST_CASE("ThreadPool::ContinueWithHandler", "[thread][threadpool]")
+{
+    wxThreadPool pool(1);
+
+    wxSemaphore release;
+    wxTaskGroup group(pool);
+    group.Run([&release]() { release.Wait(); });
+
+    int called = 0;
+    wxEvtHandler alive;
+    group.ContinueWith([&called]() { called++; }, &alive);
+
+    // The continuation is not called if its handler is destroyed before
+    // the tasks complete.
+    wxTaskGroup other(pool);
+    other.Run([&release]() { release.Wait(); });
+    {
+        wxEvtHandler dead;
+        other.ContinueWith([&called]() { called += 10; }, &dead);
+    }
+
+    release.Post();
+    release.Post();
+    group.Wait();
+    other.Wait();
+
+    wxStopWatch sw;
+    while ( !called && sw.Time() < 10000 )
+    {
+        wxTheApp->ProcessPendingEvents();
+        wxMilliSleep(1);
+    }
+
+    // Give the other continuation a chance to be called, if it were.
+    wxMilliSleep(10);
+    wxTheApp->ProcessPendingEvents();
+
+    CHECK( called == 1 );
+}